@@ -22,11 +22,68 @@
 				  Add : I2C_Mem_Erase         function for erase external i2c memory.
 				  
 				  Add : time_out for exit from instruction.
+				  
+				  Add : I2C_Mem_Write_IT      function for queue a write for the TWI interrupt.
+				  Add : I2C_IT_Wait           function for wait until queued transfers are done.
+				  Add : _I2C_INTERRUPT_MODE   I2C_Mem_Write queues its transfer and returns.
+				  Add : _I2C_HOST_SIM         registers are redirected to a simulated block.
+				  
+				  Add : us step for flag waits instead of 1 ms.
+				  Add : I2C_GetStats          function for take wait/timeout statistics.
+				  Add : I2C_ResetStats        function for reset statistics.
+				  
+				  Add : I2C_Session_Begin/Write/End functions for stream data under one START.
+				  Add : I2C_SetTrustedDevice  function for probe a device only once or after an error.
+				  Add : I2C_Mem_WriteV        function for write data segments in one transaction.
+				  
+				  Add : I2C_SetClock          function for set the SCL frequency at run time.
+				  Add : I2C_GetClock          function for take the SCL frequency.
+				  Add : I2C_TuneClock         function for step the clock up while a device keeps up.
+				  Fix : TWSR takes the prescaler code instead of the prescaler value.
+				  
+				  Add : I2C_Mem_WritePages    function for write data page by page with ACK polling.
+				  Mod : I2C_Mem_Erase         writes page by page and waits each write cycle by ACK polling.
 ------------------------------------------------------------------------------
 */
 
 #include "i2c_unit.h"
 
+/* ------------------ Variables ------------------ */
+
+#ifdef _I2C_HOST_SIM
+I2C_SimTypeDef I2C_Sim; /* Simulated registers */
+#endif /* _I2C_HOST_SIM */
+
+#ifdef _I2C_INTERRUPT_MODE
+static I2C_QueueTypeDef I2C_Queue; /* Transfers of the TWI interrupt */
+#endif /* _I2C_INTERRUPT_MODE */
+
+static I2C_StatsTypeDef I2C_Stats; /* Wait statistics */
+static uint8_t I2C_InTransfer = _FALSE; /* START sent, STOP not yet */
+
+static I2C_SessionTypeDef I2C_Session; /* Write session */
+static I2C_TrustTypeDef I2C_Trust; /* Trusted device */
+
+static uint8_t I2C_BitRate = (uint8_t)( ( (_F_CPU / _F_SCL) - _I2C_SCL_DIV_MIN ) / (2 * _PRESCALER) ); /* TWBR of I2C_Init */
+static uint8_t I2C_PreCode = _PRE_CODE; /* TWSR prescaler bits of I2C_Init */
+
+/* ------------------ Prototypes ----------------- */
+
+static uint8_t I2C_WaitFlag(uint8_t flag , uint8_t state , uint16_t time_out);
+static uint8_t I2C_Probe(uint8_t dev_address , uint16_t time_out);
+static void I2C_Untrust(uint8_t dev_address);
+static void I2C_ApplyClock(uint8_t pre_code , uint8_t bit_rate);
+static StatusTypeDef I2C_Mem_WaitWriteCycle(uint8_t dev_address , uint16_t time_out);
+static StatusTypeDef I2C_Mem_FillPage(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , uint32_t quantity , uint16_t time_out);
+
+#ifdef _I2C_INTERRUPT_MODE
+static StatusTypeDef I2C_IT_Enqueue(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , const uint8_t *mem_data , uint16_t quantity , uint8_t copy);
+static StatusTypeDef I2C_IT_Write(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , const uint8_t *mem_data , uint32_t quantity , uint16_t time_out);
+static StatusTypeDef I2C_IT_Idle(uint16_t time_out);
+static void I2C_IT_Start(void);
+static void I2C_IT_Next(void);
+#endif /* _I2C_INTERRUPT_MODE */
+
 /* ------------------ Functions ------------------ */
 
 uint8_t I2C_Status(void) /* Function for take I2C status */
@@ -52,14 +109,21 @@ uint8_t I2C_BeginTransmission(uint16_t time_out) /* Function for send START cond
 {
 	/* --------------------------- */
 	
+	if ( !I2C_InTransfer ) /* New transfer, repeated START is part of the current one */
+	{
+		I2C_InTransfer = _TRUE;
+		I2C_Stats.Transfers++;
+		I2C_Stats.LastWaitUs   = 0;
+		I2C_Stats.LastTimeouts = 0;
+	}
+	else{}
+	
+	/* --------------------------- */
+	
 	_I2C_CR = (1 << TWINT)|(1 << TWSTA)|(1 << TWEN); /* Send START condition */
 	
 	/* --------------------------- */
-	while ( (!(_I2C_CR & (1 << TWINT))) && (time_out > 0) ) /* Wait for TWINT Flag set. This indicates that the START condition has been transmitted. */
-	{
-		_DELAY_MS(1);
-		time_out--;
-	}
+	I2C_WaitFlag(TWINT , _TRUE , time_out); /* Wait for TWINT Flag set. This indicates that the START condition has been transmitted. */
 	
 	/* --------------------------- */
 	return I2C_Status(); /* Return status */
@@ -88,11 +152,7 @@ uint8_t I2C_Transmit(uint8_t data , uint16_t time_out) /* Function for transmit
 	_I2C_CR = (1 << TWINT) | (1 << TWEN); /* Start transmission */
 	
 	/* --------------------------- */
-	while ( (!(_I2C_CR & (1 << TWINT))) && (time_out > 0)) /* Wait for TWINT Flag set. This indicates that the START condition has been transmitted. */
-	{
-		_DELAY_MS(1);
-		time_out--;
-	}
+	I2C_WaitFlag(TWINT , _TRUE , time_out); /* Wait for TWINT Flag set. This indicates that the START condition has been transmitted. */
 	
 	/* --------------------------- */
 	return I2C_Status();
@@ -119,11 +179,7 @@ uint8_t I2C_ReceiveACK(uint16_t time_out) /* Function for receive data with ACK
 	_I2C_CR = (1 << TWINT) | (1 << TWEA) | (1 << TWEN); /* Acknowledge Send */
 	
 	/* --------------------------- */
-	while ( (!(_I2C_CR & (1 << TWINT))) && (time_out > 0)) /* Wait for TWINT Flag set. This indicates that the START condition has been transmitted. */
-	{
-		_DELAY_MS(1);
-		time_out--;
-	}
+	I2C_WaitFlag(TWINT , _TRUE , time_out); /* Wait for TWINT Flag set. This indicates that the START condition has been transmitted. */
 	
 	/* --------------------------- */
 	return _I2C_DR; /* Return received data */
@@ -149,11 +205,7 @@ uint8_t I2C_ReceiveNACK(uint16_t time_out) /* Function for receive data with no
 	_I2C_CR = (1 << TWINT) | (1 << TWEN);
 
 	/* --------------------------- */
-	while ( (!(_I2C_CR & (1 << TWINT))) && (time_out > 0)) /* Wait for TWINT Flag set. This indicates that the START condition has been transmitted. */
-	{
-		_DELAY_MS(1);
-		time_out--;
-	}
+	I2C_WaitFlag(TWINT , _TRUE , time_out); /* Wait for TWINT Flag set. This indicates that the START condition has been transmitted. */
 	
 	/* --------------------------- */
 	return _I2C_DR; /* Return received data */
@@ -179,11 +231,9 @@ void I2C_EndTransmission(uint16_t time_out) /* Function for stop transmission I2
 	_I2C_CR = ((1 << TWINT)|(1 << TWEN)|(1 << TWSTO)); /* Transmit STOP condition */
 
 	/* --------------------------- */
-	while ( (_I2C_CR & (1 << TWSTO)) && (time_out > 0)) /* Wait for TWSTO Flag reset. */
-	{
-		_DELAY_MS(1);
-		time_out--;
-	}
+	I2C_WaitFlag(TWSTO , _FALSE , time_out); /* Wait for TWSTO Flag reset. */
+	
+	I2C_InTransfer = _FALSE; /* Transfer is done */
 	
 }
 /*
@@ -219,8 +269,8 @@ void I2C_Init(void) /* This Function is for Initialize the I2C peripheral. */
 	
 	/* ------- Initialize Prescaler & Bit rate ------- */
 	
-	_I2C_SR = _PRESCALER; /* Prescaler = 1 */
-	_I2C_BR = (uint8_t)( ( (_F_CPU / _F_SCL) - 16 ) / (2 * _PRESCALER) ); /* Calculate and set i2c bit rate */
+	_I2C_SR = I2C_PreCode; /* Prescaler of _PRESCALER or I2C_SetClock */
+	_I2C_BR = I2C_BitRate; /* Bit rate of _F_SCL or I2C_SetClock */
 
 	/* ----------------------------------------------- */
 	_I2C_CR = (1 << TWEN); /* Enable TWI  module */
@@ -256,15 +306,187 @@ void I2C_DeInit(void) /* This Function is for DeInitialize the I2C peripheral. *
 	Example       :
 					I2C_DeInit();
 			
-*/
+*/
+
+StatusTypeDef I2C_SetClock(uint32_t f_scl) /* This function is for set the SCL frequency */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint32_t divider; /* F_CPU / SCL, rounded up to stay at or below f_scl */
+	uint32_t bit_rate = 0;
+	uint8_t pre_code = 0;
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	if ( (f_scl == 0) || (f_scl > (_F_CPU / _I2C_SCL_DIV_MIN)) ) /* TWBR = 0 is the fastest setting */
+	{
+		return _STAT_ERROR;
+	}
+	else{}
+	
+	divider = (_F_CPU + f_scl - 1) / f_scl;
+	
+	/* --------------------------------- */
+	
+	for (; pre_code < _I2C_PRE_CODES ; pre_code++) /* Smallest prescaler keeps the finest steps */
+	{
+		
+		bit_rate = ( (divider - _I2C_SCL_DIV_MIN) + (2UL << (2 * pre_code)) - 1 ) / (2UL << (2 * pre_code));
+		
+		if ( bit_rate <= _I2C_BR_MAX )
+		{
+			break;
+		}
+		else{}
+		
+	}
+	
+	if ( pre_code == _I2C_PRE_CODES ) /* Slower than TWBR = 255 with prescaler 64 */
+	{
+		return _STAT_ERROR;
+	}
+	else{}
+	
+	/* --------------------------------- */
+	
+	I2C_ApplyClock(pre_code , (uint8_t)bit_rate);
+	
+	return _STAT_OK;
+	
+}
+/*
+	Parameters    :
+					f_scl : SCL frequency (Hz).
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR
+	
+	Example       :
+					I2C_SetClock(_I2C_SCL_FAST);
+			
+*/
+
+uint32_t I2C_GetClock(void) /* This function is for take the SCL frequency */
+{
+	
+	return _F_CPU / ( _I2C_SCL_DIV_MIN + ((uint32_t)I2C_BitRate << (2 * I2C_PreCode + 1)) ); /* 2 * TWBR * 4^TWPS */
+	
+}
+/*
+	Parameters    :
+	
+	Return Values :
+					SCL frequency (Hz).
+	
+	Example       :
+					uint32_t my_clock;
+					
+					my_clock = I2C_GetClock();
+			
+*/
+
+uint32_t I2C_TuneClock(uint8_t dev_address , uint32_t f_max , uint32_t f_step , uint8_t *test_data , uint16_t quantity , uint16_t time_out) /* This function is for find the fastest stable clock of a device */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint8_t best_pre_code = I2C_PreCode; /* Last clock that passed, the start clock is trusted */
+	uint8_t best_bit_rate = I2C_BitRate;
+	uint32_t f_try = I2C_GetClock();
+	uint8_t trials = 0;
+	
+	/* ^^^^^^^^^^^^^^^^^^^^ Wait for interrupt ^^^^^^^^^^^^^^^^^^^ */
+	
+	#ifdef _I2C_INTERRUPT_MODE
+	I2C_IT_Idle(time_out); /* Queued transfers keep their clock */
+	#endif /* _I2C_INTERRUPT_MODE */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	while ( (f_step > 0) && ((f_try + f_step) <= f_max) )
+	{
+		
+		f_try += f_step;
+		
+		if ( I2C_SetClock(f_try) != _STAT_OK ) /* Above F_CPU / 16 */
+		{
+			break;
+		}
+		else{}
+		
+		/* --------------------------------- */
+		
+		for (trials = 0 ; trials < _I2C_TUNE_TRIALS ; trials++)
+		{
+			
+			if ( I2C_IsDeviceReady(dev_address , 1 , time_out) != _TRUE ) /* Address is not acknowledged */
+			{
+				break;
+			}
+			else{}
+			
+			if ( (quantity > 0) && (I2C_Master_Transmit(dev_address , test_data , quantity , time_out) != _STAT_OK) ) /* Data is not acknowledged */
+			{
+				break;
+			}
+			else{}
+			
+		}
+		
+		if ( trials < _I2C_TUNE_TRIALS ) /* First unstable step ends the search */
+		{
+			break;
+		}
+		else{}
+		
+		best_pre_code = I2C_PreCode;
+		best_bit_rate = I2C_BitRate;
+		
+	}
+	
+	/* --------------------------------- */
+	
+	I2C_ApplyClock(best_pre_code , best_bit_rate);
+	
+	return I2C_GetClock();
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					dev_address : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+					
+					f_max : Highest SCL frequency to try (Hz).
+					f_step : Increase of each step (Hz).
+					
+					test_data : Bytes written at every trial.
+					quantity : Amount of test data (0 = probe only).
+					time_out : Timeout duration.
+	
+	Return Values :
+					SCL frequency (Hz) that is kept.
+	
+	Example       :
+					uint8_t my_nop[2] = {0x00 , 0xE3}; (SSD1306 NOP command)
+					
+					I2C_TuneClock(0x78 , _I2C_SCL_FAST_PLUS , 100000UL , my_nop , 2 , 10);
+			
+*/
 
-uint8_t I2C_IsDeviceReady(uint8_t dev_address , uint16_t trials , uint16_t time_out) /* Checks if target device is ready for communication. */
-{
+uint8_t I2C_IsDeviceReady(uint8_t dev_address , uint16_t trials , uint16_t time_out) /* Checks if target device is ready for communication. */
+{
 	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
 	
 	uint8_t i2c_status = 0; /* Variable for check status */
 	uint16_t step_check = 0; /* Variable to check the completed steps */
 	
+	/* ^^^^^^^^^^^^^^^^^^^^ Wait for interrupt ^^^^^^^^^^^^^^^^^^^ */
+	
+	#ifdef _I2C_INTERRUPT_MODE
+	I2C_IT_Idle(time_out); /* Queued transfers own the bus */
+	#endif /* _I2C_INTERRUPT_MODE */
+	
 	/* ^^^^^^^^^^^^^^^^^^^^ Reinitialize I2C ^^^^^^^^^^^^^^^^^^^^^ */
 	
 	I2C_DeInit(); /* DeInitialize i2c */
@@ -554,8 +776,13 @@ StatusTypeDef I2C_Master_Receive(uint8_t dev_address , uint8_t *data , uint32_t
 			
 */
 
-StatusTypeDef I2C_Mem_Write(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , uint8_t *mem_data , uint32_t quantity , uint16_t time_out) /* This function is for write data to external memory */
-{
+StatusTypeDef I2C_Mem_Write(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , uint8_t *mem_data , uint32_t quantity , uint16_t time_out) /* This function is for write data to external memory */
+{
+	#ifdef _I2C_INTERRUPT_MODE
+	
+	return I2C_IT_Write(dev_address , mem_address , mem_add_size , mem_data , quantity , time_out); /* Send by TWI interrupt */
+	
+	#else
 	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
 	
 	uint8_t i2c_status = 0; /* Variable for check status */
@@ -564,7 +791,7 @@ StatusTypeDef I2C_Mem_Write(uint8_t dev_address , uint32_t mem_address , uint8_t
 	
 	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
 	
-	if ( I2C_IsDeviceReady(dev_address , 1 , time_out) == _TRUE ) /* target device is ready */
+	if ( I2C_Probe(dev_address , time_out) == _TRUE ) /* target device is ready */
 	{
 		
 		i2c_status = I2C_BeginTransmission(time_out); /* Begin Transmission */
@@ -668,10 +895,17 @@ StatusTypeDef I2C_Mem_Write(uint8_t dev_address , uint32_t mem_address , uint8_t
 		i2c_status = _STAT_ERROR; /* Set status */
 	}
 	
-	return i2c_status;
-	
-	/* Function End */
-}
+	if ( i2c_status == _STAT_ERROR ) /* Transfer failed */
+	{
+		I2C_Untrust(dev_address); /* Probe again next time */
+	}
+	else{}
+	
+	return i2c_status;
+	
+	#endif /* _I2C_INTERRUPT_MODE */
+	/* Function End */
+}
 /*
 	Parameters    :
 					dev_address : Target device address: The device 7 bits 
@@ -877,122 +1111,42 @@ StatusTypeDef I2C_Mem_Read(uint8_t dev_address , uint32_t mem_address , uint8_t
 			
 */
 
-StatusTypeDef I2C_Mem_Erase(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , uint32_t quantity , uint16_t time_out) /* This function is for erase external memory */
-{
+StatusTypeDef I2C_Mem_Erase(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , uint32_t quantity , uint16_t time_out) /* This function is for erase external memory */
+{
 	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
 	
-	uint8_t i2c_status = 0; /* Variable for check status */
-	uint32_t write_quantity = quantity; /* Variable for check write quantity */
-	uint32_t step_check = 0; /* Variable to check the completed steps */
+	StatusTypeDef i2c_status = _STAT_OK; /* Variable for check status */
+	uint32_t chunk; /* Bytes of one write */
 	
 	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
 	
-	if ( I2C_IsDeviceReady(dev_address , 1 , time_out) == _TRUE ) /* target device is ready */
+	while ( (quantity > 0) && (i2c_status == _STAT_OK) ) /* One write per page */
 	{
 		
-		i2c_status = I2C_BeginTransmission(time_out); /* Begin Transmission */
-		
-		/* --------------------------------- */
-		
-		if ( mem_add_size == _I2C_MEMADD_SIZE_8BIT ) /* Check memory address size */
-		{
-			
-			if ( i2c_status == _MT_START_TRANSMITTED ) /* START condition has been transmitted */
-			{
-				i2c_status = I2C_Transmit( (dev_address | (uint8_t)((mem_address >> _P0_SHIFT_VAL_MEMADD_SIZE_8BIT) & _P0_BIT_SEL_MEMADD_SIZE_8BIT)) , time_out); /* Send Device Address */
-				step_check++; /* The step is completed */
-			}
-			else{}
-			
-			/* ~~~~~~~~~~~~ Send LSB Memory Address ~~~~~~~~~~~~ */
-			
-			if ( i2c_status == _MT_SLA_W_TRANSMITTED_ACK ) /* Data has been transmitted, and ACK has been received. */
-			{
-				i2c_status = I2C_Transmit( (uint8_t)mem_address , time_out ); /* Send second memory Address */
-				step_check++; /* The step is completed */
-			}
-			else{}
-			
-		}
-		else
-		{
-			
-			if ( i2c_status == _MT_START_TRANSMITTED ) /* START condition has been transmitted */
-			{
-				i2c_status = I2C_Transmit( (dev_address | (uint8_t)((mem_address >> _P0_SHIFT_VAL_MEMADD_SIZE_16BIT) & _P0_BIT_SEL_MEMADD_SIZE_16BIT)) , time_out); /* Send Device Address */
-				step_check++; /* The step is completed */
-			}
-			else{}
-			
-			/* ~~~~~~~~~~~~ Send MSB Memory Address ~~~~~~~~~~~~ */
-			
-			if ( i2c_status == _MT_SLA_W_TRANSMITTED_ACK ) /* SLA+W has been transmitted, and ACK has been received. */
-			{
-				i2c_status = I2C_Transmit( (uint8_t)(mem_address >> _BYTE_SHIFT_VAL) , time_out); /* Send first memory Address */
-				step_check++; /* The step is completed */
-			}
-			else{}
-			
-			/* ~~~~~~~~~~~~ Send LSB Memory Address ~~~~~~~~~~~~ */
-			
-			if ( i2c_status == _MT_DATA_TRANSMITTED_ACK ) /* Data has been transmitted, and ACK has been received. */
-			{
-				i2c_status = I2C_Transmit( (uint8_t)mem_address , time_out ); /* Send second memory Address */
-				step_check++; /* The step is completed */
-			}
-			else{}
-			
-		}
-		
-		/* --------------------------------- */
+		chunk = _CALC_PAGE_REST(mem_address); /* A write never crosses a page, it would wrap */
 		
-		for ( ; quantity > 0 ; quantity-- ) /* Loop for write data to memory */
+		if ( chunk > quantity ) /* Check size */
 		{
-			
-			if ( i2c_status == _MT_DATA_TRANSMITTED_ACK ) /* DATA has been transmitted, and ACK has been received. */
-			{
-				
-				i2c_status = I2C_Transmit( _MEMORY_DEF_VAL , time_out ); /* Send data to memory */
-				step_check++; /* The step is completed */
-				
-			}
-			else{}
-			
+			chunk = quantity;
 		}
+		else{}
 		
-		/* --------------------------------- */
+		i2c_status = I2C_Mem_FillPage(dev_address , mem_address , mem_add_size , chunk , time_out); /* Write to memory */
 		
-		if ( i2c_status == _MT_DATA_TRANSMITTED_ACK ) /* DATA has been transmitted, and ACK has been received. */
+		if ( i2c_status == _STAT_OK ) /* Check status */
 		{
-			I2C_EndTransmission(time_out); /* End Transmission */
-			step_check++; /* The step is completed */
+			i2c_status = I2C_Mem_WaitWriteCycle(dev_address , time_out); /* Wait for Self Timed Write Cycle */
 		}
 		else{}
 		
-		/* --------------------------------- */
-		
-		if ( (mem_add_size == _I2C_MEMADD_SIZE_8BIT) && (step_check == ((_MEMORY_BURST_WRITE_STEPS - 1) + write_quantity)) ) /* The steps are complete */
-		{
-			i2c_status = _STAT_OK; /* Set status */
-		}
-		else if ( (mem_add_size == _I2C_MEMADD_SIZE_16BIT) && (step_check == (_MEMORY_BURST_WRITE_STEPS + write_quantity)) ) /* The steps are complete */
-		{
-			i2c_status = _STAT_OK; /* Set status */
-		}
-		else
-		{
-			i2c_status = _STAT_ERROR; /* Set status */
-		}
+		mem_address += chunk; /* Set new address */
+		quantity    -= chunk; /* Set new size */
 		
 	}
-	else
-	{
-		i2c_status = _STAT_ERROR; /* Set status */
-	}
 	
-	return i2c_status;
-	
-	/* Function End */
+	return i2c_status;
+	
+	/* Function End */
 }
 /*
 	Parameters    :
@@ -1007,17 +1161,1009 @@ StatusTypeDef I2C_Mem_Erase(uint8_t dev_address , uint32_t mem_address , uint8_t
 												 _I2C_MEMADD_SIZE_8BIT
 												 _I2C_MEMADD_SIZE_16BIT
 					
-					quantity : Amount of data to be erase.
+					quantity : Amount of data to be erase, split at the
+							   _MEM_PAGE_SIZE boundaries.
 					time_out : Timeout duration.
 	
 	Return Values :
-					_STAT_OK / _STAT_ERROR
+					_STAT_OK / _STAT_ERROR (NACK or write cycle longer
+					than _MEM_WRITE_CYCLE_MS)
 	
 	Example       :
 					uint8_t com_stat;
 					
-					com_stat = I2C_Mem_Read(0xA0 , 0 , _I2C_MEMADD_SIZE_16BIT , 10 , 100); (0xA0 : Device Address)
+					com_stat = I2C_Mem_Erase(0xA0 , 0 , _I2C_MEMADD_SIZE_16BIT , 10 , 100); (0xA0 : Device Address)
 			
-*/
+*/
+
+StatusTypeDef I2C_Mem_WritePages(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , uint8_t *mem_data , uint32_t quantity , uint16_t time_out) /* This function is for write data to external memory page by page */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	StatusTypeDef i2c_status = _STAT_OK; /* Variable for check status */
+	uint32_t chunk; /* Bytes of one write */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	while ( (quantity > 0) && (i2c_status == _STAT_OK) ) /* One write per page */
+	{
+		
+		chunk = _CALC_PAGE_REST(mem_address); /* A write never crosses a page, it would wrap */
+		
+		if ( chunk > quantity ) /* Check size */
+		{
+			chunk = quantity;
+		}
+		else{}
+		
+		i2c_status = I2C_Mem_Write(dev_address , mem_address , mem_add_size , mem_data , chunk , time_out); /* Write to memory */
+		
+		if ( i2c_status == _STAT_OK ) /* Check status */
+		{
+			i2c_status = I2C_Mem_WaitWriteCycle(dev_address , time_out); /* Wait for Self Timed Write Cycle */
+		}
+		else{}
+		
+		mem_address += chunk; /* Set new address */
+		mem_data    += chunk; /* Set new data */
+		quantity    -= chunk; /* Set new size */
+		
+	}
+	
+	return i2c_status;
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					dev_address : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+
+					mem_address : Internal memory address.
+					
+					mem_add_size : Size of internal memory address. this
+								   parameter is :
+												 _I2C_MEMADD_SIZE_8BIT
+												 _I2C_MEMADD_SIZE_16BIT
+					
+					mem_data : Pointer to data buffer.
+					quantity : Amount of data to be sent, split at the
+							   _MEM_PAGE_SIZE boundaries.
+					time_out : Timeout duration.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR (NACK or write cycle longer
+					than _MEM_WRITE_CYCLE_MS)
+	
+	Example       :
+					uint8_t com_stat;
+					
+					com_stat = I2C_Mem_WritePages(0xA0 , 0 , _I2C_MEMADD_SIZE_16BIT , my_splash , 1024 , 100); (0xA0 : Device Address)
+			
+*/
 
+StatusTypeDef I2C_Session_Begin(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , uint16_t time_out) /* This function is for start a write session */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint8_t i2c_status = 0; /* Variable for check status */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	if ( I2C_Session.Open ) /* Previous session is not closed */
+	{
+		I2C_Session_End(time_out);
+	}
+	else{}
+	
+	#ifdef _I2C_INTERRUPT_MODE
+	I2C_IT_Idle(time_out); /* Queued transfers own the bus */
+	#endif /* _I2C_INTERRUPT_MODE */
+	
+	I2C_Session.DevAddress = dev_address;
+	I2C_Session.Open = _TRUE;
+	I2C_Session.Error = _FALSE;
+	
+	/* --------------------------------- */
+	
+	if ( I2C_Probe(dev_address , time_out) == _TRUE ) /* target device is ready */
+	{
+		
+		i2c_status = I2C_BeginTransmission(time_out); /* Begin Transmission */
+		
+		/* --------------------------------- */
+		
+		if ( mem_add_size == _I2C_MEMADD_SIZE_8BIT ) /* Check memory address size */
+		{
+			
+			if ( i2c_status == _MT_START_TRANSMITTED ) /* START condition has been transmitted */
+			{
+				i2c_status = I2C_Transmit( (dev_address | (uint8_t)((mem_address >> _P0_SHIFT_VAL_MEMADD_SIZE_8BIT) & _P0_BIT_SEL_MEMADD_SIZE_8BIT)) , time_out); /* Send Device Address */
+			}
+			else{}
+			
+			/* ~~~~~~~~~~~~ Send LSB Memory Address ~~~~~~~~~~~~ */
+			
+			if ( i2c_status == _MT_SLA_W_TRANSMITTED_ACK ) /* SLA+W has been transmitted, and ACK has been received. */
+			{
+				i2c_status = I2C_Transmit( (uint8_t)mem_address , time_out ); /* Send memory Address */
+			}
+			else{}
+			
+		}
+		else
+		{
+			
+			if ( i2c_status == _MT_START_TRANSMITTED ) /* START condition has been transmitted */
+			{
+				i2c_status = I2C_Transmit( (dev_address | (uint8_t)((mem_address >> _P0_SHIFT_VAL_MEMADD_SIZE_16BIT) & _P0_BIT_SEL_MEMADD_SIZE_16BIT)) , time_out); /* Send Device Address */
+			}
+			else{}
+			
+			/* ~~~~~~~~~~~~ Send MSB Memory Address ~~~~~~~~~~~~ */
+			
+			if ( i2c_status == _MT_SLA_W_TRANSMITTED_ACK ) /* SLA+W has been transmitted, and ACK has been received. */
+			{
+				i2c_status = I2C_Transmit( (uint8_t)(mem_address >> _BYTE_SHIFT_VAL) , time_out); /* Send first memory Address */
+			}
+			else{}
+			
+			/* ~~~~~~~~~~~~ Send LSB Memory Address ~~~~~~~~~~~~ */
+			
+			if ( i2c_status == _MT_DATA_TRANSMITTED_ACK ) /* Data has been transmitted, and ACK has been received. */
+			{
+				i2c_status = I2C_Transmit( (uint8_t)mem_address , time_out ); /* Send second memory Address */
+			}
+			else{}
+			
+		}
+		
+	}
+	else{}
+	
+	/* --------------------------------- */
+	
+	if ( i2c_status != _MT_DATA_TRANSMITTED_ACK ) /* Address was not accepted */
+	{
+		I2C_Session.Error = _TRUE; /* Set error */
+	}
+	else{}
+	
+	return ( I2C_Session.Error ? _STAT_ERROR : _STAT_OK );
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					dev_address : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+
+					mem_address : Internal memory address (control byte).
+					
+					mem_add_size : Size of internal memory address. this
+								   parameter is :
+												 _I2C_MEMADD_SIZE_8BIT
+												 _I2C_MEMADD_SIZE_16BIT
+					
+					time_out : Timeout duration.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR
+	
+	Example       :
+					I2C_Session_Begin(0x78 , 0x40 , _I2C_MEMADD_SIZE_8BIT , 100);
+					I2C_Session_Write(my_data , 64 , 100);
+					I2C_Session_Write(my_data2 , 64 , 100);
+					com_stat = I2C_Session_End(100);
+					
+					I2C_Session_End must be called even if I2C_Session_Begin fails.
+			
+*/
+
+StatusTypeDef I2C_Session_Write(const uint8_t *data , uint32_t quantity , uint16_t time_out) /* This function is for send data in the open session */
+{
+	
+	for ( ; (quantity > 0) && I2C_Session.Open && !I2C_Session.Error ; quantity-- ) /* Loop for write data to device */
+	{
+		
+		if ( I2C_Transmit( *data , time_out ) != _MT_DATA_TRANSMITTED_ACK ) /* DATA has not been acknowledged */
+		{
+			I2C_Session.Error = _TRUE; /* Set error */
+		}
+		else{}
+		
+		data++; /* Select next byte */
+		
+	}
+	
+	return ( (I2C_Session.Open && !I2C_Session.Error) ? _STAT_OK : _STAT_ERROR );
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					data : Pointer to data buffer.
+					quantity : Amount of data to be sent.
+					time_out : Timeout duration.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR
+	
+	Example       :
+					com_stat = I2C_Session_Write(my_data , 64 , 100);
+			
+*/
+
+StatusTypeDef I2C_Session_End(uint16_t time_out) /* This function is for stop the write session */
+{
+	
+	if ( !I2C_Session.Open ) /* No session */
+	{
+		return _STAT_OK;
+	}
+	else{}
+	
+	I2C_EndTransmission(time_out); /* End Transmission */
+	I2C_Session.Open = _FALSE;
+	
+	/* --------------------------------- */
+	
+	if ( I2C_Session.Error ) /* A step failed */
+	{
+		I2C_Untrust(I2C_Session.DevAddress); /* Probe again next time */
+		return _STAT_ERROR;
+	}
+	else{}
+	
+	return _STAT_OK;
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					time_out : Timeout duration.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR (a step of the session failed)
+	
+	Example       :
+					com_stat = I2C_Session_End(100);
+			
+*/
+
+StatusTypeDef I2C_Mem_WriteV(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , const I2C_SegmentTypeDef *segments , uint8_t count , uint16_t time_out) /* This function is for write data segments to external memory in one transaction */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint8_t i2c_status; /* Variable for check status */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	i2c_status = I2C_Session_Begin(dev_address , mem_address , mem_add_size , time_out); /* START, SLA+W, memory address */
+	
+	for ( ; (count > 0) && (i2c_status == _STAT_OK) ; count-- ) /* Segments follow without repeated START */
+	{
+		
+		i2c_status = I2C_Session_Write(segments->Data , segments->Size , time_out); /* Send segment */
+		segments++; /* Select next segment */
+		
+	}
+	
+	if ( I2C_Session_End(time_out) != _STAT_OK ) /* STOP */
+	{
+		i2c_status = _STAT_ERROR;
+	}
+	else{}
+	
+	return i2c_status;
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					dev_address : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+
+					mem_address : Internal memory address.
+					
+					mem_add_size : Size of internal memory address. this
+								   parameter is :
+												 _I2C_MEMADD_SIZE_8BIT
+												 _I2C_MEMADD_SIZE_16BIT
+					
+					segments : Pointer to array of data segments.
+					count : Number of segments.
+					time_out : Timeout duration.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR
+	
+	Example       :
+					uint8_t com_stat;
+					I2C_SegmentTypeDef my_segments[2] = {{my_header , 4} , {my_data , 20}};
+					
+					com_stat = I2C_Mem_WriteV(0xA0 , 75 , _I2C_MEMADD_SIZE_16BIT , my_segments , 2 , 100); (0xA0 : Device Address)
+			
+*/
+
+void I2C_SetTrustedDevice(uint8_t dev_address , uint8_t enable) /* This function is for skip the ready probe of a known device */
+{
+	
+	I2C_Trust.DevAddress = dev_address;
+	I2C_Trust.Enable = enable;
+	I2C_Trust.Verified = _FALSE; /* Probe once */
+	
+}
+/*
+	Parameters    :
+					dev_address : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+					
+					enable : _TRUE / _FALSE
+	
+	Return Values :
+	
+	Example       :
+					I2C_SetTrustedDevice(0x78 , _TRUE);
+					
+					I2C_Mem_Write and I2C_Session_Begin probe the device once,
+					then again only after a failed transfer.
+			
+*/
+
+void I2C_GetStats(I2C_StatsTypeDef *stats) /* This function is for take wait statistics */
+{
+	
+	*stats = I2C_Stats; /* Copy statistics */
+	
+}
+/*
+	Parameters    :
+					stats : Pointer to a I2C_StatsTypeDef structure for copy statistics.
+	
+	Return Values :
+	
+	Example       :
+					I2C_StatsTypeDef my_stats;
+					
+					I2C_GetStats(&my_stats);
+			
+*/
+
+void I2C_ResetStats(void) /* This function is for reset wait statistics */
+{
+	
+	I2C_Stats.Transfers    = 0;
+	I2C_Stats.Timeouts     = 0;
+	I2C_Stats.MaxWaitUs    = 0;
+	I2C_Stats.LastWaitUs   = 0;
+	I2C_Stats.LastTimeouts = 0;
+	
+}
+/*
+	Parameters    :
+	
+	Return Values :
+	
+	Example       :
+					I2C_ResetStats();
+			
+*/
+
+#ifdef _I2C_INTERRUPT_MODE
+
+StatusTypeDef I2C_Mem_Write_IT(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , const uint8_t *mem_data , uint16_t quantity) /* This function is for queue a write to external memory */
+{
+	
+	return I2C_IT_Enqueue(dev_address , mem_address , mem_add_size , mem_data , quantity , _FALSE); /* Queue by reference */
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					dev_address : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+
+					mem_address : Internal memory address.
+					
+					mem_add_size : Size of internal memory address. this
+								   parameter is :
+												 _I2C_MEMADD_SIZE_8BIT
+												 _I2C_MEMADD_SIZE_16BIT
+					
+					mem_data : Pointer to data buffer, must stay valid
+							   until I2C_IT_Wait returns.
+					quantity : Amount of data to be sent.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR (queue is full)
+	
+	Example       :
+					uint8_t com_stat;
+					static uint8_t my_data[21] = "I AM Microcontroller";
+					
+					com_stat = I2C_Mem_Write_IT(0xA0 , 75 , _I2C_MEMADD_SIZE_16BIT , my_data , 20); (0xA0 : Device Address)
+			
+*/
+
+StatusTypeDef I2C_IT_Wait(uint16_t time_out) /* This function is for wait until queued transfers are done */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint8_t i2c_status = I2C_IT_Idle(time_out); /* Wait for the queue */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	if ( I2C_Queue.Error ) /* A queued transfer failed */
+	{
+		I2C_Queue.Error = _FALSE; /* Reset error */
+		i2c_status = _STAT_ERROR; /* Set status */
+	}
+	else{}
+	
+	return i2c_status;
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					time_out : Timeout duration.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR (a queued transfer failed or timeout)
+	
+	Example       :
+					uint8_t com_stat;
+					
+					com_stat = I2C_IT_Wait(100);
+			
+*/
+
+uint8_t I2C_IT_IsBusy(void) /* This function is for check the TWI interrupt is working */
+{
+	
+	return I2C_Queue.Busy;
+	
+}
+/*
+	Parameters    :
+	
+	Return Values :
+					_TRUE / _FALSE
+	
+	Example       :
+					while (I2C_IT_IsBusy());
+			
+*/
+
+void I2C_IT_Handler(void) /* TWI interrupt handler */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	I2C_TransferTypeDef *transfer = &I2C_Queue.Transfer[I2C_Queue.Head]; /* Current transfer */
+	uint16_t data_step = 0; /* Step of the data bytes */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	switch ( I2C_Status() )
+	{
+		
+		case _MT_START_TRANSMITTED: /* START condition has been transmitted */
+		case _MT_REP_START_TRANSMITTED: /* A repeated START condition has been transmitted */
+		{
+			
+			I2C_Queue.Step = 0; /* Reset step */
+			_I2C_DR = transfer->DevAddress; /* Send Device Address */
+			_I2C_CR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE); /* Start transmission */
+			
+		}
+		break;
+		
+		case _MT_SLA_W_TRANSMITTED_ACK: /* SLA+W has been transmitted, and ACK has been received. */
+		case _MT_DATA_TRANSMITTED_ACK: /* DATA has been transmitted, and ACK has been received. */
+		{
+			
+			if ( I2C_Queue.Step < transfer->MemAddSize ) /* Memory address */
+			{
+				_I2C_DR = transfer->MemAddress[I2C_Queue.Step]; /* Send memory Address */
+			}
+			else
+			{
+				
+				data_step = I2C_Queue.Step - transfer->MemAddSize;
+				
+				if ( data_step >= transfer->Size ) /* Transfer is done */
+				{
+					I2C_IT_Next(); /* STOP and start next transfer */
+					break;
+				}
+				else{}
+				
+				_I2C_DR = transfer->Data[data_step]; /* Send data to memory */
+				
+			}
+			
+			I2C_Queue.Step++; /* The step is completed */
+			_I2C_CR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE); /* Start transmission */
+			
+		}
+		break;
+		
+		default: /* NACK, arbitration lost or bus error */
+		{
+			
+			I2C_Queue.Error = _TRUE; /* Set error */
+			I2C_IT_Next(); /* Drop transfer */
+			
+		}
+		break;
+		
+	}
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+	
+	Return Values :
+	
+	Example       :
+					Called by ISR(TWI_vect), call it directly on the host simulation.
+			
+*/
+
+#ifndef _I2C_HOST_SIM
+
+#ifdef __CODEVISIONAVR__ /* Check compiler */
+interrupt [TWI] void I2C_TWI_ISR(void) /* TWI interrupt */
+#else
+ISR(TWI_vect) /* TWI interrupt */
+#endif /* __CODEVISIONAVR__ */
+{
+	I2C_IT_Handler();
+}
+
+#endif /* _I2C_HOST_SIM */
+
+#endif /* _I2C_INTERRUPT_MODE */
+
+/* --------------- Static Functions -------------- */
+
+static uint8_t I2C_WaitFlag(uint8_t flag , uint8_t state , uint16_t time_out) /* Spin until the control register flag equals state */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint32_t budget = (uint32_t)time_out * (_US_PER_MS / _I2C_WAIT_STEP_US); /* Number of polls */
+	uint32_t spent = 0; /* Polls done */
+	uint32_t wait_us; /* Spent time */
+	uint8_t i2c_status = _STAT_OK; /* Variable for check status */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	while ( ((_I2C_CR & (1 << flag)) ? _TRUE : _FALSE) != state ) /* Flag is not ready */
+	{
+		
+		if ( spent >= budget ) /* Deadline */
+		{
+			i2c_status = _STAT_ERROR;
+			break;
+		}
+		else{}
+		
+		_DELAY_US(_I2C_WAIT_STEP_US);
+		spent++;
+		
+	}
+	
+	/* --------------- Statistics -------------- */
+	
+	wait_us = spent * _I2C_WAIT_STEP_US;
+	
+	I2C_Stats.LastWaitUs += wait_us;
+	
+	if ( wait_us > I2C_Stats.MaxWaitUs ) /* Longest wait */
+	{
+		I2C_Stats.MaxWaitUs = wait_us;
+	}
+	else{}
+	
+	if ( i2c_status == _STAT_ERROR ) /* Timeout */
+	{
+		I2C_Stats.Timeouts++;
+		I2C_Stats.LastTimeouts++;
+	}
+	else{}
+	
+	return i2c_status;
+	
+	/* Function End */
+}
+
+static uint8_t I2C_Probe(uint8_t dev_address , uint16_t time_out) /* Ready probe, skipped for a verified trusted device */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint8_t trusted = ( I2C_Trust.Enable && (I2C_Trust.DevAddress == dev_address) ); /* Device is trusted */
+	uint8_t i2c_status; /* Variable for check status */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	if ( trusted && I2C_Trust.Verified ) /* Already probed */
+	{
+		return _TRUE;
+	}
+	else{}
+	
+	i2c_status = I2C_IsDeviceReady(dev_address , 1 , time_out); /* Probe device */
+	
+	if ( trusted ) /* Remember result */
+	{
+		I2C_Trust.Verified = i2c_status;
+	}
+	else{}
+	
+	return i2c_status;
+	
+}
+
+static void I2C_Untrust(uint8_t dev_address) /* Probe the device again on next transfer */
+{
+	
+	if ( I2C_Trust.DevAddress == dev_address )
+	{
+		I2C_Trust.Verified = _FALSE;
+	}
+	else{}
+	
+}
+
+static void I2C_ApplyClock(uint8_t pre_code , uint8_t bit_rate) /* Keep the clock for I2C_Init and set it on a running TWI */
+{
+	
+	I2C_PreCode = pre_code;
+	I2C_BitRate = bit_rate;
+	
+	if ( (_I2C_CR & (1 << TWEN)) != 0 ) /* TWI is enabled */
+	{
+		_I2C_SR = pre_code;
+		_I2C_BR = bit_rate;
+	}
+	else{}
+	
+}
+
+static StatusTypeDef I2C_Mem_WaitWriteCycle(uint8_t dev_address , uint16_t time_out) /* ACK polling, the memory answers again after its write cycle */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint32_t poll_us = ( (_I2C_POLL_BITS * 1000000UL) / I2C_GetClock() ) + _I2C_WAIT_STEP_US; /* Bus time of one poll */
+	uint32_t waited_us = 0; /* Time since the STOP of the write */
+	uint8_t i2c_status; /* Variable for check status */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^ Wait for interrupt ^^^^^^^^^^^^^^^^^^^ */
+	
+	#ifdef _I2C_INTERRUPT_MODE
+	I2C_IT_Idle(time_out); /* Write may still be queued */
+	#endif /* _I2C_INTERRUPT_MODE */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	for (;;)
+	{
+		
+		i2c_status = I2C_BeginTransmission(time_out); /* Begin Transmission */
+		
+		if ( i2c_status == _MT_START_TRANSMITTED ) /* START condition has been transmitted */
+		{
+			i2c_status = I2C_Transmit(dev_address , time_out); /* Send Device Address */
+		}
+		else{}
+		
+		I2C_EndTransmission(time_out); /* End Transmission */
+		
+		/* --------------------------------- */
+		
+		if ( i2c_status == _MT_SLA_W_TRANSMITTED_ACK ) /* Write cycle is done */
+		{
+			return _STAT_OK;
+		}
+		else if ( waited_us >= ((uint32_t)_MEM_WRITE_CYCLE_MS * _US_PER_MS) ) /* Longer than the worst case write cycle */
+		{
+			return _STAT_ERROR;
+		}
+		else{}
+		
+		_DELAY_US(_I2C_WAIT_STEP_US);
+		waited_us += poll_us;
+		
+	}
+	
+}
+
+static StatusTypeDef I2C_Mem_FillPage(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , uint32_t quantity , uint16_t time_out) /* Write _MEMORY_DEF_VAL bytes in one transaction */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint8_t i2c_status = 0; /* Variable for check status */
+	uint32_t write_quantity = quantity; /* Variable for check write quantity */
+	uint32_t step_check = 0; /* Variable to check the completed steps */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	if ( I2C_IsDeviceReady(dev_address , 1 , time_out) == _TRUE ) /* target device is ready */
+	{
+		
+		i2c_status = I2C_BeginTransmission(time_out); /* Begin Transmission */
+		
+		/* --------------------------------- */
+		
+		if ( mem_add_size == _I2C_MEMADD_SIZE_8BIT ) /* Check memory address size */
+		{
+			
+			if ( i2c_status == _MT_START_TRANSMITTED ) /* START condition has been transmitted */
+			{
+				i2c_status = I2C_Transmit( (dev_address | (uint8_t)((mem_address >> _P0_SHIFT_VAL_MEMADD_SIZE_8BIT) & _P0_BIT_SEL_MEMADD_SIZE_8BIT)) , time_out); /* Send Device Address */
+				step_check++; /* The step is completed */
+			}
+			else{}
+			
+			/* ~~~~~~~~~~~~ Send LSB Memory Address ~~~~~~~~~~~~ */
+			
+			if ( i2c_status == _MT_SLA_W_TRANSMITTED_ACK ) /* Data has been transmitted, and ACK has been received. */
+			{
+				i2c_status = I2C_Transmit( (uint8_t)mem_address , time_out ); /* Send second memory Address */
+				step_check++; /* The step is completed */
+			}
+			else{}
+			
+		}
+		else
+		{
+			
+			if ( i2c_status == _MT_START_TRANSMITTED ) /* START condition has been transmitted */
+			{
+				i2c_status = I2C_Transmit( (dev_address | (uint8_t)((mem_address >> _P0_SHIFT_VAL_MEMADD_SIZE_16BIT) & _P0_BIT_SEL_MEMADD_SIZE_16BIT)) , time_out); /* Send Device Address */
+				step_check++; /* The step is completed */
+			}
+			else{}
+			
+			/* ~~~~~~~~~~~~ Send MSB Memory Address ~~~~~~~~~~~~ */
+			
+			if ( i2c_status == _MT_SLA_W_TRANSMITTED_ACK ) /* SLA+W has been transmitted, and ACK has been received. */
+			{
+				i2c_status = I2C_Transmit( (uint8_t)(mem_address >> _BYTE_SHIFT_VAL) , time_out); /* Send first memory Address */
+				step_check++; /* The step is completed */
+			}
+			else{}
+			
+			/* ~~~~~~~~~~~~ Send LSB Memory Address ~~~~~~~~~~~~ */
+			
+			if ( i2c_status == _MT_DATA_TRANSMITTED_ACK ) /* Data has been transmitted, and ACK has been received. */
+			{
+				i2c_status = I2C_Transmit( (uint8_t)mem_address , time_out ); /* Send second memory Address */
+				step_check++; /* The step is completed */
+			}
+			else{}
+			
+		}
+		
+		/* --------------------------------- */
+		
+		for ( ; quantity > 0 ; quantity-- ) /* Loop for write data to memory */
+		{
+			
+			if ( i2c_status == _MT_DATA_TRANSMITTED_ACK ) /* DATA has been transmitted, and ACK has been received. */
+			{
+				
+				i2c_status = I2C_Transmit( _MEMORY_DEF_VAL , time_out ); /* Send data to memory */
+				step_check++; /* The step is completed */
+				
+			}
+			else{}
+			
+		}
+		
+		/* --------------------------------- */
+		
+		if ( i2c_status == _MT_DATA_TRANSMITTED_ACK ) /* DATA has been transmitted, and ACK has been received. */
+		{
+			I2C_EndTransmission(time_out); /* End Transmission */
+			step_check++; /* The step is completed */
+		}
+		else{}
+		
+		/* --------------------------------- */
+		
+		if ( (mem_add_size == _I2C_MEMADD_SIZE_8BIT) && (step_check == ((_MEMORY_BURST_WRITE_STEPS - 1) + write_quantity)) ) /* The steps are complete */
+		{
+			i2c_status = _STAT_OK; /* Set status */
+		}
+		else if ( (mem_add_size == _I2C_MEMADD_SIZE_16BIT) && (step_check == (_MEMORY_BURST_WRITE_STEPS + write_quantity)) ) /* The steps are complete */
+		{
+			i2c_status = _STAT_OK; /* Set status */
+		}
+		else
+		{
+			i2c_status = _STAT_ERROR; /* Set status */
+		}
+		
+	}
+	else
+	{
+		i2c_status = _STAT_ERROR; /* Set status */
+	}
+	
+	return i2c_status;
+	
+	/* Function End */
+}
+
+#ifdef _I2C_INTERRUPT_MODE
+
+static StatusTypeDef I2C_IT_Enqueue(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , const uint8_t *mem_data , uint16_t quantity , uint8_t copy) /* Add transfer to the queue */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	I2C_TransferTypeDef *transfer; /* Queue slot */
+	uint16_t counter = 0; /* Variable for copy data */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	if ( I2C_Queue.Count >= _I2C_IT_QUEUE_SIZE ) /* Queue is full */
+	{
+		return _STAT_ERROR;
+	}
+	else{}
+	
+	transfer = &I2C_Queue.Transfer[I2C_Queue.Tail]; /* Select slot */
+	
+	/* --------------------------------- */
+	
+	if ( mem_add_size == _I2C_MEMADD_SIZE_8BIT ) /* Check memory address size */
+	{
+		
+		transfer->DevAddress    = (dev_address | (uint8_t)((mem_address >> _P0_SHIFT_VAL_MEMADD_SIZE_8BIT) & _P0_BIT_SEL_MEMADD_SIZE_8BIT)); /* Device Address */
+		transfer->MemAddress[0] = (uint8_t)mem_address; /* LSB Memory Address */
+		transfer->MemAddSize    = 1;
+		
+	}
+	else
+	{
+		
+		transfer->DevAddress    = (dev_address | (uint8_t)((mem_address >> _P0_SHIFT_VAL_MEMADD_SIZE_16BIT) & _P0_BIT_SEL_MEMADD_SIZE_16BIT)); /* Device Address */
+		transfer->MemAddress[0] = (uint8_t)(mem_address >> _BYTE_SHIFT_VAL); /* MSB Memory Address */
+		transfer->MemAddress[1] = (uint8_t)mem_address; /* LSB Memory Address */
+		transfer->MemAddSize    = 2;
+		
+	}
+	
+	/* --------------------------------- */
+	
+	if ( copy ) /* Data is copied into the slot */
+	{
+		
+		for ( ; counter < quantity ; counter++ )
+		{
+			transfer->Inline[counter] = mem_data[counter];
+		}
+		
+		transfer->Data = transfer->Inline;
+		
+	}
+	else
+	{
+		transfer->Data = mem_data;
+	}
+	
+	transfer->Size = quantity;
+	
+	/* --------------------------------- */
+	
+	I2C_Queue.Tail = (I2C_Queue.Tail + 1) % _I2C_IT_QUEUE_SIZE; /* Next slot */
+	
+	I2C_IT_Start(); /* Hand over to the interrupt */
+	
+	return _STAT_OK;
+	
+	/* Function End */
+}
+
+static StatusTypeDef I2C_IT_Write(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , const uint8_t *mem_data , uint32_t quantity , uint16_t time_out) /* I2C_Mem_Write in interrupt mode */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint8_t copy = ( quantity <= _I2C_IT_INLINE_LENGTH ); /* Small writes are copied */
+	uint32_t budget = (uint32_t)time_out * (_US_PER_MS / _I2C_WAIT_STEP_US); /* Number of polls */
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	if ( quantity > UINT16_MAX ) /* Too long for one transfer */
+	{
+		return _STAT_ERROR;
+	}
+	else{}
+	
+	while ( (I2C_Queue.Count >= _I2C_IT_QUEUE_SIZE) && (budget > 0) ) /* Wait for a free slot */
+	{
+		_DELAY_US(_I2C_WAIT_STEP_US);
+		budget--;
+	}
+	
+	/* --------------------------------- */
+	
+	if ( I2C_IT_Enqueue(dev_address , mem_address , mem_add_size , mem_data , (uint16_t)quantity , copy) != _STAT_OK ) /* Queue is still full */
+	{
+		return _STAT_ERROR;
+	}
+	else{}
+	
+	if ( copy ) /* Caller's buffer is free */
+	{
+		return _STAT_OK;
+	}
+	else{}
+	
+	return I2C_IT_Wait(time_out); /* Buffer is used until sent */
+	
+	/* Function End */
+}
+
+static StatusTypeDef I2C_IT_Idle(uint16_t time_out) /* Wait until queue is empty */
+{
+	
+	uint32_t budget = (uint32_t)time_out * (_US_PER_MS / _I2C_WAIT_STEP_US); /* Number of polls */
+	
+	while ( I2C_Queue.Busy && (budget > 0) ) /* Wait for the interrupt */
+	{
+		_DELAY_US(_I2C_WAIT_STEP_US);
+		budget--;
+	}
+	
+	return ( I2C_Queue.Busy ? _STAT_ERROR : _STAT_OK );
+	
+}
+
+static void I2C_IT_Start(void) /* Count the new transfer and start the bus if idle */
+{
+	
+	_I2C_ENTER_CRITICAL();
+	
+	I2C_Queue.Count++; /* New transfer */
+	
+	if ( !I2C_Queue.Busy ) /* Interrupt is idle */
+	{
+		I2C_Queue.Busy = _TRUE;
+		_I2C_CR = (1 << TWINT) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE); /* Send START condition */
+	}
+	else{}
+	
+	_I2C_EXIT_CRITICAL();
+	
+}
+
+static void I2C_IT_Next(void) /* Finish current transfer */
+{
+	
+	I2C_Queue.Head = (I2C_Queue.Head + 1) % _I2C_IT_QUEUE_SIZE; /* Next slot */
+	I2C_Queue.Count--;
+	
+	if ( I2C_Queue.Count > 0 ) /* More transfers */
+	{
+		_I2C_CR = (1 << TWINT) | (1 << TWSTO) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE); /* STOP followed by START */
+	}
+	else
+	{
+		_I2C_CR = (1 << TWINT) | (1 << TWSTO) | (1 << TWEN); /* Transmit STOP condition */
+		I2C_Queue.Busy = _FALSE;
+	}
+	
+}
+
+#endif /* _I2C_INTERRUPT_MODE */
+
 /* Program End */
@@ -22,6 +22,27 @@
 				  Add : I2C_Mem_Erase         function for erase external i2c memory.
 				  
 				  Add : time_out for exit from instruction.
+				  
+				  Add : I2C_Mem_Write_IT      function for queue a write for the TWI interrupt.
+				  Add : I2C_IT_Wait           function for wait until queued transfers are done.
+				  Add : _I2C_INTERRUPT_MODE   I2C_Mem_Write queues its transfer and returns.
+				  Add : _I2C_HOST_SIM         registers are redirected to a simulated block.
+				  
+				  Add : us step for flag waits instead of 1 ms.
+				  Add : I2C_GetStats          function for take wait/timeout statistics.
+				  Add : I2C_ResetStats        function for reset statistics.
+				  
+				  Add : I2C_Session_Begin/Write/End functions for stream data under one START.
+				  Add : I2C_SetTrustedDevice  function for probe a device only once or after an error.
+				  Add : I2C_Mem_WriteV        function for write data segments in one transaction.
+				  
+				  Add : I2C_SetClock          function for set the SCL frequency at run time.
+				  Add : I2C_GetClock          function for take the SCL frequency.
+				  Add : I2C_TuneClock         function for step the clock up while a device keeps up.
+				  Fix : TWSR takes the prescaler code instead of the prescaler value.
+				  
+				  Add : I2C_Mem_WritePages    function for write data page by page with ACK polling.
+				  Mod : I2C_Mem_Erase         writes page by page and waits each write cycle by ACK polling.
 ------------------------------------------------------------------------------
 */
 
@@ -36,7 +57,13 @@
 
 /*----------------------------------------------------------*/
 
-#ifdef __CODEVISIONAVR__  /* Check compiler */
+#ifdef _I2C_HOST_SIM  /* Check host simulation */
+
+#include "i2c_unit_sim.h"  /* Import simulated TWI registers */
+
+/*----------------------------------------------------------*/
+
+#elif defined(__CODEVISIONAVR__)  /* Check compiler */
 
 #pragma warn_unref_func- /* Disable 'unused function' warning */
 
@@ -50,6 +77,7 @@
 #pragma GCC diagnostic ignored "-Wunused-function" /* Disable 'unused function' warning */
 
 #include <avr/io.h>        /* Import AVR IO library */
+#include <avr/interrupt.h> /* Import AVR interrupt library */
 #include <util/delay.h>    /* Import delay library */
 
 /*----------------------------------------------------------*/
@@ -80,6 +108,19 @@
 		
 	#endif /* _DELAY_MS */
 	
+	#ifndef _DELAY_US
+		
+		#define _DELAY_US(x)    delay_us(x)
+		
+	#endif /* _DELAY_US */
+	
+	#ifndef _I2C_ENTER_CRITICAL
+		
+		#define _I2C_ENTER_CRITICAL()  uint8_t i2c_sreg = SREG; SREG = i2c_sreg & 0x7F /* Save and clear I flag */
+		#define _I2C_EXIT_CRITICAL()   SREG = i2c_sreg /* Restore interrupts */
+		
+	#endif /* _I2C_ENTER_CRITICAL */
+	
 #elif defined(__GNUC__) /* Check compiler */
 
 	#define _F_CPU F_CPU /* Define CPU clock */
@@ -89,6 +130,19 @@
 		#define _DELAY_MS(x)    _delay_ms(x)
 		
 	#endif /* _DELAY_MS */
+	
+	#ifndef _DELAY_US
+		
+		#define _DELAY_US(x)    _delay_us(x)
+		
+	#endif /* _DELAY_US */
+	
+	#ifndef _I2C_ENTER_CRITICAL
+		
+		#define _I2C_ENTER_CRITICAL()  uint8_t i2c_sreg = SREG; cli() /* Save and disable interrupts */
+		#define _I2C_EXIT_CRITICAL()   SREG = i2c_sreg /* Restore interrupts */
+		
+	#endif /* _I2C_ENTER_CRITICAL */
 
 #endif /* __CODEVISIONAVR__ */
 
@@ -132,6 +186,18 @@
 #define _P0_SHIFT_VAL_MEMADD_SIZE_16BIT  15   /* Value for memory address shift */
 #define _P0_BIT_SEL_MEMADD_SIZE_16BIT    0x02 /* Value for check P0 addressing bit in 16bit memory address mode */
 
+#ifndef _MEM_PAGE_SIZE
+	#define _MEM_PAGE_SIZE               8    /* Smallest page of the 24Cxx family */
+#endif
+
+#ifndef _MEM_WRITE_CYCLE_MS
+	#define _MEM_WRITE_CYCLE_MS          10   /* Longest ACK polling after a page write */
+#endif
+
+#define _I2C_POLL_BITS                   20   /* SCL periods of START, SLA+W, ACK and STOP */
+
+#define _CALC_PAGE_REST(mem_add)         (_MEM_PAGE_SIZE - ((mem_add) % _MEM_PAGE_SIZE)) /* Bytes up to the end of the page */
+
 /* --------------------------------- I2C --------------------------------- */
 
 #define _I2C_DIS                     0    /* Disable value for reset register */
@@ -140,11 +206,51 @@
 
 /* Define Registers */
 
-#define _I2C_SR TWSR /* I2C Status Register */
-#define _I2C_DR TWDR /* I2C Data Register */
-#define _I2C_CR TWCR /* I2C Control Register */
-#define _I2C_AR TWAR /* I2C Address Register */
-#define _I2C_BR TWBR /* I2C BaudRate Register */
+#ifndef _I2C_SR
+	#define _I2C_SR TWSR /* I2C Status Register */
+#endif
+
+#ifndef _I2C_DR
+	#define _I2C_DR TWDR /* I2C Data Register */
+#endif
+
+#ifndef _I2C_CR
+	#define _I2C_CR TWCR /* I2C Control Register */
+#endif
+
+#ifndef _I2C_AR
+	#define _I2C_AR TWAR /* I2C Address Register */
+#endif
+
+#ifndef _I2C_BR
+	#define _I2C_BR TWBR /* I2C BaudRate Register */
+#endif
+
+/* -------------------------------- Clock -------------------------------- */
+
+#define _I2C_SCL_STANDARD            100000UL  /* Standard mode */
+#define _I2C_SCL_FAST                400000UL  /* Fast mode */
+#define _I2C_SCL_FAST_PLUS           1000000UL /* Fast mode plus (overclocked TWI) */
+
+#define _I2C_SCL_DIV_MIN             16   /* SCL = F_CPU / (16 + 2 * TWBR * Prescaler) */
+#define _I2C_BR_MAX                  0xFF /* Largest TWBR value */
+#define _I2C_PRE_CODES               4    /* Prescaler codes 0..3 = 1, 4, 16, 64 */
+
+#ifndef _I2C_TUNE_TRIALS
+	#define _I2C_TUNE_TRIALS         8    /* Clean probes and writes a clock must pass */
+#endif
+
+/* ------------------------------ Interrupt ------------------------------ */
+
+#ifndef _I2C_IT_QUEUE_SIZE
+	#define _I2C_IT_QUEUE_SIZE       4  /* Number of queued transfers */
+#endif
+
+#ifndef _I2C_IT_INLINE_LENGTH
+	#define _I2C_IT_INLINE_LENGTH    16 /* Writes up to this length are copied into the queue */
+#endif
+
+#define _I2C_IT_MEM_ADD_MAX          2  /* Bytes of memory address */
 
 /* -------------------------------- Public ------------------------------- */
 
@@ -153,6 +259,11 @@
 #define _MIN_STEP_FOR_DR             6    /* Minimum steps of receive data from device */
 #define _MEMORY_BURST_WRITE_STEPS    4    /* Number of burst write step */
 #define _MEMORY_BURST_READ_STEPS     6    /* Number of burst write step */
+#define _US_PER_MS                   1000 /* Microseconds per time_out unit */
+
+#ifndef _I2C_WAIT_STEP_US
+	#define _I2C_WAIT_STEP_US        1    /* Delay between flag polls */
+#endif
 
 #ifndef _FALSE
 	#define _FALSE 0 /* False value */
@@ -216,6 +327,9 @@ typedef enum /* Enum Status Codes for Slave Transmitter Mode */
 	
 }ENUM_U8_T(I2C_Status_ST_TypeDef);
 
+#ifndef __STATUS_TYPEDEF_ /* Shared with spi_unit */
+#define __STATUS_TYPEDEF_
+
 typedef enum /* Enum Status Codes */
 {
 	
@@ -224,6 +338,72 @@ typedef enum /* Enum Status Codes */
 	
 }ENUM_U8_T(StatusTypeDef);
 
+#endif /* __STATUS_TYPEDEF_ */
+
+/*************************************** Struct ****************************************/
+
+typedef struct /* Wait statistics */
+{
+	
+	uint32_t Transfers;    /* Transfers since reset */
+	uint32_t Timeouts;     /* Flag waits that reached time_out */
+	uint32_t MaxWaitUs;    /* Longest single flag wait */
+	uint32_t LastWaitUs;   /* Time spent waiting in the last transfer */
+	uint16_t LastTimeouts; /* Timeouts in the last transfer */
+	
+}I2C_StatsTypeDef;
+
+typedef struct /* Data segment */
+{
+	
+	const uint8_t *Data;
+	uint16_t       Size;
+	
+}I2C_SegmentTypeDef;
+
+typedef struct /* Write session */
+{
+	
+	uint8_t DevAddress;
+	uint8_t Open;  /* START has been sent */
+	uint8_t Error; /* A step of the session failed */
+	
+}I2C_SessionTypeDef;
+
+typedef struct /* Trusted device */
+{
+	
+	uint8_t DevAddress;
+	uint8_t Enable;
+	uint8_t Verified; /* Probe succeeded and no error since */
+	
+}I2C_TrustTypeDef;
+
+typedef struct /* Queued transfer */
+{
+	
+	uint8_t        DevAddress;
+	uint8_t        MemAddress[_I2C_IT_MEM_ADD_MAX];
+	uint8_t        MemAddSize; /* Bytes of memory address */
+	const uint8_t *Data;
+	uint16_t       Size;
+	uint8_t        Inline[_I2C_IT_INLINE_LENGTH];
+	
+}I2C_TransferTypeDef;
+
+typedef struct /* Transfer queue of the TWI interrupt */
+{
+	
+	I2C_TransferTypeDef Transfer[_I2C_IT_QUEUE_SIZE];
+	uint8_t             Head;
+	uint8_t             Tail;
+	volatile uint8_t    Count;
+	volatile uint8_t    Busy;  /* TWI is owned by the interrupt */
+	volatile uint8_t    Error; /* A queued transfer failed */
+	uint16_t            Step;  /* Bytes sent from the current transfer */
+	
+}I2C_QueueTypeDef;
+
 /************************************** Prototype **************************************/
 
 uint8_t I2C_Status(void); /* Function for take I2C status */
@@ -347,6 +527,63 @@ void I2C_DeInit(void); /* This Function is for DeInitialize the I2C peripheral.
 			
 */
 
+StatusTypeDef I2C_SetClock(uint32_t f_scl); /* This function is for set the SCL frequency */
+/*
+	Parameters    :
+					f_scl : SCL frequency (Hz), the nearest setting at or
+							below it is used. Kept by I2C_Init, call it
+							while the bus is idle.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR (above F_CPU / 16 or below
+					the slowest prescaler)
+	
+	Example       :
+					I2C_SetClock(_I2C_SCL_FAST);
+			
+*/
+
+uint32_t I2C_GetClock(void); /* This function is for take the SCL frequency */
+/*
+	Parameters    :
+	
+	Return Values :
+					SCL frequency (Hz) of the current TWBR and prescaler.
+	
+	Example       :
+					uint32_t my_clock;
+					
+					my_clock = I2C_GetClock();
+			
+*/
+
+uint32_t I2C_TuneClock(uint8_t dev_address , uint32_t f_max , uint32_t f_step , uint8_t *test_data , uint16_t quantity , uint16_t time_out); /* This function is for find the fastest stable clock of a device */
+/*
+	Parameters    :
+					dev_address : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+					
+					f_max : Highest SCL frequency to try (Hz).
+					f_step : Increase of each step (Hz).
+					
+					test_data : Bytes written at every trial, must be
+								harmless to the device.
+					quantity : Amount of test data (0 = probe only).
+					time_out : Timeout duration.
+	
+	Return Values :
+					SCL frequency (Hz) that is kept: the fastest step that
+					passed _I2C_TUNE_TRIALS probes and writes in a row.
+	
+	Example       :
+					uint8_t my_nop[2] = {0x00 , 0xE3}; (SSD1306 NOP command)
+					
+					I2C_SetClock(_I2C_SCL_FAST);
+					I2C_TuneClock(0x78 , _I2C_SCL_FAST_PLUS , 100000UL , my_nop , 2 , 10);
+			
+*/
+
 uint8_t I2C_IsDeviceReady(uint8_t dev_address , uint16_t trials , uint16_t time_out); /* Checks if target device is ready for communication. */
 /*
 	Parameters    :
@@ -482,7 +719,124 @@ StatusTypeDef I2C_Mem_Erase(uint8_t dev_address , uint32_t mem_address , uint8_t
 												 _I2C_MEMADD_SIZE_8BIT
 												 _I2C_MEMADD_SIZE_16BIT
 					
-					quantity : Amount of data to be erase.
+					quantity : Amount of data to be erase, split at the
+							   _MEM_PAGE_SIZE boundaries.
+					time_out : Timeout duration.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR (NACK or write cycle longer
+					than _MEM_WRITE_CYCLE_MS)
+	
+	Example       :
+					uint8_t com_stat;
+					
+					com_stat = I2C_Mem_Erase(0xA0 , 0 , _I2C_MEMADD_SIZE_16BIT , 10 , 100); (0xA0 : Device Address)
+			
+*/
+
+StatusTypeDef I2C_Mem_WritePages(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , uint8_t *mem_data , uint32_t quantity , uint16_t time_out); /* This function is for write data to external memory page by page */
+/*
+	Parameters    :
+					dev_address : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+
+					mem_address : Internal memory address.
+					
+					mem_add_size : Size of internal memory address. this
+								   parameter is :
+												 _I2C_MEMADD_SIZE_8BIT
+												 _I2C_MEMADD_SIZE_16BIT
+					
+					mem_data : Pointer to data buffer.
+					quantity : Amount of data to be sent, split at the
+							   _MEM_PAGE_SIZE boundaries.
+					time_out : Timeout duration.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR (NACK or write cycle longer
+					than _MEM_WRITE_CYCLE_MS)
+	
+	Example       :
+					uint8_t com_stat;
+					
+					com_stat = I2C_Mem_WritePages(0xA0 , 0 , _I2C_MEMADD_SIZE_16BIT , my_splash , 1024 , 100); (0xA0 : Device Address)
+			
+*/
+
+StatusTypeDef I2C_Session_Begin(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , uint16_t time_out); /* This function is for start a write session */
+/*
+	Parameters    :
+					dev_address : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+
+					mem_address : Internal memory address (control byte).
+					
+					mem_add_size : Size of internal memory address. this
+								   parameter is :
+												 _I2C_MEMADD_SIZE_8BIT
+												 _I2C_MEMADD_SIZE_16BIT
+					
+					time_out : Timeout duration.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR
+	
+	Example       :
+					I2C_Session_Begin(0x78 , 0x40 , _I2C_MEMADD_SIZE_8BIT , 100);
+					I2C_Session_Write(my_data , 64 , 100);
+					I2C_Session_Write(my_data2 , 64 , 100);
+					com_stat = I2C_Session_End(100);
+					
+					I2C_Session_End must be called even if I2C_Session_Begin fails.
+			
+*/
+
+StatusTypeDef I2C_Session_Write(const uint8_t *data , uint32_t quantity , uint16_t time_out); /* This function is for send data in the open session */
+/*
+	Parameters    :
+					data : Pointer to data buffer.
+					quantity : Amount of data to be sent.
+					time_out : Timeout duration.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR
+	
+	Example       :
+					com_stat = I2C_Session_Write(my_data , 64 , 100);
+			
+*/
+
+StatusTypeDef I2C_Session_End(uint16_t time_out); /* This function is for stop the write session */
+/*
+	Parameters    :
+					time_out : Timeout duration.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR (a step of the session failed)
+	
+	Example       :
+					com_stat = I2C_Session_End(100);
+			
+*/
+
+StatusTypeDef I2C_Mem_WriteV(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , const I2C_SegmentTypeDef *segments , uint8_t count , uint16_t time_out); /* This function is for write data segments to external memory in one transaction */
+/*
+	Parameters    :
+					dev_address : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+
+					mem_address : Internal memory address.
+					
+					mem_add_size : Size of internal memory address. this
+								   parameter is :
+												 _I2C_MEMADD_SIZE_8BIT
+												 _I2C_MEMADD_SIZE_16BIT
+					
+					segments : Pointer to array of data segments.
+					count : Number of segments.
 					time_out : Timeout duration.
 	
 	Return Values :
@@ -490,9 +844,125 @@ StatusTypeDef I2C_Mem_Erase(uint8_t dev_address , uint32_t mem_address , uint8_t
 	
 	Example       :
 					uint8_t com_stat;
+					I2C_SegmentTypeDef my_segments[2] = {{my_header , 4} , {my_data , 20}};
 					
-					com_stat = I2C_Mem_Read(0xA0 , 0 , _I2C_MEMADD_SIZE_16BIT , 10 , 100); (0xA0 : Device Address)
+					com_stat = I2C_Mem_WriteV(0xA0 , 75 , _I2C_MEMADD_SIZE_16BIT , my_segments , 2 , 100); (0xA0 : Device Address)
 			
 */
 
+void I2C_SetTrustedDevice(uint8_t dev_address , uint8_t enable); /* This function is for skip the ready probe of a known device */
+/*
+	Parameters    :
+					dev_address : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+					
+					enable : _TRUE / _FALSE
+	
+	Return Values :
+	
+	Example       :
+					I2C_SetTrustedDevice(0x78 , _TRUE);
+					
+					I2C_Mem_Write and I2C_Session_Begin probe the device once,
+					then again only after a failed transfer.
+			
+*/
+
+void I2C_GetStats(I2C_StatsTypeDef *stats); /* This function is for take wait statistics */
+/*
+	Parameters    :
+					stats : Pointer to a I2C_StatsTypeDef structure for copy statistics.
+	
+	Return Values :
+	
+	Example       :
+					I2C_StatsTypeDef my_stats;
+					
+					I2C_GetStats(&my_stats);
+			
+*/
+
+void I2C_ResetStats(void); /* This function is for reset wait statistics */
+/*
+	Parameters    :
+	
+	Return Values :
+	
+	Example       :
+					I2C_ResetStats();
+			
+*/
+
+#ifdef _I2C_INTERRUPT_MODE
+
+StatusTypeDef I2C_Mem_Write_IT(uint8_t dev_address , uint32_t mem_address , uint8_t mem_add_size , const uint8_t *mem_data , uint16_t quantity); /* This function is for queue a write to external memory */
+/*
+	Parameters    :
+					dev_address : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+
+					mem_address : Internal memory address.
+					
+					mem_add_size : Size of internal memory address. this
+								   parameter is :
+												 _I2C_MEMADD_SIZE_8BIT
+												 _I2C_MEMADD_SIZE_16BIT
+					
+					mem_data : Pointer to data buffer, must stay valid
+							   until I2C_IT_Wait returns.
+					quantity : Amount of data to be sent.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR (queue is full)
+	
+	Example       :
+					uint8_t com_stat;
+					static uint8_t my_data[21] = "I AM Microcontroller";
+					
+					com_stat = I2C_Mem_Write_IT(0xA0 , 75 , _I2C_MEMADD_SIZE_16BIT , my_data , 20); (0xA0 : Device Address)
+			
+*/
+
+StatusTypeDef I2C_IT_Wait(uint16_t time_out); /* This function is for wait until queued transfers are done */
+/*
+	Parameters    :
+					time_out : Timeout duration.
+	
+	Return Values :
+					_STAT_OK / _STAT_ERROR (a queued transfer failed or timeout)
+	
+	Example       :
+					uint8_t com_stat;
+					
+					com_stat = I2C_IT_Wait(100);
+			
+*/
+
+uint8_t I2C_IT_IsBusy(void); /* This function is for check the TWI interrupt is working */
+/*
+	Parameters    :
+	
+	Return Values :
+					_TRUE / _FALSE
+	
+	Example       :
+					while (I2C_IT_IsBusy());
+			
+*/
+
+void I2C_IT_Handler(void); /* TWI interrupt handler */
+/*
+	Parameters    :
+	
+	Return Values :
+	
+	Example       :
+					Called by ISR(TWI_vect), call it directly on the host simulation.
+			
+*/
+
+#endif /* _I2C_INTERRUPT_MODE */
+
 #endif /* __I2C_UNIT_H_ */
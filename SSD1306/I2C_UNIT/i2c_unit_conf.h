@@ -33,13 +33,47 @@
 #define _F_SCL      100000UL 
 #define _PRESCALER  _PRE1 
 
+//#define _I2C_INTERRUPT_MODE
+//#define _I2C_IT_QUEUE_SIZE     4
+//#define _I2C_IT_INLINE_LENGTH  16
+
+//#define _I2C_WAIT_STEP_US      1
+
+//#define _I2C_TUNE_TRIALS       8
+
+//#define _MEM_PAGE_SIZE         8
+//#define _MEM_WRITE_CYCLE_MS    10
+
 /*
 	Guide :
-			_F_SCL	   : Specifies the clock frequency.
-						 This parameter must be set to a value lower than 400kHz
+			_F_SCL	   : Specifies the clock frequency of I2C_Init.
+						 I2C_SetClock and I2C_TuneClock change it at run time
+						 (400kHz and above, up to F_CPU / 16)
 			
 			_PRESCALER : i2c prescaler value argument is
 						 _PRE1 , _PRE4 , _PRE16 , _PRE64
+			
+			_I2C_TUNE_TRIALS      : Probes and test writes every step of
+									I2C_TuneClock must pass
+			
+			_MEM_PAGE_SIZE        : Write page of the memory (datasheet),
+									I2C_Mem_Erase and I2C_Mem_WritePages split
+									their writes at its boundaries
+			
+			_MEM_WRITE_CYCLE_MS   : Longest ACK polling for the self timed
+									write cycle after each page
+			
+			_I2C_WAIT_STEP_US     : Delay between polls of the TWI flags (us),
+									time_out stays in milliseconds
+			
+			_I2C_INTERRUPT_MODE   : I2C_Mem_Write is sent by the TWI interrupt,
+									global interrupts must be enabled
+			
+			_I2C_IT_QUEUE_SIZE    : Number of transfers waiting for the interrupt
+			
+			_I2C_IT_INLINE_LENGTH : Writes up to this length are copied and
+									I2C_Mem_Write returns at once, longer writes
+									wait until they are sent
 */
 
 /* ------------------------------------------------ */
@@ -0,0 +1,94 @@
+/*
+------------------------------------------------------------------------------
+~ File   : i2c_unit_sim.h
+~ Author : agent
+~ Version: V0.7.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+~ Description:    Simulated TWI registers for building i2c_unit on a host.
+
+~ Attention  :    Used when _I2C_HOST_SIM is defined. The host plays the
+				  bus: it sets I2C_Sim.SR and TWINT in I2C_Sim.CR, then
+				  calls I2C_IT_Handler. With _I2C_SIM_BUS the host does
+				  it in I2C_SimBus, called on every wait step.
+
+~ Changes    :
+				  Add : I2C_SimTypeDef        simulated TWI register block of the host.
+				  Add : I2C_SimBus            hook of the host, one bus event per wait step (_I2C_SIM_BUS).
+------------------------------------------------------------------------------
+*/
+
+#ifndef __I2C_UNIT_SIM_H_
+#define __I2C_UNIT_SIM_H_
+
+/*************************************** Include ***************************************/
+
+#include <stdint.h> /* Import standard integer type */
+
+/*************************************** Defines ***************************************/
+
+/* ------------------------------ Registers ------------------------------ */
+
+#define _I2C_SR I2C_Sim.SR /* I2C Status Register */
+#define _I2C_DR I2C_Sim.DR /* I2C Data Register */
+#define _I2C_CR I2C_Sim.CR /* I2C Control Register */
+#define _I2C_AR I2C_Sim.AR /* I2C Address Register */
+#define _I2C_BR I2C_Sim.BR /* I2C BaudRate Register */
+
+/* ------------------------------ TWCR Bits ------------------------------ */
+
+#define TWINT 7
+#define TWEA  6
+#define TWSTA 5
+#define TWSTO 4
+#define TWWC  3
+#define TWEN  2
+#define TWIE  0
+
+/* -------------------------------- Host --------------------------------- */
+
+#ifndef F_CPU
+	#define F_CPU 16000000UL /* Simulated CPU clock */
+#endif
+
+#ifndef _DELAY_MS
+	#define _DELAY_MS(x) /* No delay on host */
+#endif
+
+#ifdef _I2C_SIM_BUS
+	#define _DELAY_US(x) I2C_SimBus() /* The host bus moves while the driver waits */
+#elif !defined(_DELAY_US)
+	#define _DELAY_US(x) /* No delay on host */
+#endif
+
+#ifndef _I2C_ENTER_CRITICAL
+	#define _I2C_ENTER_CRITICAL() /* Handler is called by the host */
+	#define _I2C_EXIT_CRITICAL()
+#endif
+
+/*************************************** Struct ****************************************/
+
+typedef struct /* Simulated TWI register block */
+{
+	
+	volatile uint8_t SR;
+	volatile uint8_t DR;
+	volatile uint8_t CR;
+	volatile uint8_t AR;
+	volatile uint8_t BR;
+	
+}I2C_SimTypeDef;
+
+/************************************** Variables **************************************/
+
+extern I2C_SimTypeDef I2C_Sim;
+
+/************************************** Prototype **************************************/
+
+#ifdef _I2C_SIM_BUS
+void I2C_SimBus(void); /* Defined by the host, one bus event per call */
+#endif /* _I2C_SIM_BUS */
+
+#endif /* __I2C_UNIT_SIM_H_ */
@@ -0,0 +1,630 @@
+/*
+------------------------------------------------------------------------------
+~ File   : linux_i2c.c
+~ Author : agent
+~ Version: V0.1.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+~ Description:    Support Linux single board computers (i2c-dev).
+
+~ Attention  :    This module required the i2c-dev kernel driver (/dev/i2c-N).
+
+~ Changes    :
+				  Add : LINUX_I2C_Open / LINUX_I2C_Attach / LINUX_I2C_Close functions for open the adapter.
+				  Add : LINUX_I2C_Mem_Write   function for write data like HAL_I2C_Mem_Write2.
+				  Add : LINUX_I2C_Mem_WriteV  function for write data segments in one message.
+				  Add : LINUX_I2C_Session_xxx functions for queue messages without calling I2C_RDWR.
+				  Add : LINUX_I2C_Flush       function for send the queued messages.
+				  Add : _LINUX_I2C_HOST_SIM   stand-in adapter with a TCA9548A (linux_i2c_sim.h).
+
+------------------------------------------------------------------------------
+*/
+
+#include <string.h>     /* Import memcpy */
+#include <fcntl.h>      /* Import open */
+#include <unistd.h>     /* Import close, usleep */
+#include <sys/ioctl.h>  /* Import ioctl */
+
+#include "linux_i2c.h"
+
+/* ------------------ Variables ------------------ */
+
+#ifdef _LINUX_I2C_HOST_SIM
+LINUX_I2C_SimTypeDef LINUX_I2C_Sim = {_LINUX_I2C_SIM_MUX_ADDRESS , 0 , 0 , 0 , 0 , {{0 , 0 , 0 , 0}} , 0 , 0}; /* Stand-in adapter */
+#endif /* _LINUX_I2C_HOST_SIM */
+
+/* ------------------ Prototypes ----------------- */
+
+static int LINUX_I2C_Ioctl(int fd, unsigned long request, void *arg);
+static LINUX_I2C_StatusTypeDef LINUX_I2C_NewMsg(LINUX_I2C_HandleTypeDef *hi2c);
+static LINUX_I2C_StatusTypeDef LINUX_I2C_Transfer(LINUX_I2C_HandleTypeDef *hi2c);
+
+/* ------------------ Functions ------------------ */
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Open(LINUX_I2C_HandleTypeDef *hi2c, const char *Path) /* This function is for open the adapter */
+{
+
+	/* -------------------------------------------- */
+
+	unsigned long funcs = 0; /* Adapter functionality */
+	int fd; /* Descriptor */
+
+	/* -------------------------------------------- */
+
+	fd = open(Path , O_RDWR); /* Open device node */
+
+	if ( fd < 0 )
+	{
+		return LINUX_I2C_ERROR;
+	}
+
+	LINUX_I2C_Attach(hi2c , fd , LINUX_I2C_Ioctl); /* Initialize handle */
+
+	if ( (hi2c->Ioctl(fd , I2C_FUNCS , &funcs) < 0) || ((funcs & I2C_FUNC_I2C) == 0) ) /* I2C_RDWR needs plain I2C */
+	{
+
+		close(fd);
+		hi2c->Fd = -1;
+
+		return LINUX_I2C_ERROR;
+
+	}
+
+	return LINUX_I2C_OK;
+
+	/* Function End */
+}
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+					Path       : Device node of the adapter.
+
+	Return Values :
+					LINUX_I2C_OK / LINUX_I2C_ERROR (no node, or adapter without plain I2C)
+
+	Example       :
+					LINUX_I2C_HandleTypeDef hi2c1;
+
+					LINUX_I2C_Open(&hi2c1 , "/dev/i2c-1");
+
+*/
+
+void LINUX_I2C_Attach(LINUX_I2C_HandleTypeDef *hi2c, int Fd, LINUX_I2C_IoctlTypeDef Ioctl) /* This function is for initialize the handle with a descriptor and ioctl */
+{
+
+	hi2c->Fd         = Fd;
+	hi2c->Ioctl      = Ioctl;
+	hi2c->MaxMsgs    = _LINUX_I2C_MAX_MSGS;
+	hi2c->MaxMsgLen  = _LINUX_I2C_MAX_MSG_LEN;
+	hi2c->Retries    = _LINUX_I2C_RETRIES;
+
+	hi2c->Count      = 0;
+	hi2c->Used       = 0;
+	hi2c->Open       = 0;
+	hi2c->PrefixSize = 0;
+
+	hi2c->Transfers  = 0;
+	hi2c->Messages   = 0;
+	hi2c->RetryCount = 0;
+	hi2c->Errors     = 0;
+
+	/* Function End */
+}
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+					Fd         : Descriptor passed to Ioctl.
+					Ioctl      : ioctl of the adapter or an in-process stand-in.
+
+	Return Values :
+
+	Example       :
+					LINUX_I2C_Attach(&hi2c1 , -1 , my_ioctl);
+
+*/
+
+void LINUX_I2C_Close(LINUX_I2C_HandleTypeDef *hi2c) /* This function is for send the queue and close the adapter */
+{
+
+	LINUX_I2C_Flush(hi2c); /* Send the rest */
+
+	if ( hi2c->Fd >= 0 )
+	{
+		close(hi2c->Fd);
+	}
+
+	hi2c->Fd = -1;
+
+	/* Function End */
+}
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+
+	Return Values :
+
+	Example       :
+					LINUX_I2C_Close(&hi2c1);
+
+*/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Mem_Write(LINUX_I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout) /* This function is for write data to external memory */
+{
+
+	/* -------------------------------------------- */
+
+	LINUX_I2C_StatusTypeDef i2c_status; /* Create enum */
+
+	/* -------------------------------------------- */
+
+	i2c_status = LINUX_I2C_Session_Begin(hi2c , DevAddress , MemAddress , MemAddSize); /* New message */
+
+	if ( LINUX_I2C_Session_Write(hi2c , pData , Size) != LINUX_I2C_OK ) /* Queue data */
+	{
+		i2c_status = LINUX_I2C_ERROR;
+	}
+
+	LINUX_I2C_Session_End(hi2c);
+
+	if ( LINUX_I2C_Flush(hi2c) != LINUX_I2C_OK ) /* Send */
+	{
+		i2c_status = LINUX_I2C_ERROR;
+	}
+
+	(void)Timeout;
+
+	return i2c_status;
+
+	/* Function End */
+}
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+					DevAddress : Target device address (8-bit, like HAL).
+					MemAddress : Internal memory address.
+					MemAddSize : Size of internal memory address.
+					pData	   : Pointer to data buffer.
+					Size	   : Amount of data to be sent.
+					Timeout    : Unused, the adapter timeout applies.
+
+	Return Values :
+					LINUX_I2C_OK / LINUX_I2C_ERROR
+
+	Example       :
+					uint8_t com_stat;
+					uint8_t my_data[3] = {0x00,0x01,0x02};
+
+					com_stat = LINUX_I2C_Mem_Write(&hi2c1 , 0x78 , 0x40 , I2C_MEMADD_SIZE_8BIT , my_data , 3 , 100); (0x78 : Device Address)
+
+*/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Mem_WriteV(LINUX_I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, const LINUX_I2C_SegmentTypeDef *pSegments, uint8_t Count, uint32_t Timeout) /* This function is for write data segments to external memory in one message */
+{
+
+	/* -------------------------------------------- */
+
+	LINUX_I2C_StatusTypeDef i2c_status; /* Create enum */
+	uint8_t counter; /* Segment counter */
+
+	/* -------------------------------------------- */
+
+	i2c_status = LINUX_I2C_Session_Begin(hi2c , DevAddress , MemAddress , MemAddSize); /* New message */
+
+	for ( counter = 0 ; counter < Count ; counter++ ) /* Segments follow in the same message */
+	{
+
+		if ( LINUX_I2C_Session_Write(hi2c , pSegments[counter].Data , pSegments[counter].Size) != LINUX_I2C_OK )
+		{
+			i2c_status = LINUX_I2C_ERROR;
+		}
+
+	}
+
+	LINUX_I2C_Session_End(hi2c);
+
+	if ( LINUX_I2C_Flush(hi2c) != LINUX_I2C_OK ) /* Send */
+	{
+		i2c_status = LINUX_I2C_ERROR;
+	}
+
+	(void)Timeout;
+
+	return i2c_status;
+
+	/* Function End */
+}
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+					DevAddress : Target device address (8-bit, like HAL).
+					MemAddress : Internal memory address.
+					MemAddSize : Size of internal memory address.
+					pSegments  : Pointer to array of data segments.
+					Count      : Number of segments.
+					Timeout    : Unused, the adapter timeout applies.
+
+	Return Values :
+					LINUX_I2C_OK / LINUX_I2C_ERROR
+
+	Example       :
+					uint8_t com_stat;
+					LINUX_I2C_SegmentTypeDef my_segments[2] = {{my_page0 , 20} , {my_page1 , 20}};
+
+					com_stat = LINUX_I2C_Mem_WriteV(&hi2c1 , 0x78 , 0x40 , I2C_MEMADD_SIZE_8BIT , my_segments , 2 , 100);
+
+*/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Session_Begin(LINUX_I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize) /* This function is for queue a new message */
+{
+
+	LINUX_I2C_Session_End(hi2c); /* Close the previous message */
+
+	/* ---------------- Session prefix ---------------- */
+
+	hi2c->Address = DevAddress >> _LINUX_I2C_ADDRESS_SHIFT;
+
+	if ( MemAddSize == I2C_MEMADD_SIZE_16BIT ) /* MSB first */
+	{
+
+		hi2c->Prefix[0]  = (uint8_t)(MemAddress >> 8);
+		hi2c->Prefix[1]  = (uint8_t)MemAddress;
+		hi2c->PrefixSize = 2;
+
+	}
+	else
+	{
+
+		hi2c->Prefix[0]  = (uint8_t)MemAddress;
+		hi2c->PrefixSize = 1;
+
+	}
+
+	hi2c->Open = 1;
+
+	return LINUX_I2C_NewMsg(hi2c);
+
+	/* Function End */
+}
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+					DevAddress : Target device address (8-bit, like HAL).
+					MemAddress : Internal memory address (control byte).
+					MemAddSize : Size of internal memory address.
+
+	Return Values :
+					LINUX_I2C_OK / LINUX_I2C_ERROR (a full batch was sent and failed)
+
+	Example       :
+					LINUX_I2C_Session_Begin(&hi2c1 , 0x78 , 0x00 , I2C_MEMADD_SIZE_8BIT);
+
+*/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Session_Write(LINUX_I2C_HandleTypeDef *hi2c, const uint8_t *pData, uint16_t Size) /* This function is for add data to the open message */
+{
+
+	/* -------------------------------------------- */
+
+	LINUX_I2C_StatusTypeDef i2c_status = LINUX_I2C_OK; /* Create enum */
+	struct i2c_msg *msg; /* Open message */
+	uint16_t room; /* Free bytes of the message */
+
+	/* -------------------------------------------- */
+
+	if ( !hi2c->Open || ((hi2c->MaxMsgLen != 0) && (hi2c->MaxMsgLen <= hi2c->PrefixSize)) ) /* No room for data */
+	{
+		return LINUX_I2C_ERROR;
+	}
+
+	while ( Size > 0 )
+	{
+
+		msg  = &hi2c->Msg[hi2c->Count - 1];
+		room = _LINUX_I2C_BUFFER_SIZE - hi2c->Used;
+
+		if ( (hi2c->MaxMsgLen != 0) && ((msg->len + room) > hi2c->MaxMsgLen) ) /* Adapter limit */
+		{
+			room = hi2c->MaxMsgLen - msg->len;
+		}
+
+		if ( room == 0 ) /* Continue in a new message with the same prefix */
+		{
+
+			if ( LINUX_I2C_NewMsg(hi2c) != LINUX_I2C_OK )
+			{
+				i2c_status = LINUX_I2C_ERROR;
+			}
+
+			continue;
+
+		}
+
+		if ( room > Size )
+		{
+			room = Size;
+		}
+
+		memcpy(&hi2c->Buffer[hi2c->Used] , pData , room); /* Queue data */
+
+		msg->len   += room;
+		hi2c->Used += room;
+		pData      += room;
+		Size       -= room;
+
+	}
+
+	return i2c_status;
+
+	/* Function End */
+}
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+					pData	   : Pointer to data buffer, copied into the batch.
+					Size	   : Amount of data to be sent.
+
+	Return Values :
+					LINUX_I2C_OK / LINUX_I2C_ERROR (no open message, or a full batch was sent and failed)
+
+	Example       :
+					LINUX_I2C_Session_Write(&hi2c1 , my_frame , 1024);
+
+*/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Session_End(LINUX_I2C_HandleTypeDef *hi2c) /* This function is for close the open message */
+{
+
+	if ( hi2c->Open )
+	{
+
+		hi2c->Open = 0;
+
+		if ( hi2c->Msg[hi2c->Count - 1].len == hi2c->PrefixSize ) /* Nothing after the prefix */
+		{
+
+			hi2c->Count--;
+			hi2c->Used -= hi2c->PrefixSize;
+
+		}
+
+	}
+
+	return LINUX_I2C_OK;
+
+	/* Function End */
+}
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+
+	Return Values :
+					LINUX_I2C_OK
+
+	Example       :
+					LINUX_I2C_Session_End(&hi2c1); (message stays queued until LINUX_I2C_Flush)
+
+*/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Flush(LINUX_I2C_HandleTypeDef *hi2c) /* This function is for send the queued messages */
+{
+
+	LINUX_I2C_Session_End(hi2c);
+
+	if ( hi2c->Count == 0 ) /* Nothing queued */
+	{
+		return LINUX_I2C_OK;
+	}
+
+	return LINUX_I2C_Transfer(hi2c);
+
+	/* Function End */
+}
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+
+	Return Values :
+					LINUX_I2C_OK / LINUX_I2C_ERROR (I2C_RDWR failed after the retries)
+
+	Example       :
+					LINUX_I2C_Flush(&hi2c1);
+
+*/
+
+/* --------------- Host Simulation --------------- */
+
+#ifdef _LINUX_I2C_HOST_SIM
+
+int LINUX_I2C_Sim_Ioctl(int fd, unsigned long request, void *arg) /* Stand-in for ioctl */
+{
+
+	/* -------------------------------------------- */
+
+	struct i2c_rdwr_ioctl_data *rdwr = (struct i2c_rdwr_ioctl_data *)arg; /* Combined transfer */
+	uint8_t mask = LINUX_I2C_Sim.MuxMask; /* Mask after the STOP */
+	uint32_t index; /* Message counter */
+
+	/* -------------------------------------------- */
+
+	(void)fd;
+
+	if ( request == I2C_FUNCS )
+	{
+
+		*(unsigned long *)arg = I2C_FUNC_I2C;
+
+		return 0;
+
+	}
+	else{}
+
+	LINUX_I2C_Sim.Calls++;
+
+	if ( LINUX_I2C_Sim.FailCalls > 0 ) /* Injected error */
+	{
+
+		LINUX_I2C_Sim.FailCalls--;
+
+		return -1;
+
+	}
+	else{}
+
+	for ( index = 0 ; index < rdwr->nmsgs ; index++ )
+	{
+
+		struct i2c_msg *msg = &rdwr->msgs[index];
+
+		if ( msg->addr == LINUX_I2C_Sim.MuxAddress ) /* Control register of the mux */
+		{
+
+			if ( msg->len > 0 )
+			{
+				mask = msg->buf[msg->len - 1];
+			}
+			else{}
+
+			LINUX_I2C_Sim.Selects++;
+
+			continue;
+
+		}
+		else{}
+
+		if ( LINUX_I2C_Sim.MuxMask == 0 ) /* Device is behind a closed channel, NACK */
+		{
+			return -1;
+		}
+		else{}
+
+		if ( LINUX_I2C_Sim.Count < _LINUX_I2C_SIM_LOG_SIZE )
+		{
+
+			LINUX_I2C_Sim.Log[LINUX_I2C_Sim.Count].Address = msg->addr;
+			LINUX_I2C_Sim.Log[LINUX_I2C_Sim.Count].Mask    = LINUX_I2C_Sim.MuxMask;
+			LINUX_I2C_Sim.Log[LINUX_I2C_Sim.Count].Control = (msg->len > 0) ? msg->buf[0] : 0;
+			LINUX_I2C_Sim.Log[LINUX_I2C_Sim.Count].Len     = msg->len;
+			LINUX_I2C_Sim.Count++;
+
+		}
+		else
+		{
+			LINUX_I2C_Sim.Dropped++;
+		}
+
+	}
+
+	LINUX_I2C_Sim.MuxMask = mask; /* Channels switch at STOP */
+
+	return (int)rdwr->nmsgs;
+
+	/* Function End */
+}
+
+void LINUX_I2C_Sim_Clear(void) /* Clear the log, counters and mask */
+{
+
+	LINUX_I2C_Sim.MuxMask   = 0;
+	LINUX_I2C_Sim.Selects   = 0;
+	LINUX_I2C_Sim.Calls     = 0;
+	LINUX_I2C_Sim.FailCalls = 0;
+	LINUX_I2C_Sim.Count     = 0;
+	LINUX_I2C_Sim.Dropped   = 0;
+
+}
+
+#endif /* _LINUX_I2C_HOST_SIM */
+
+/* --------------- Static Functions -------------- */
+
+static int LINUX_I2C_Ioctl(int fd, unsigned long request, void *arg) /* ioctl is variadic, wrap it for the handle */
+{
+	return ioctl(fd , request , arg);
+}
+
+static LINUX_I2C_StatusTypeDef LINUX_I2C_NewMsg(LINUX_I2C_HandleTypeDef *hi2c) /* Start a message with the session prefix */
+{
+
+	/* -------------------------------------------- */
+
+	LINUX_I2C_StatusTypeDef i2c_status = LINUX_I2C_OK; /* Create enum */
+	struct i2c_msg *msg; /* New message */
+
+	/* -------------------------------------------- */
+
+	if ( (hi2c->Count >= hi2c->MaxMsgs) || ((hi2c->Used + hi2c->PrefixSize) >= _LINUX_I2C_BUFFER_SIZE) ) /* Batch is full */
+	{
+		i2c_status = LINUX_I2C_Transfer(hi2c);
+	}
+
+	msg = &hi2c->Msg[hi2c->Count++];
+
+	msg->addr  = hi2c->Address;
+	msg->flags = 0; /* Write */
+	msg->buf   = &hi2c->Buffer[hi2c->Used];
+	msg->len   = hi2c->PrefixSize;
+
+	memcpy(msg->buf , hi2c->Prefix , hi2c->PrefixSize);
+
+	hi2c->Used += hi2c->PrefixSize;
+
+	return i2c_status;
+
+	/* Function End */
+}
+
+static LINUX_I2C_StatusTypeDef LINUX_I2C_Transfer(LINUX_I2C_HandleTypeDef *hi2c) /* Send the batch with I2C_RDWR */
+{
+
+	/* -------------------------------------------- */
+
+	LINUX_I2C_StatusTypeDef i2c_status = LINUX_I2C_ERROR; /* Create enum */
+	struct i2c_rdwr_ioctl_data rdwr; /* Combined transfer */
+	uint8_t trial; /* Retry counter */
+
+	/* -------------------------------------------- */
+
+	rdwr.msgs  = hi2c->Msg;
+	rdwr.nmsgs = hi2c->Count;
+
+	for ( trial = 0 ; ; trial++ )
+	{
+
+		hi2c->Transfers++;
+
+		if ( hi2c->Ioctl(hi2c->Fd , I2C_RDWR , &rdwr) >= 0 ) /* One STOP for all messages */
+		{
+
+			hi2c->Messages += hi2c->Count;
+			i2c_status      = LINUX_I2C_OK;
+
+			break;
+
+		}
+
+		if ( trial >= hi2c->Retries ) /* Drop the batch */
+		{
+
+			hi2c->Errors++;
+
+			break;
+
+		}
+
+		hi2c->RetryCount++;
+
+		#if (_LINUX_I2C_RETRY_DELAY_US > 0)
+		usleep(_LINUX_I2C_RETRY_DELAY_US);
+		#endif
+
+	}
+
+	hi2c->Count = 0;
+	hi2c->Used  = 0;
+
+	return i2c_status;
+
+	/* Function End */
+}
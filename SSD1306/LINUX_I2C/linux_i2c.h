@@ -0,0 +1,304 @@
+/*
+------------------------------------------------------------------------------
+~ File   : linux_i2c.h
+~ Author : agent
+~ Version: V0.1.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+~ Description:    Support Linux single board computers (i2c-dev).
+
+~ Attention  :    This module required the i2c-dev kernel driver (/dev/i2c-N).
+
+				  Writes are queued as i2c_msg and sent with one I2C_RDWR call
+				  (repeated START between messages, one STOP at the end).
+				  A message longer than MaxMsgLen, or one that does not fit in
+				  the batch, is continued in a new message that starts with the
+				  same memory address bytes (the control byte of a display).
+
+				  Ioctl of the handle can be replaced by an in-process stand-in
+				  (LINUX_I2C_Attach), no bus is needed for that.
+
+~ Changes    :
+				  Add : LINUX_I2C_Open / LINUX_I2C_Attach / LINUX_I2C_Close functions for open the adapter.
+				  Add : LINUX_I2C_Mem_Write   function for write data like HAL_I2C_Mem_Write2.
+				  Add : LINUX_I2C_Mem_WriteV  function for write data segments in one message.
+				  Add : LINUX_I2C_Session_xxx functions for queue messages without calling I2C_RDWR.
+				  Add : LINUX_I2C_Flush       function for send the queued messages.
+				  Add : _LINUX_I2C_HOST_SIM   stand-in adapter with a TCA9548A (linux_i2c_sim.h).
+
+------------------------------------------------------------------------------
+*/
+
+#ifndef __LINUX_I2C_H_
+#define __LINUX_I2C_H_
+
+/*************************************** Include ***************************************/
+
+#include <stdint.h>          /* Import standard integer type */
+#include <linux/i2c.h>       /* Import i2c_msg */
+#include <linux/i2c-dev.h>   /* Import I2C_RDWR */
+
+#include "linux_i2c_conf.h"  /* Import config file */
+
+#ifdef _LINUX_I2C_HOST_SIM  /* Check host simulation */
+#include "linux_i2c_sim.h"  /* Import the stand-in adapter */
+#endif /* _LINUX_I2C_HOST_SIM */
+
+/*************************************** Defines ***************************************/
+
+/* ------------------------------- Address ------------------------------- */
+
+#ifndef I2C_MEMADD_SIZE_8BIT
+	#define I2C_MEMADD_SIZE_8BIT     0x00000001U /* Memory Address Size */
+#endif
+
+#ifndef I2C_MEMADD_SIZE_16BIT
+	#define I2C_MEMADD_SIZE_16BIT    0x00000002U /* Memory Address Size */
+#endif
+
+#define _LINUX_I2C_ADDRESS_SHIFT     1    /* 8-bit address (HAL style) to 7-bit */
+
+/* -------------------------------- Config ------------------------------- */
+
+#ifndef _LINUX_I2C_MAX_MSGS
+	#define _LINUX_I2C_MAX_MSGS      I2C_RDWR_IOCTL_MAX_MSGS /* i2c_msg per I2C_RDWR */
+#endif
+
+#ifndef _LINUX_I2C_MAX_MSG_LEN
+	#define _LINUX_I2C_MAX_MSG_LEN   0    /* No adapter limit */
+#endif
+
+#ifndef _LINUX_I2C_BUFFER_SIZE
+	#define _LINUX_I2C_BUFFER_SIZE   2048 /* Bytes per I2C_RDWR */
+#endif
+
+#ifndef _LINUX_I2C_RETRIES
+	#define _LINUX_I2C_RETRIES       3    /* Retries of a failed I2C_RDWR */
+#endif
+
+#ifndef _LINUX_I2C_RETRY_DELAY_US
+	#define _LINUX_I2C_RETRY_DELAY_US 0   /* Retry at once */
+#endif
+
+#if (_LINUX_I2C_MAX_MSGS > I2C_RDWR_IOCTL_MAX_MSGS)
+	#error "_LINUX_I2C_MAX_MSGS is more than I2C_RDWR accepts"
+#endif
+
+/**************************************** Enums ****************************************/
+
+typedef enum /* Enum Status Codes */
+{
+
+	LINUX_I2C_OK    = 0, /* OK status */
+	LINUX_I2C_ERROR = 1  /* Error status */
+
+}LINUX_I2C_StatusTypeDef;
+
+/*************************************** Struct ****************************************/
+
+typedef int (*LINUX_I2C_IoctlTypeDef)(int fd, unsigned long request, void *arg); /* ioctl or stand-in */
+
+typedef struct /* Data segment */
+{
+
+	const uint8_t *Data;
+	uint16_t       Size;
+
+}LINUX_I2C_SegmentTypeDef;
+
+typedef struct /* Adapter handle */
+{
+
+	int                     Fd;        /* Descriptor of /dev/i2c-N */
+	LINUX_I2C_IoctlTypeDef  Ioctl;     /* ioctl of the adapter */
+	uint16_t                MaxMsgs;   /* i2c_msg per I2C_RDWR */
+	uint16_t                MaxMsgLen; /* Bytes per i2c_msg, 0 = no limit */
+	uint8_t                 Retries;   /* Retries of a failed I2C_RDWR */
+
+	/* Batch */
+	struct i2c_msg          Msg[_LINUX_I2C_MAX_MSGS];
+	uint8_t                 Buffer[_LINUX_I2C_BUFFER_SIZE];
+	uint16_t                Count;      /* Queued messages */
+	uint16_t                Used;       /* Queued bytes */
+
+	/* Session */
+	uint8_t                 Open;       /* Last message takes Session_Write data */
+	uint16_t                Address;    /* 7-bit address of the session */
+	uint8_t                 Prefix[2];  /* Memory address bytes of the session */
+	uint8_t                 PrefixSize;
+
+	/* Statistics */
+	uint32_t                Transfers;  /* I2C_RDWR calls, retries included */
+	uint32_t                Messages;   /* i2c_msg sent */
+	uint32_t                RetryCount; /* Failed calls that were retried */
+	uint32_t                Errors;     /* Batches dropped after the last retry */
+
+}LINUX_I2C_HandleTypeDef;
+
+/************************************** Prototype **************************************/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Open(LINUX_I2C_HandleTypeDef *hi2c, const char *Path); /* This function is for open the adapter */
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+					Path       : Device node of the adapter.
+
+	Return Values :
+					LINUX_I2C_OK / LINUX_I2C_ERROR (no node, or adapter without plain I2C)
+
+	Example       :
+					LINUX_I2C_HandleTypeDef hi2c1;
+
+					LINUX_I2C_Open(&hi2c1 , "/dev/i2c-1");
+
+*/
+
+void LINUX_I2C_Attach(LINUX_I2C_HandleTypeDef *hi2c, int Fd, LINUX_I2C_IoctlTypeDef Ioctl); /* This function is for initialize the handle with a descriptor and ioctl */
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+					Fd         : Descriptor passed to Ioctl.
+					Ioctl      : ioctl of the adapter or an in-process stand-in.
+
+	Return Values :
+
+	Example       :
+					int my_ioctl(int fd, unsigned long request, void *arg)
+					{
+						struct i2c_rdwr_ioctl_data *rdwr = arg;
+
+						// check rdwr->msgs ...
+
+						return rdwr->nmsgs;
+					}
+
+					LINUX_I2C_Attach(&hi2c1 , -1 , my_ioctl);
+
+*/
+
+void LINUX_I2C_Close(LINUX_I2C_HandleTypeDef *hi2c); /* This function is for send the queue and close the adapter */
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+
+	Return Values :
+
+	Example       :
+					LINUX_I2C_Close(&hi2c1);
+
+*/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Mem_Write(LINUX_I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout); /* This function is for write data to external memory */
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+					DevAddress : Target device address (8-bit, like HAL).
+					MemAddress : Internal memory address.
+					MemAddSize : Size of internal memory address.
+					pData	   : Pointer to data buffer.
+					Size	   : Amount of data to be sent.
+					Timeout    : Unused, the adapter timeout applies.
+
+	Return Values :
+					LINUX_I2C_OK / LINUX_I2C_ERROR
+
+	Example       :
+					uint8_t com_stat;
+					uint8_t my_data[3] = {0x00,0x01,0x02};
+
+					com_stat = LINUX_I2C_Mem_Write(&hi2c1 , 0x78 , 0x40 , I2C_MEMADD_SIZE_8BIT , my_data , 3 , 100); (0x78 : Device Address)
+
+*/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Mem_WriteV(LINUX_I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, const LINUX_I2C_SegmentTypeDef *pSegments, uint8_t Count, uint32_t Timeout); /* This function is for write data segments to external memory in one message */
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+					DevAddress : Target device address (8-bit, like HAL).
+					MemAddress : Internal memory address.
+					MemAddSize : Size of internal memory address.
+					pSegments  : Pointer to array of data segments.
+					Count      : Number of segments.
+					Timeout    : Unused, the adapter timeout applies.
+
+	Return Values :
+					LINUX_I2C_OK / LINUX_I2C_ERROR
+
+	Example       :
+					uint8_t com_stat;
+					LINUX_I2C_SegmentTypeDef my_segments[2] = {{my_page0 , 20} , {my_page1 , 20}};
+
+					com_stat = LINUX_I2C_Mem_WriteV(&hi2c1 , 0x78 , 0x40 , I2C_MEMADD_SIZE_8BIT , my_segments , 2 , 100);
+
+*/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Session_Begin(LINUX_I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize); /* This function is for queue a new message */
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+					DevAddress : Target device address (8-bit, like HAL).
+					MemAddress : Internal memory address (control byte).
+					MemAddSize : Size of internal memory address.
+
+	Return Values :
+					LINUX_I2C_OK / LINUX_I2C_ERROR (a full batch was sent and failed)
+
+	Example       :
+					uint8_t my_cmd[6] = {0x21,0,127,0x22,0,7};
+
+					LINUX_I2C_Session_Begin(&hi2c1 , 0x78 , 0x00 , I2C_MEMADD_SIZE_8BIT);
+					LINUX_I2C_Session_Write(&hi2c1 , my_cmd , 6);
+					LINUX_I2C_Session_End(&hi2c1);
+
+					LINUX_I2C_Session_Begin(&hi2c1 , 0x78 , 0x40 , I2C_MEMADD_SIZE_8BIT);
+					LINUX_I2C_Session_Write(&hi2c1 , my_frame , 1024);
+					LINUX_I2C_Session_End(&hi2c1);
+
+					LINUX_I2C_Flush(&hi2c1); (window and frame in one I2C_RDWR)
+
+*/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Session_Write(LINUX_I2C_HandleTypeDef *hi2c, const uint8_t *pData, uint16_t Size); /* This function is for add data to the open message */
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+					pData	   : Pointer to data buffer, copied into the batch.
+					Size	   : Amount of data to be sent.
+
+	Return Values :
+					LINUX_I2C_OK / LINUX_I2C_ERROR (no open message, or a full batch was sent and failed)
+
+	Example       :
+					LINUX_I2C_Session_Write(&hi2c1 , my_frame , 1024);
+
+*/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Session_End(LINUX_I2C_HandleTypeDef *hi2c); /* This function is for close the open message */
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+
+	Return Values :
+					LINUX_I2C_OK
+
+	Example       :
+					LINUX_I2C_Session_End(&hi2c1); (message stays queued until LINUX_I2C_Flush)
+
+*/
+
+LINUX_I2C_StatusTypeDef LINUX_I2C_Flush(LINUX_I2C_HandleTypeDef *hi2c); /* This function is for send the queued messages */
+/*
+	Parameters    :
+					hi2c       : Pointer to a LINUX_I2C_HandleTypeDef structure.
+
+	Return Values :
+					LINUX_I2C_OK / LINUX_I2C_ERROR (I2C_RDWR failed after the retries)
+
+	Example       :
+					LINUX_I2C_Flush(&hi2c1);
+
+*/
+
+#endif /* __LINUX_I2C_H_ */
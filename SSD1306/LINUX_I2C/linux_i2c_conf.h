@@ -0,0 +1,55 @@
+/*
+------------------------------------------------------------------------------
+~ File   : linux_i2c_conf.h
+~ Author : agent
+~ Version: V0.1.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+~ Description:    Support Linux single board computers (i2c-dev).
+
+~ Attention  :    This module required the i2c-dev kernel driver (/dev/i2c-N).
+
+~ Changes    :
+				  Add : _LINUX_I2C_MAX_MSGS     i2c_msg per I2C_RDWR call.
+				  Add : _LINUX_I2C_MAX_MSG_LEN  bytes per i2c_msg, _LINUX_I2C_BUFFER_SIZE queued bytes.
+				  Add : _LINUX_I2C_RETRIES      retries of a failed I2C_RDWR.
+
+------------------------------------------------------------------------------
+*/
+
+#ifndef __LINUX_I2C_CONF_H_
+#define __LINUX_I2C_CONF_H_
+
+/* -------- Configuration -------- */
+
+#define _LINUX_I2C_MAX_MSGS      42
+#define _LINUX_I2C_MAX_MSG_LEN   0
+#define _LINUX_I2C_BUFFER_SIZE   2048
+#define _LINUX_I2C_RETRIES       3
+
+//#define _LINUX_I2C_RETRY_DELAY_US 1000
+
+/*
+	Guide   :
+			  #define _LINUX_I2C_MAX_MSGS x       : i2c_msg per I2C_RDWR call,
+			                                       the kernel accepts up to 42.
+
+			  #define _LINUX_I2C_MAX_MSG_LEN x    : Bytes per i2c_msg for adapters with
+			                                       a write length limit, 0 = no limit.
+
+			  #define _LINUX_I2C_BUFFER_SIZE x    : Bytes queued before I2C_RDWR is called.
+
+			  #define _LINUX_I2C_RETRIES x        : Retries of a failed I2C_RDWR.
+
+			  #define _LINUX_I2C_RETRY_DELAY_US x : Wait before a retry (us).
+
+	Example :
+			  #define _LINUX_I2C_MAX_MSGS      42
+			  #define _LINUX_I2C_MAX_MSG_LEN   32   (e.g. adapter with a 32-byte FIFO)
+			  #define _LINUX_I2C_BUFFER_SIZE   2048
+			  #define _LINUX_I2C_RETRIES       3
+*/
+
+#endif /* __LINUX_I2C_CONF_H_ */
@@ -0,0 +1,83 @@
+/*
+------------------------------------------------------------------------------
+~ File   : linux_i2c_sim.h
+~ Author : agent
+~ Version: V0.1.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+~ Description:    Stand-in adapter with a TCA9548A multiplexer for testing
+				  on a host without a bus.
+
+~ Attention  :    Used when _LINUX_I2C_HOST_SIM is defined. Attach it with
+				  LINUX_I2C_Attach(&hi2c1 , -1 , LINUX_I2C_Sim_Ioctl).
+
+				  A message to MuxAddress sets the channel mask, the new mask
+				  applies after the STOP of the I2C_RDWR call (like the chip).
+				  Every other message is recorded in LINUX_I2C_Sim.Log with the
+				  mask it was sent with, it is not acknowledged when no channel
+				  is selected.
+
+~ Changes    :
+				  Add : LINUX_I2C_SimTypeDef    stand-in adapter and TCA9548A with a message log.
+				  Add : LINUX_I2C_Sim_Ioctl     function for handle I2C_RDWR in place of ioctl.
+				  Add : LINUX_I2C_Sim_Clear     function for clear the log, counters and mask.
+------------------------------------------------------------------------------
+*/
+
+#ifndef __LINUX_I2C_SIM_H_
+#define __LINUX_I2C_SIM_H_
+
+/*************************************** Include ***************************************/
+
+#include <stdint.h> /* Import standard integer type */
+
+/*************************************** Defines ***************************************/
+
+#ifndef _LINUX_I2C_SIM_LOG_SIZE
+	#define _LINUX_I2C_SIM_LOG_SIZE 256  /* Recorded messages */
+#endif
+
+#ifndef _LINUX_I2C_SIM_MUX_ADDRESS
+	#define _LINUX_I2C_SIM_MUX_ADDRESS 0x70 /* 7-bit address of the mux (A2..A0 = 0) */
+#endif
+
+/*************************************** Struct ****************************************/
+
+typedef struct /* Recorded message */
+{
+
+	uint16_t Address; /* 7-bit address */
+	uint8_t  Mask;    /* Mux channels while it was sent */
+	uint8_t  Control; /* First byte (control byte of a display) */
+	uint16_t Len;
+
+}LINUX_I2C_SimRecordTypeDef;
+
+typedef struct /* Simulated adapter and mux */
+{
+
+	uint16_t MuxAddress; /* 7-bit address of the mux */
+	uint8_t  MuxMask;    /* Selected channels */
+	uint32_t Selects;    /* Messages to the mux */
+	uint32_t Calls;      /* I2C_RDWR calls */
+	uint32_t FailCalls;  /* Calls to fail before the next success */
+
+	LINUX_I2C_SimRecordTypeDef Log[_LINUX_I2C_SIM_LOG_SIZE];
+	uint16_t                   Count;   /* Recorded messages */
+	uint16_t                   Dropped; /* Messages after the log was full */
+
+}LINUX_I2C_SimTypeDef;
+
+/************************************** Variables **************************************/
+
+extern LINUX_I2C_SimTypeDef LINUX_I2C_Sim;
+
+/************************************** Prototype **************************************/
+
+int LINUX_I2C_Sim_Ioctl(int fd, unsigned long request, void *arg); /* Stand-in for ioctl */
+
+void LINUX_I2C_Sim_Clear(void); /* Clear the log, counters and mask */
+
+#endif /* __LINUX_I2C_SIM_H_ */
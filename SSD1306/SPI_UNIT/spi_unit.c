@@ -0,0 +1,460 @@
+/*
+------------------------------------------------------------------------------
+~ File   : spi_unit.c
+~ Author : agent
+~ Version: V0.1.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+~ Description:
+
+~ Attention  :    This file is for AVR microcontroller
+
+
+~ Changes    :
+				  Add : SPI_Init / SPI_DeInit  functions for Initialize the SPI peripheral in master mode.
+				  Add : SPI_Transmit           function for send data to spi device.
+				  Add : SPI_DC_Write           function for send command/data with the D/C line.
+				  Add : SPI_DC_WriteV          function for send data segments under one chip select.
+				  Add : SPI_Reset              function for pulse the RESET line.
+				  Add : _SPI_HOST_SIM          registers are redirected to a simulated block.
+				  Add : SPI_LinesTypeDef       lines of a device for more than one device on the bus.
+------------------------------------------------------------------------------
+*/
+
+#include "spi_unit.h"
+
+/* ------------------ Variables ------------------ */
+
+#ifdef _SPI_HOST_SIM
+SPI_SimTypeDef SPI_Sim; /* Simulated registers */
+#endif /* _SPI_HOST_SIM */
+
+/* ------------------ Prototypes ----------------- */
+
+static uint8_t SPI_WaitFlag(uint16_t time_out);
+static void SPI_Select(const SPI_LinesTypeDef *lines , uint8_t dc);
+static void SPI_Deselect(const SPI_LinesTypeDef *lines);
+
+/* ------------------ Functions ------------------ */
+
+void SPI_Init(void) /* This Function is for Initialize the SPI peripheral. */
+{
+
+	/* ----------------- Set pins ----------------- */
+
+	_SPI_BUS_DDR |= (1 << _SPI_SS_PIN) | (1 << _SPI_MOSI_PIN) | (1 << _SPI_SCK_PIN); /* SS must be output for master mode */
+	_SPI_DC_DDR  |= (1 << _SPI_DC_PIN);
+
+	#ifdef _SPI_CS_PORT
+	_SPI_CS_PORT |= (1 << _SPI_CS_PIN); /* Device is not selected */
+	_SPI_CS_DDR  |= (1 << _SPI_CS_PIN);
+	#endif /* _SPI_CS_PORT */
+
+	#ifdef _SPI_RST_PORT
+	_SPI_RST_PORT |= (1 << _SPI_RST_PIN); /* Out of reset */
+	_SPI_RST_DDR  |= (1 << _SPI_RST_PIN);
+	#endif /* _SPI_RST_PORT */
+
+	/* ----------- Master, mode 0, MSB first ----------- */
+
+	_SPI_SR = (_SPI_2X_CODE << SPI2X); /* Double speed */
+	_SPI_CR = (1 << SPE) | (1 << MSTR) | _SPI_SPR_CODE; /* Enable SPI module */
+
+}
+/*
+	Parameters    :
+
+	Return Values :
+
+	Example       :
+					SPI_Init();
+
+*/
+
+void SPI_DeInit(void) /* This Function is for DeInitialize the SPI peripheral. */
+{
+
+	_SPI_CR = _SPI_DIS; /* Reset register */
+	_SPI_SR = _SPI_DIS; /* Reset register */
+
+}
+/*
+	Parameters    :
+
+	Return Values :
+
+	Example       :
+					SPI_DeInit();
+
+*/
+
+StatusTypeDef SPI_Transmit(const uint8_t *data , uint32_t quantity , uint16_t time_out) /* This function is for send data to spi device */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+
+	uint8_t spi_status = _STAT_OK; /* Variable for check status */
+
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+
+	for ( ; quantity > 0 ; quantity-- ) /* Send data */
+	{
+
+		_SPI_WRITE_DR(*data); /* Start transfer */
+
+		if ( SPI_WaitFlag(time_out) != _STAT_OK ) /* Wait for SPIF */
+		{
+			spi_status = _STAT_ERROR;
+			break;
+		}
+		else{}
+
+		data++; /* Select next byte */
+
+	}
+
+	return spi_status;
+
+	/* Function End */
+}
+/*
+	Parameters    :
+					data : Pointer to data buffer.
+					quantity : Amount of data to be sent.
+					time_out : Timeout duration.
+
+	Return Values :
+					_STAT_OK / _STAT_ERROR
+
+	Example       :
+					uint8_t com_stat;
+					uint8_t my_data[3] = {0x00,0x01,0x02};
+
+					com_stat = SPI_Transmit(my_data , 3 , 100);
+
+*/
+
+StatusTypeDef SPI_DC_Write(const SPI_LinesTypeDef *lines , uint8_t dc , const uint8_t *data , uint32_t quantity , uint16_t time_out) /* This function is for send command/data with the D/C line */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+
+	uint8_t spi_status; /* Variable for check status */
+
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+
+	SPI_Select(lines , dc); /* D/C, CS low */
+
+	spi_status = SPI_Transmit(data , quantity , time_out); /* Send data */
+
+	SPI_Deselect(lines); /* CS high */
+
+	return spi_status;
+
+	/* Function End */
+}
+/*
+	Parameters    :
+					lines : Pointer to the lines of the device, NULL for
+							the pins of spi_unit_conf.h.
+
+					dc : Level of D/C line. this parameter is :
+												_SPI_DC_COMMAND
+												_SPI_DC_DATA
+
+					data : Pointer to data buffer.
+					quantity : Amount of data to be sent.
+					time_out : Timeout duration.
+
+	Return Values :
+					_STAT_OK / _STAT_ERROR
+
+	Example       :
+					uint8_t com_stat;
+					uint8_t my_cmd[2] = {0x81,0x7F};
+
+					com_stat = SPI_DC_Write(NULL , _SPI_DC_COMMAND , my_cmd , 2 , 100);
+
+*/
+
+StatusTypeDef SPI_DC_WriteV(const SPI_LinesTypeDef *lines , uint8_t dc , const SPI_SegmentTypeDef *segments , uint8_t count , uint16_t time_out) /* This function is for send data segments under one chip select */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+
+	uint8_t spi_status = _STAT_OK; /* Variable for check status */
+
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+
+	SPI_Select(lines , dc); /* D/C, CS low */
+
+	for ( ; (count > 0) && (spi_status == _STAT_OK) ; count-- ) /* Segments follow under the same CS */
+	{
+
+		spi_status = SPI_Transmit(segments->Data , segments->Size , time_out); /* Send segment */
+		segments++; /* Select next segment */
+
+	}
+
+	SPI_Deselect(lines); /* CS high */
+
+	return spi_status;
+
+	/* Function End */
+}
+/*
+	Parameters    :
+					lines : Pointer to the lines of the device, NULL for
+							the pins of spi_unit_conf.h.
+
+					dc : Level of D/C line. this parameter is :
+												_SPI_DC_COMMAND
+												_SPI_DC_DATA
+
+					segments : Pointer to array of data segments.
+					count : Number of segments.
+					time_out : Timeout duration.
+
+	Return Values :
+					_STAT_OK / _STAT_ERROR
+
+	Example       :
+					uint8_t com_stat;
+					SPI_SegmentTypeDef my_segments[2] = {{my_page0 , 20} , {my_page1 , 20}};
+
+					com_stat = SPI_DC_WriteV(NULL , _SPI_DC_DATA , my_segments , 2 , 100);
+
+*/
+
+void SPI_Reset(const SPI_LinesTypeDef *lines) /* This function is for pulse the RESET line */
+{
+
+	if ( lines != NULL ) /* Lines of the device */
+	{
+
+		if ( lines->RSTPort == NULL ) /* No RESET line */
+		{
+			return;
+		}
+		else{}
+
+		*lines->RSTPort &= ~(1 << lines->RSTPin); /* RESET low */
+		_DELAY_US(_SPI_RESET_PULSE_US);
+
+		*lines->RSTPort |= (1 << lines->RSTPin); /* RESET high */
+		_DELAY_MS(_SPI_RESET_WAIT_MS);
+
+	}
+	else
+	{
+
+		#ifdef _SPI_RST_PORT
+
+		_SPI_RST_PORT &= ~(1 << _SPI_RST_PIN); /* RESET low */
+		_DELAY_US(_SPI_RESET_PULSE_US);
+
+		_SPI_RST_PORT |= (1 << _SPI_RST_PIN); /* RESET high */
+		_DELAY_MS(_SPI_RESET_WAIT_MS);
+
+		#else
+
+		return;
+
+		#endif /* _SPI_RST_PORT */
+
+	}
+
+	#ifdef _SPI_HOST_SIM
+	SPI_Sim.Resets++;
+	#endif /* _SPI_HOST_SIM */
+
+}
+/*
+	Parameters    :
+					lines : Pointer to the lines of the device, NULL for
+							the pins of spi_unit_conf.h.
+
+	Return Values :
+
+	Example       :
+					SPI_Reset(NULL); (No effect when _SPI_RST_PORT is not defined)
+
+*/
+
+/* --------------- Host Simulation --------------- */
+
+#ifdef _SPI_HOST_SIM
+
+void SPI_Sim_Write(uint8_t data) /* Record a byte with the D/C level */
+{
+
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+
+	const SPI_LinesTypeDef *lines = (const SPI_LinesTypeDef *)SPI_Sim.Lines; /* Lines of the selected device */
+	uint8_t selected = _TRUE;
+	uint8_t dc;
+
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+
+	SPI_Sim.DR = data;
+
+	if ( lines != NULL )
+	{
+
+		if ( lines->CSPort != NULL )
+		{
+			selected = ( (*lines->CSPort & (1 << lines->CSPin)) == 0 );
+		}
+		else{}
+
+		dc = (*lines->DCPort & (1 << lines->DCPin)) ? _SPI_DC_DATA : _SPI_DC_COMMAND;
+
+	}
+	else
+	{
+
+		#ifdef _SPI_CS_PORT
+		selected = ( (SPI_Sim.PORT & (1 << _SPI_CS_PIN)) == 0 );
+		#endif /* _SPI_CS_PORT */
+
+		dc = (SPI_Sim.PORT & (1 << _SPI_DC_PIN)) ? _SPI_DC_DATA : _SPI_DC_COMMAND;
+
+	}
+
+	if ( selected ) /* Device is selected */
+	{
+
+		if ( SPI_Sim.Count < _SPI_SIM_LOG_SIZE )
+		{
+			SPI_Sim.Log[SPI_Sim.Count].DC    = dc;
+			SPI_Sim.Log[SPI_Sim.Count].Data  = data;
+			SPI_Sim.Log[SPI_Sim.Count].Lines = lines;
+			SPI_Sim.Count++;
+		}
+		else
+		{
+			SPI_Sim.Dropped++;
+		}
+
+	}
+
+	SPI_Sim.SR |= (1 << SPIF); /* Transfer is done at once */
+
+}
+
+void SPI_Sim_Clear(void) /* Clear the log and counters */
+{
+
+	SPI_Sim.Count   = 0;
+	SPI_Sim.Dropped = 0;
+	SPI_Sim.Frames  = 0;
+	SPI_Sim.Resets  = 0;
+
+}
+
+#endif /* _SPI_HOST_SIM */
+
+/* --------------- Static Functions -------------- */
+
+static uint8_t SPI_WaitFlag(uint16_t time_out) /* Spin until SPIF is set */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+
+	uint32_t budget = (uint32_t)time_out * (_US_PER_MS / _SPI_WAIT_STEP_US); /* Number of polls */
+
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+
+	while ( (_SPI_SR & (1 << SPIF)) == 0 ) /* Byte is not sent */
+	{
+
+		if ( budget == 0 ) /* Deadline */
+		{
+			return _STAT_ERROR;
+		}
+		else{}
+
+		_DELAY_US(_SPI_WAIT_STEP_US);
+		budget--;
+
+	}
+
+	#ifdef _SPI_HOST_SIM
+	SPI_Sim.SR &= ~(1 << SPIF); /* Cleared by reading SPSR and SPDR */
+	#else
+	(void)_SPI_DR; /* Clear SPIF */
+	#endif /* _SPI_HOST_SIM */
+
+	return _STAT_OK;
+
+	/* Function End */
+}
+
+static void SPI_Select(const SPI_LinesTypeDef *lines , uint8_t dc) /* Set D/C and select the device */
+{
+
+	if ( lines != NULL ) /* Lines of the device */
+	{
+
+		if ( dc == _SPI_DC_DATA )
+		{
+			*lines->DCPort |= (1 << lines->DCPin);
+		}
+		else
+		{
+			*lines->DCPort &= ~(1 << lines->DCPin);
+		}
+
+		if ( lines->CSPort != NULL )
+		{
+			*lines->CSPort &= ~(1 << lines->CSPin); /* CS low */
+		}
+		else{}
+
+	}
+	else
+	{
+
+		if ( dc == _SPI_DC_DATA )
+		{
+			_SPI_DC_PORT |= (1 << _SPI_DC_PIN);
+		}
+		else
+		{
+			_SPI_DC_PORT &= ~(1 << _SPI_DC_PIN);
+		}
+
+		#ifdef _SPI_CS_PORT
+		_SPI_CS_PORT &= ~(1 << _SPI_CS_PIN); /* CS low */
+		#endif /* _SPI_CS_PORT */
+
+	}
+
+	#ifdef _SPI_HOST_SIM
+	SPI_Sim.Frames++;
+	SPI_Sim.Lines = lines;
+	#endif /* _SPI_HOST_SIM */
+
+}
+
+static void SPI_Deselect(const SPI_LinesTypeDef *lines) /* Release the device */
+{
+
+	if ( lines != NULL ) /* Lines of the device */
+	{
+
+		if ( lines->CSPort != NULL )
+		{
+			*lines->CSPort |= (1 << lines->CSPin); /* CS high */
+		}
+		else{}
+
+	}
+	else
+	{
+
+		#ifdef _SPI_CS_PORT
+		_SPI_CS_PORT |= (1 << _SPI_CS_PIN); /* CS high */
+		#endif /* _SPI_CS_PORT */
+
+	}
+
+}
@@ -0,0 +1,359 @@
+/*
+------------------------------------------------------------------------------
+~ File   : spi_unit.h
+~ Author : agent
+~ Version: V0.1.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+~ Description:
+
+~ Attention  :    This file is for AVR microcontroller
+
+
+~ Changes    :
+				  Add : SPI_Init / SPI_DeInit  functions for Initialize the SPI peripheral in master mode.
+				  Add : SPI_Transmit           function for send data to spi device.
+				  Add : SPI_DC_Write           function for send command/data with the D/C line.
+				  Add : SPI_DC_WriteV          function for send data segments under one chip select.
+				  Add : SPI_Reset              function for pulse the RESET line.
+				  Add : _SPI_HOST_SIM          registers are redirected to a simulated block.
+				  Add : SPI_LinesTypeDef       lines of a device for more than one device on the bus.
+------------------------------------------------------------------------------
+*/
+
+#ifndef __SPI_UNIT_H_
+#define __SPI_UNIT_H_
+
+/*************************************** Include ***************************************/
+
+#include <stdint.h> /* Import standard integer type */
+#include <stddef.h> /* Import NULL */
+
+#include "spi_unit_conf.h" /* Import spi config file */
+
+/*----------------------------------------------------------*/
+
+#ifdef _SPI_HOST_SIM  /* Check host simulation */
+
+#include "spi_unit_sim.h"  /* Import simulated SPI registers */
+
+/*----------------------------------------------------------*/
+
+#elif defined(__CODEVISIONAVR__)  /* Check compiler */
+
+#pragma warn_unref_func- /* Disable 'unused function' warning */
+
+#include <io.h>            /* Import AVR IO library */
+#include <delay.h>         /* Import delay library */
+
+/*----------------------------------------------------------*/
+
+#elif defined(__GNUC__)   /* Check compiler */
+
+#pragma GCC diagnostic ignored "-Wunused-function" /* Disable 'unused function' warning */
+
+#include <avr/io.h>        /* Import AVR IO library */
+#include <util/delay.h>    /* Import delay library */
+
+/*----------------------------------------------------------*/
+
+#else                     /* Compiler not found */
+
+#error Compiler not supported  /* Send error */
+
+#endif /* __CODEVISIONAVR__ */
+
+/*************************************** Defines ***************************************/
+
+/* ------------------------------ Type size ------------------------------ */
+
+#ifndef ENUM_U8_T
+	#define ENUM_U8_T(ENUM_NAME)   Enum_##ENUM_NAME; typedef uint8_t ENUM_NAME /* Config enum size */
+#endif
+
+/* ----------------------Delay - MCU Clock definition -------------------- */
+
+#ifdef __CODEVISIONAVR__ /* Check compiler */
+
+	#ifndef _DELAY_MS
+
+		#define _DELAY_MS(x)    delay_ms(x)
+
+	#endif /* _DELAY_MS */
+
+	#ifndef _DELAY_US
+
+		#define _DELAY_US(x)    delay_us(x)
+
+	#endif /* _DELAY_US */
+
+#elif defined(__GNUC__) /* Check compiler */
+
+	#ifndef _DELAY_MS
+
+		#define _DELAY_MS(x)    _delay_ms(x)
+
+	#endif /* _DELAY_MS */
+
+	#ifndef _DELAY_US
+
+		#define _DELAY_US(x)    _delay_us(x)
+
+	#endif /* _DELAY_US */
+
+#endif /* __CODEVISIONAVR__ */
+
+/* ---------------------------- Clock divider ---------------------------- */
+
+#define _SPI_DIV2    2   /* SCK = F_CPU / 2   */
+#define _SPI_DIV4    4   /* SCK = F_CPU / 4   */
+#define _SPI_DIV8    8   /* SCK = F_CPU / 8   */
+#define _SPI_DIV16   16  /* SCK = F_CPU / 16  */
+#define _SPI_DIV32   32  /* SCK = F_CPU / 32  */
+#define _SPI_DIV64   64  /* SCK = F_CPU / 64  */
+#define _SPI_DIV128  128 /* SCK = F_CPU / 128 */
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#if _SPI_CLOCK_DIV == _SPI_DIV2 /* Check divider */
+
+	#define _SPI_SPR_CODE 0x00 /* SPR1:0 value for set register */
+	#define _SPI_2X_CODE  1    /* SPI2X value for set register */
+
+/* ------ */
+#elif _SPI_CLOCK_DIV == _SPI_DIV4 /* Check divider */
+
+	#define _SPI_SPR_CODE 0x00 /* SPR1:0 value for set register */
+	#define _SPI_2X_CODE  0    /* SPI2X value for set register */
+
+/* ------ */
+#elif _SPI_CLOCK_DIV == _SPI_DIV8 /* Check divider */
+
+	#define _SPI_SPR_CODE 0x01 /* SPR1:0 value for set register */
+	#define _SPI_2X_CODE  1    /* SPI2X value for set register */
+
+/* ------ */
+#elif _SPI_CLOCK_DIV == _SPI_DIV16 /* Check divider */
+
+	#define _SPI_SPR_CODE 0x01 /* SPR1:0 value for set register */
+	#define _SPI_2X_CODE  0    /* SPI2X value for set register */
+
+/* ------ */
+#elif _SPI_CLOCK_DIV == _SPI_DIV32 /* Check divider */
+
+	#define _SPI_SPR_CODE 0x02 /* SPR1:0 value for set register */
+	#define _SPI_2X_CODE  1    /* SPI2X value for set register */
+
+/* ------ */
+#elif _SPI_CLOCK_DIV == _SPI_DIV64 /* Check divider */
+
+	#define _SPI_SPR_CODE 0x02 /* SPR1:0 value for set register */
+	#define _SPI_2X_CODE  0    /* SPI2X value for set register */
+
+/* ------ */
+#elif _SPI_CLOCK_DIV == _SPI_DIV128 /* Check divider */
+
+	#define _SPI_SPR_CODE 0x03 /* SPR1:0 value for set register */
+	#define _SPI_2X_CODE  0    /* SPI2X value for set register */
+
+#else
+
+	#error "_SPI_CLOCK_DIV is not valid"
+
+#endif
+
+/* --------------------------------- SPI --------------------------------- */
+
+#define _SPI_DIS                     0    /* Disable value for reset register */
+
+#define _SPI_DC_COMMAND              0    /* D/C level for command bytes */
+#define _SPI_DC_DATA                 1    /* D/C level for data bytes */
+
+/* Define Registers */
+
+#ifndef _SPI_CR
+	#define _SPI_CR SPCR /* SPI Control Register */
+#endif
+
+#ifndef _SPI_SR
+	#define _SPI_SR SPSR /* SPI Status Register */
+#endif
+
+#ifndef _SPI_DR
+	#define _SPI_DR SPDR /* SPI Data Register */
+#endif
+
+#ifndef _SPI_WRITE_DR
+	#define _SPI_WRITE_DR(x) (_SPI_DR = (x)) /* Start a byte transfer */
+#endif
+
+/* -------------------------------- Timing ------------------------------- */
+
+#define _SPI_RESET_PULSE_US          10   /* RESET low time, SSD1306 needs 3us */
+#define _SPI_RESET_WAIT_MS           1    /* Wait after RESET before first command */
+
+/* -------------------------------- Public ------------------------------- */
+
+#define _US_PER_MS                   1000 /* Microseconds per time_out unit */
+
+#ifndef _SPI_WAIT_STEP_US
+	#define _SPI_WAIT_STEP_US        1    /* Delay between flag polls */
+#endif
+
+#ifndef _FALSE
+	#define _FALSE 0 /* False value */
+#endif
+
+#ifndef _TRUE
+	#define _TRUE  1  /* True value */
+#endif
+
+/**************************************** Enums ****************************************/
+
+#ifndef __STATUS_TYPEDEF_ /* Shared with i2c_unit */
+#define __STATUS_TYPEDEF_
+
+typedef enum /* Enum Status Codes */
+{
+
+	_STAT_ERROR = 0, /* Error status */
+	_STAT_OK    = 1  /* OK status */
+
+}ENUM_U8_T(StatusTypeDef);
+
+#endif /* __STATUS_TYPEDEF_ */
+
+/*************************************** Struct ****************************************/
+
+typedef struct /* Data segment */
+{
+
+	const uint8_t *Data;
+	uint16_t       Size;
+
+}SPI_SegmentTypeDef;
+
+typedef struct /* Control lines of a device, NULL port = not connected */
+{
+
+	volatile uint8_t *DCPort;
+	uint8_t           DCPin;
+	volatile uint8_t *CSPort;
+	uint8_t           CSPin;
+	volatile uint8_t *RSTPort;
+	uint8_t           RSTPin;
+
+}SPI_LinesTypeDef;
+
+/************************************** Prototype **************************************/
+
+void SPI_Init(void); /* This Function is for Initialize the SPI peripheral. */
+/*
+	Parameters    :
+
+	Return Values :
+
+	Example       :
+					SPI_Init();
+
+*/
+
+void SPI_DeInit(void); /* This Function is for DeInitialize the SPI peripheral. */
+/*
+	Parameters    :
+
+	Return Values :
+
+	Example       :
+					SPI_DeInit();
+
+*/
+
+StatusTypeDef SPI_Transmit(const uint8_t *data , uint32_t quantity , uint16_t time_out); /* This function is for send data to spi device */
+/*
+	Parameters    :
+					data : Pointer to data buffer.
+					quantity : Amount of data to be sent.
+					time_out : Timeout duration.
+
+	Return Values :
+					_STAT_OK / _STAT_ERROR
+
+	Example       :
+					uint8_t com_stat;
+					uint8_t my_data[3] = {0x00,0x01,0x02};
+
+					com_stat = SPI_Transmit(my_data , 3 , 100);
+
+*/
+
+StatusTypeDef SPI_DC_Write(const SPI_LinesTypeDef *lines , uint8_t dc , const uint8_t *data , uint32_t quantity , uint16_t time_out); /* This function is for send command/data with the D/C line */
+/*
+	Parameters    :
+					lines : Pointer to the lines of the device, NULL for
+							the pins of spi_unit_conf.h.
+
+					dc : Level of D/C line. this parameter is :
+												_SPI_DC_COMMAND
+												_SPI_DC_DATA
+
+					data : Pointer to data buffer.
+					quantity : Amount of data to be sent.
+					time_out : Timeout duration.
+
+	Return Values :
+					_STAT_OK / _STAT_ERROR
+
+	Example       :
+					uint8_t com_stat;
+					uint8_t my_cmd[2] = {0x81,0x7F};
+
+					SPI_LinesTypeDef my_lines = {&PORTD , 4 , &PORTD , 5 , NULL , 0};
+
+					com_stat = SPI_DC_Write(NULL , _SPI_DC_COMMAND , my_cmd , 2 , 100);
+					com_stat = SPI_DC_Write(&my_lines , _SPI_DC_COMMAND , my_cmd , 2 , 100); (Pins are outputs, CS high)
+
+*/
+
+StatusTypeDef SPI_DC_WriteV(const SPI_LinesTypeDef *lines , uint8_t dc , const SPI_SegmentTypeDef *segments , uint8_t count , uint16_t time_out); /* This function is for send data segments under one chip select */
+/*
+	Parameters    :
+					lines : Pointer to the lines of the device, NULL for
+							the pins of spi_unit_conf.h.
+
+					dc : Level of D/C line. this parameter is :
+												_SPI_DC_COMMAND
+												_SPI_DC_DATA
+
+					segments : Pointer to array of data segments.
+					count : Number of segments.
+					time_out : Timeout duration.
+
+	Return Values :
+					_STAT_OK / _STAT_ERROR
+
+	Example       :
+					uint8_t com_stat;
+					SPI_SegmentTypeDef my_segments[2] = {{my_page0 , 20} , {my_page1 , 20}};
+
+					com_stat = SPI_DC_WriteV(NULL , _SPI_DC_DATA , my_segments , 2 , 100);
+
+*/
+
+void SPI_Reset(const SPI_LinesTypeDef *lines); /* This function is for pulse the RESET line */
+/*
+	Parameters    :
+					lines : Pointer to the lines of the device, NULL for
+							the pins of spi_unit_conf.h.
+
+	Return Values :
+
+	Example       :
+					SPI_Reset(NULL); (No effect when _SPI_RST_PORT is not defined)
+					SPI_Reset(&my_lines); (No effect when RSTPort is NULL)
+
+*/
+
+#endif /* __SPI_UNIT_H_ */
@@ -0,0 +1,75 @@
+/*
+------------------------------------------------------------------------------
+~ File   : spi_unit_conf.h
+~ Author : agent
+~ Version: V0.1.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+~ Description:
+
+~ Attention  :    This file is for AVR microcontroller
+
+
+~ Changes    :
+				  Add : _SPI_CLOCK_DIV         SCK divider of the master.
+				  Add : _SPI_DC_PORT / _PIN    D/C line, _SPI_CS_* and _SPI_RST_* optional lines.
+------------------------------------------------------------------------------
+*/
+
+#ifndef __SPI_UNIT_CONF_H_
+#define __SPI_UNIT_CONF_H_
+
+/* -------------------- Define -------------------- */
+
+#define _SPI_CLOCK_DIV  _SPI_DIV2
+
+/* Bus pins (ATmega328P) */
+#define _SPI_BUS_DDR    DDRB
+#define _SPI_SS_PIN     2
+#define _SPI_MOSI_PIN   3
+#define _SPI_SCK_PIN    5
+
+/* Data/Command pin */
+#define _SPI_DC_PORT    PORTB
+#define _SPI_DC_DDR     DDRB
+#define _SPI_DC_PIN     1
+
+/* Chip select pin */
+//#define _SPI_CS_PORT  PORTB
+//#define _SPI_CS_DDR   DDRB
+//#define _SPI_CS_PIN   2
+
+/* Reset pin */
+//#define _SPI_RST_PORT PORTB
+//#define _SPI_RST_DDR  DDRB
+//#define _SPI_RST_PIN  0
+
+//#define _SPI_WAIT_STEP_US 1
+
+/*
+	Guide :
+			_SPI_CLOCK_DIV : SCK = F_CPU / div, argument is
+							 _SPI_DIV2 , _SPI_DIV4 , _SPI_DIV8 , _SPI_DIV16 ,
+							 _SPI_DIV32 , _SPI_DIV64 , _SPI_DIV128
+
+			_SPI_BUS_DDR   : Direction register and pins of SS, MOSI and SCK.
+							 SS is set as output to stay in master mode
+							 (ATmega32 : SS 4 , MOSI 5 , SCK 7)
+
+			_SPI_DC_xxx    : Data/Command line, low for command and high for data
+
+			_SPI_CS_xxx    : Chip select line (active low), leave undefined
+							 if CS of the device is tied to GND
+
+			_SPI_RST_xxx   : Reset line (active low), leave undefined
+							 if RES of the device has an RC circuit
+
+			_SPI_WAIT_STEP_US : Delay between polls of SPIF (us),
+								time_out stays in milliseconds
+*/
+
+/* ------------------------------------------------ */
+
+#endif /* __SPI_UNIT_CONF_H_ */
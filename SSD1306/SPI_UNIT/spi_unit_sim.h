@@ -0,0 +1,137 @@
+/*
+------------------------------------------------------------------------------
+~ File   : spi_unit_sim.h
+~ Author : agent
+~ Version: V0.1.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+~ Description:    Simulated SPI registers and pins for building spi_unit
+				  on a host.
+
+~ Attention  :    Used when _SPI_HOST_SIM is defined. Every byte written to
+				  the data register while CS is low is recorded in SPI_Sim.Log
+				  with the level of the D/C line.
+
+~ Changes    :
+				  Add : SPI_SimTypeDef         simulated SPI register block and pins of the host.
+				  Add : SPI_Sim_Write          function for record a byte with the D/C level.
+				  Add : SPI_Sim_Clear          function for clear the log and counters.
+------------------------------------------------------------------------------
+*/
+
+#ifndef __SPI_UNIT_SIM_H_
+#define __SPI_UNIT_SIM_H_
+
+/*************************************** Include ***************************************/
+
+#include <stdint.h> /* Import standard integer type */
+
+/*************************************** Defines ***************************************/
+
+/* ------------------------------ Registers ------------------------------ */
+
+#define _SPI_CR SPI_Sim.CR /* SPI Control Register */
+#define _SPI_SR SPI_Sim.SR /* SPI Status Register */
+#define _SPI_DR SPI_Sim.DR /* SPI Data Register */
+
+#define _SPI_WRITE_DR(x) SPI_Sim_Write((x)) /* Record byte and complete the transfer */
+
+/* -------------------------------- Pins --------------------------------- */
+
+#undef  _SPI_BUS_DDR
+#define _SPI_BUS_DDR  SPI_Sim.DDR
+
+#undef  _SPI_DC_PORT
+#undef  _SPI_DC_DDR
+#define _SPI_DC_PORT  SPI_Sim.PORT
+#define _SPI_DC_DDR   SPI_Sim.DDR
+
+#ifdef _SPI_CS_PORT
+	#undef  _SPI_CS_PORT
+	#undef  _SPI_CS_DDR
+	#define _SPI_CS_PORT  SPI_Sim.PORT
+	#define _SPI_CS_DDR   SPI_Sim.DDR
+#endif
+
+#ifdef _SPI_RST_PORT
+	#undef  _SPI_RST_PORT
+	#undef  _SPI_RST_DDR
+	#define _SPI_RST_PORT SPI_Sim.PORT
+	#define _SPI_RST_DDR  SPI_Sim.DDR
+#endif
+
+/* ------------------------------- SPI Bits ------------------------------ */
+
+#define SPIE  7
+#define SPE   6
+#define DORD  5
+#define MSTR  4
+#define CPOL  3
+#define CPHA  2
+#define SPR1  1
+#define SPR0  0
+
+#define SPIF  7
+#define WCOL  6
+#define SPI2X 0
+
+/* -------------------------------- Host --------------------------------- */
+
+#ifndef F_CPU
+	#define F_CPU 16000000UL /* Simulated CPU clock */
+#endif
+
+#ifndef _DELAY_MS
+	#define _DELAY_MS(x) /* No delay on host */
+#endif
+
+#ifndef _DELAY_US
+	#define _DELAY_US(x) /* No delay on host */
+#endif
+
+#ifndef _SPI_SIM_LOG_SIZE
+	#define _SPI_SIM_LOG_SIZE 2048 /* Recorded bytes */
+#endif
+
+/*************************************** Struct ****************************************/
+
+typedef struct /* Recorded byte */
+{
+
+	uint8_t     DC;    /* D/C level: 0 command, 1 data */
+	uint8_t     Data;
+	const void *Lines; /* SPI_LinesTypeDef of the device, NULL = pins of spi_unit_conf.h */
+
+}SPI_SimRecordTypeDef;
+
+typedef struct /* Simulated SPI register block and pins */
+{
+
+	volatile uint8_t CR;
+	volatile uint8_t SR;
+	volatile uint8_t DR;
+	volatile uint8_t PORT;
+	volatile uint8_t DDR;
+
+	SPI_SimRecordTypeDef Log[_SPI_SIM_LOG_SIZE];
+	uint16_t             Count;    /* Recorded bytes */
+	uint16_t             Dropped;  /* Bytes after the log was full */
+	uint16_t             Frames;   /* CS low periods */
+	uint16_t             Resets;   /* RESET pulses */
+	const void          *Lines;    /* Lines of the selected device */
+
+}SPI_SimTypeDef;
+
+/************************************** Variables **************************************/
+
+extern SPI_SimTypeDef SPI_Sim;
+
+/************************************** Prototype **************************************/
+
+void SPI_Sim_Write(uint8_t data); /* Record a byte with the D/C level */
+
+void SPI_Sim_Clear(void); /* Clear the log and counters */
+
+#endif /* __SPI_UNIT_SIM_H_ */
@@ -12,12 +12,21 @@
 ~ Attention  :    This module required HAL Driver. 
 
 ~ Changes    :
+				  Add : HAL_I2C_Mem_Write2_DMA function for write data by DMA.
+				  Add : HAL_I2C_Mem_WriteV     function for write data segments in one transaction.
+				  Add : HAL_I2C_Mem_WritePages function for write data page by page with ACK polling.
+				  Mod : HAL_I2C_Mem_Erase      writes page by page, stwc is the ACK polling limit.
 
 ------------------------------------------------------------------------------
 */
 
 #include "stm32_i2c.h"
 
+/* ------------------ Prototypes ----------------- */
+
+static HAL_StatusTypeDef HAL_I2C_WaitReady(I2C_HandleTypeDef *hi2c, uint32_t tickstart, uint32_t Timeout);
+static HAL_StatusTypeDef HAL_I2C_Mem_WaitWriteCycle(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t stwc, uint32_t Timeout);
+
 /* ------------------ Functions ------------------ */
 
 HAL_StatusTypeDef HAL_I2C_Mem_Write2(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout) /* This function is for write data to external memory */
@@ -73,6 +82,168 @@ HAL_StatusTypeDef HAL_I2C_Mem_Write2(I2C_HandleTypeDef *hi2c, uint16_t DevAddres
 			
 */
 
+HAL_StatusTypeDef HAL_I2C_Mem_WriteV(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, const I2C_SegmentTypeDef *pSegments, uint8_t Count, uint32_t Timeout) /* This function is for write data segments to external memory in one transaction */
+{
+
+	/* -------------------------------------------- */
+	
+	HAL_StatusTypeDef i2c_status; /* Create enum */
+	uint32_t tickstart = HAL_GetTick(); /* Start of timeout */
+	uint16_t dev_address; /* Device address with P0 bits */
+	uint8_t  mem_address[2]; /* Memory address bytes */
+	uint16_t mem_length; /* Memory address length */
+	uint8_t  last = 0; /* Segments until the last one with data */
+	uint8_t  counter; /* Segment counter */
+	
+	/* -------------------------------------------- */
+	
+	if ( MemAddSize == I2C_MEMADD_SIZE_8BIT ) /* Check memory address size */
+	{
+		dev_address    = _CALC_DEVADD_8BIT(DevAddress,MemAddress);
+		mem_address[0] = (uint8_t)MemAddress;
+		mem_length     = 1;
+	}
+	else
+	{
+		dev_address    = _CALC_DEVADD_16BIT(DevAddress,MemAddress);
+		mem_address[0] = (uint8_t)(MemAddress >> 8);
+		mem_address[1] = (uint8_t)MemAddress;
+		mem_length     = 2;
+	}
+	
+	for ( counter = 0 ; counter < Count ; counter++ ) /* Find last segment */
+	{
+		if ( pSegments[counter].Size > 0 )
+		{
+			last = counter + 1;
+		}
+	}
+	
+	/* ---------- Memory address opens the transaction ---------- */
+	
+	i2c_status = HAL_I2C_Master_Seq_Transmit_IT(hi2c , dev_address , mem_address , mem_length , (last == 0) ? I2C_FIRST_AND_LAST_FRAME : I2C_FIRST_FRAME); /* Send address */
+	
+	if ( i2c_status == HAL_OK )
+	{
+		i2c_status = HAL_I2C_WaitReady(hi2c , tickstart , Timeout); /* Wait for frame */
+	}
+	
+	/* --------------- Segments without repeated START --------------- */
+	
+	for ( counter = 0 ; (counter < last) && (i2c_status == HAL_OK) ; counter++ )
+	{
+		
+		if ( pSegments[counter].Size == 0 ) /* Nothing to send */
+		{
+			continue;
+		}
+		
+		i2c_status = HAL_I2C_Master_Seq_Transmit_IT(hi2c , dev_address , (uint8_t *)pSegments[counter].Data , pSegments[counter].Size , (counter == (last - 1)) ? I2C_LAST_FRAME : I2C_NEXT_FRAME); /* Send segment */
+		
+		if ( i2c_status == HAL_OK )
+		{
+			i2c_status = HAL_I2C_WaitReady(hi2c , tickstart , Timeout); /* Wait for frame */
+		}
+		
+	}
+	
+	return i2c_status;
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					hi2c       : Pointer to a I2C_HandleTypeDef structure that contains
+					             the configuration information for the specified I2C.
+					
+					DevAddress : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+
+					MemAddress : Internal memory address.
+					
+					MemAddSize : Size of internal memory address. this
+								   parameter is :
+												 I2C_MEMADD_SIZE_8BIT
+												 I2C_MEMADD_SIZE_16BIT
+					
+					pSegments  : Pointer to array of data segments.
+					Count      : Number of segments.
+					Timeout    : Timeout duration.
+	
+	Return Values :
+					HAL_OK / HAL_ERROR / HAL_BUSY / HAL_TIMEOUT
+	
+	Example       :
+					uint8_t com_stat;
+					I2C_SegmentTypeDef my_segments[2] = {{my_header , 4} , {my_data , 20}};
+					
+					com_stat = HAL_I2C_Mem_WriteV(&hi2c1 , 0xA0 , 75 , I2C_MEMADD_SIZE_16BIT , my_segments , 2 , 100); (0xA0 : Device Address)
+					
+					Segments are sent with HAL_I2C_Master_Seq_Transmit_IT,
+					the I2C event and error interrupts must be enabled.
+			
+*/
+
+#ifdef HAL_DMA_MODULE_ENABLED
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write2_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size) /* This function is for write data to external memory without blocking */
+{
+
+	/* -------------------------------------------- */
+	
+	HAL_StatusTypeDef i2c_status; /* Create enum */
+	
+	/* -------------------------------------------- */
+	
+	if ( MemAddSize == I2C_MEMADD_SIZE_8BIT ) /* Check memory address size */
+	{
+		i2c_status = HAL_I2C_Mem_Write_DMA(hi2c , _CALC_DEVADD_8BIT(DevAddress,MemAddress) , MemAddress , MemAddSize , pData , Size); /* Start transfer */
+	}
+	else
+	{
+		i2c_status = HAL_I2C_Mem_Write_DMA(hi2c , _CALC_DEVADD_16BIT(DevAddress,MemAddress) , MemAddress , MemAddSize , pData , Size); /* Start transfer */
+	}
+	
+	return i2c_status;
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					hi2c       : Pointer to a I2C_HandleTypeDef structure that contains
+					             the configuration information for the specified I2C.
+					
+					DevAddress : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+
+					MemAddress : Internal memory address.
+					
+					MemAddSize : Size of internal memory address. this
+								   parameter is :
+												 I2C_MEMADD_SIZE_8BIT
+												 I2C_MEMADD_SIZE_16BIT
+					
+					pData	   : Pointer to data buffer, must stay valid
+								 until the transfer complete callback.
+					Size	   : Amount of data to be sent.
+	
+	Return Values :
+					HAL_OK / HAL_ERROR / HAL_BUSY
+	
+	Example       :
+					uint8_t com_stat;
+					static uint8_t my_data[21] = "I AM Microcontroller";
+					
+					com_stat = HAL_I2C_Mem_Write2_DMA(&hi2c1 , 0xA0 , 75 , I2C_MEMADD_SIZE_16BIT , my_data , 20); (0xA0 : Device Address)
+					
+					Completion is reported by HAL_I2C_MemTxCpltCallback.
+			
+*/
+
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 HAL_StatusTypeDef HAL_I2C_Mem_Read2(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout) /* This function is for read data from external memory */
 {
 
@@ -133,6 +304,7 @@ HAL_StatusTypeDef HAL_I2C_Mem_Erase(I2C_HandleTypeDef *hi2c, uint16_t DevAddress
 	
 	uint8_t mem_def_val_set = 0; /* Memory default value counter */
 	uint8_t memory_def[_MEM_DEF_VAL_BUFF_LENGTH]; /* Memory default value */
+	uint16_t chunk; /* Bytes of one write */
 	
 	/* --------------------- Enum --------------------- */
 	
@@ -147,41 +319,102 @@ HAL_StatusTypeDef HAL_I2C_Mem_Erase(I2C_HandleTypeDef *hi2c, uint16_t DevAddress
 	
 	/* ................................................ */
 	
-	if (Size <= _MEM_DEF_VAL_BUFF_LENGTH) /* Check size */
+	while ( (Size > 0) && (i2c_status == HAL_OK) ) /* Check status */
 	{
 		
-		i2c_status = HAL_I2C_Mem_Write2(hi2c,DevAddress,MemAddress,MemAddSize,memory_def,Size,Timeout); /* Write to memory */
-		HAL_Delay(stwc); /* Delay for Self Timed Write Cycle */
+		chunk = _CALC_PAGE_REST(MemAddress); /* A write never crosses a page, it would wrap */
+		
+		if (chunk > _MEM_DEF_VAL_BUFF_LENGTH) /* Check size */
+		{
+			chunk = _MEM_DEF_VAL_BUFF_LENGTH;
+		}
+		
+		if (chunk > Size) /* Check size */
+		{
+			chunk = Size;
+		}
+		
+		i2c_status = HAL_I2C_Mem_Write2(hi2c,DevAddress,MemAddress,MemAddSize,memory_def,chunk,Timeout); /* Write to memory */
+		
+		if (i2c_status == HAL_OK) /* Check status */
+		{
+			i2c_status = HAL_I2C_Mem_WaitWriteCycle(hi2c,DevAddress,stwc,Timeout); /* Wait for Self Timed Write Cycle */
+		}
+		
+		MemAddress += chunk; /* Set new address */
+		Size       -= chunk; /* Set new size */
 		
 	}
-	else
+	
+	return i2c_status;
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					hi2c       : Pointer to a I2C_HandleTypeDef structure that contains
+					             the configuration information for the specified I2C.
+					
+					DevAddress : Target device address: The device 7 bits 
+								 address value in datasheet must be shift
+								 at right before call interface.
+
+					MemAddress : Internal memory address.
+					
+					MemAddSize : Size of internal memory address. this
+								   parameter is :
+												 I2C_MEMADD_SIZE_8BIT
+												 I2C_MEMADD_SIZE_16BIT
+					
+					Size       : Amount of data to be erase.
+					stwc       : Self timed write cycle, longest ACK polling
+								 after each page (ms).
+					Timeout    : Timeout duration.
+	
+	Return Values :
+					HAL_OK / HAL_ERROR / HAL_TIMEOUT (write cycle)
+	
+	Example       :
+					uint8_t com_stat;
+					
+					com_stat = HAL_I2C_Mem_Erase(&hi2c1 , 0xA0 , 75 , I2C_MEMADD_SIZE_16BIT , 10 , 5 , 100); (0xA0 : Device Address)
+			
+*/
+
+HAL_StatusTypeDef HAL_I2C_Mem_WritePages(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t stwc, uint32_t Timeout) /* This function is for write data to external memory page by page */
+{
+	
+	/* ------------------- Variable ------------------- */
+	
+	uint16_t chunk; /* Bytes of one write */
+	
+	/* --------------------- Enum --------------------- */
+	
+	HAL_StatusTypeDef i2c_status = HAL_OK; /* Create enum */
+	
+	/* ................................................ */
+	
+	while ( (Size > 0) && (i2c_status == HAL_OK) ) /* Check status */
 	{
 		
-		while ( (Size > 0) && (i2c_status == HAL_OK) ) /* Check status */
+		chunk = _CALC_PAGE_REST(MemAddress); /* A write never crosses a page, it would wrap */
+		
+		if (chunk > Size) /* Check size */
 		{
-			
-			if (Size >= _MEM_DEF_VAL_BUFF_LENGTH) /* Check size */
-			{
-				
-				i2c_status = HAL_I2C_Mem_Write2(hi2c,DevAddress,MemAddress,MemAddSize,memory_def,_MEM_DEF_VAL_BUFF_LENGTH,Timeout); /* Write to memory */
-				
-				MemAddress += _MEM_DEF_VAL_BUFF_LENGTH; /* Set new address */
-				Size       -= _MEM_DEF_VAL_BUFF_LENGTH; /* Set new size */
-				
-			}
-			else
-			{
-				
-				i2c_status = HAL_I2C_Mem_Write2(hi2c,DevAddress,MemAddress,MemAddSize,memory_def,Size,Timeout);  /* Write to memory */
-				
-				Size = 0; /* Reset value */
-				
-			}
-			
-			HAL_Delay(stwc); /* Delay for Self Timed Write Cycle */
-			
+			chunk = Size;
 		}
 		
+		i2c_status = HAL_I2C_Mem_Write2(hi2c,DevAddress,MemAddress,MemAddSize,pData,chunk,Timeout); /* Write to memory */
+		
+		if (i2c_status == HAL_OK) /* Check status */
+		{
+			i2c_status = HAL_I2C_Mem_WaitWriteCycle(hi2c,DevAddress,stwc,Timeout); /* Wait for Self Timed Write Cycle */
+		}
+		
+		MemAddress += chunk; /* Set new address */
+		pData      += chunk; /* Set new data */
+		Size       -= chunk; /* Set new size */
+		
 	}
 	
 	return i2c_status;
@@ -204,18 +437,58 @@ HAL_StatusTypeDef HAL_I2C_Mem_Erase(I2C_HandleTypeDef *hi2c, uint16_t DevAddress
 												 I2C_MEMADD_SIZE_8BIT
 												 I2C_MEMADD_SIZE_16BIT
 					
-					Size       : Amount of data to be read.
-					stwc       : Self timed write cycle.
+					pData	   : Pointer to data buffer.
+					Size	   : Amount of data to be sent.
+					stwc       : Self timed write cycle, longest ACK polling
+								 after each page (ms).
 					Timeout    : Timeout duration.
 	
 	Return Values :
-					HAL_OK / HAL_ERROR
+					HAL_OK / HAL_ERROR / HAL_TIMEOUT (write cycle)
 	
 	Example       :
 					uint8_t com_stat;
 					
-					com_stat = HAL_I2C_Mem_Erase(&hi2c1 , 0xA0 , 75 , I2C_MEMADD_SIZE_16BIT , 10 , 5 , 100); (0xA0 : Device Address)
+					com_stat = HAL_I2C_Mem_WritePages(&hi2c1 , 0xA0 , 0 , I2C_MEMADD_SIZE_16BIT , my_splash , 1024 , 5 , 100); (0xA0 : Device Address)
 			
-*/
+*/
 
+/* --------------- Static Functions -------------- */
+
+static HAL_StatusTypeDef HAL_I2C_WaitReady(I2C_HandleTypeDef *hi2c, uint32_t tickstart, uint32_t Timeout) /* Wait until the I2C frame is done */
+{
+	
+	while ( HAL_I2C_GetState(hi2c) != HAL_I2C_STATE_READY ) /* Frame is on the bus */
+	{
+		
+		if ( (HAL_GetTick() - tickstart) > Timeout ) /* Deadline */
+		{
+			return HAL_TIMEOUT;
+		}
+		
+	}
+	
+	return ( (HAL_I2C_GetError(hi2c) == HAL_I2C_ERROR_NONE) ? HAL_OK : HAL_ERROR );
+	
+}
+
+static HAL_StatusTypeDef HAL_I2C_Mem_WaitWriteCycle(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t stwc, uint32_t Timeout) /* ACK polling, the memory answers again after its write cycle */
+{
+	
+	uint32_t tickstart = HAL_GetTick(); /* Write cycle started with the STOP */
+	
+	while ( HAL_I2C_IsDeviceReady(hi2c , DevAddress , 1 , Timeout) != HAL_OK ) /* Address is not acknowledged while busy */
+	{
+		
+		if ( (HAL_GetTick() - tickstart) > stwc ) /* Longer than the worst case write cycle */
+		{
+			return HAL_TIMEOUT;
+		}
+		
+	}
+	
+	return HAL_OK;
+	
+}
+
 /* Program End */
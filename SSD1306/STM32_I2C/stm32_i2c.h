@@ -12,6 +12,10 @@
 ~ Attention  :    This module required HAL Driver.
 
 ~ Changes    :
+				  Add : HAL_I2C_Mem_Write2_DMA function for write data by DMA.
+				  Add : HAL_I2C_Mem_WriteV     function for write data segments in one transaction.
+				  Add : HAL_I2C_Mem_WritePages function for write data page by page with ACK polling.
+				  Mod : HAL_I2C_Mem_Erase      writes page by page, stwc is the ACK polling limit.
 
 ------------------------------------------------------------------------------
 */
@@ -95,6 +99,11 @@
 
 #define _CALC_DEVADD_8BIT(dev_add , mem_add)   ((dev_add) | (uint8_t)(((mem_add) >> _P0_SHIFT_VAL_MEMADD_SIZE_8BIT) & _P0_BIT_SEL_MEMADD_SIZE_8BIT)) /* Calculating new address */
 #define _CALC_DEVADD_16BIT(dev_add , mem_add)  ((dev_add) | (uint8_t)(((mem_add) >> _P0_SHIFT_VAL_MEMADD_SIZE_16BIT) & _P0_BIT_SEL_MEMADD_SIZE_16BIT)) /* Calculating new address */
+#define _CALC_PAGE_REST(mem_add)               (_MEM_PAGE_SIZE - ((mem_add) % _MEM_PAGE_SIZE)) /* Bytes up to the end of the page */
+
+#ifndef _MEM_PAGE_SIZE
+	#define _MEM_PAGE_SIZE 8 /* Smallest page of the 24Cxx family */
+#endif /* _MEM_PAGE_SIZE */
 
 /* -------------------------------- Buffer ------------------------------- */
 
@@ -106,6 +115,16 @@
 
 /**************************************** Enums ****************************************/
 
+/*************************************** Struct ****************************************/
+
+typedef struct /* Data segment */
+{
+	
+	const uint8_t *Data;
+	uint16_t       Size;
+	
+}I2C_SegmentTypeDef;
+
 /************************************** Prototype **************************************/
 
 HAL_StatusTypeDef HAL_I2C_Mem_Write2(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout); /* This function is for write data to external memory */
@@ -140,6 +159,79 @@ HAL_StatusTypeDef HAL_I2C_Mem_Write2(I2C_HandleTypeDef *hi2c, uint16_t DevAddres
 			
 */
 
+HAL_StatusTypeDef HAL_I2C_Mem_WriteV(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, const I2C_SegmentTypeDef *pSegments, uint8_t Count, uint32_t Timeout); /* This function is for write data segments to external memory in one transaction */
+/*
+	Parameters    :
+					hi2c       : Pointer to a I2C_HandleTypeDef structure that contains
+					             the configuration information for the specified I2C.
+					
+					DevAddress : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+
+					MemAddress : Internal memory address.
+					
+					MemAddSize : Size of internal memory address. this
+								   parameter is :
+												 I2C_MEMADD_SIZE_8BIT
+												 I2C_MEMADD_SIZE_16BIT
+					
+					pSegments  : Pointer to array of data segments.
+					Count      : Number of segments.
+					Timeout    : Timeout duration.
+	
+	Return Values :
+					HAL_OK / HAL_ERROR / HAL_BUSY / HAL_TIMEOUT
+	
+	Example       :
+					uint8_t com_stat;
+					I2C_SegmentTypeDef my_segments[2] = {{my_header , 4} , {my_data , 20}};
+					
+					com_stat = HAL_I2C_Mem_WriteV(&hi2c1 , 0xA0 , 75 , I2C_MEMADD_SIZE_16BIT , my_segments , 2 , 100); (0xA0 : Device Address)
+					
+					Segments are sent with HAL_I2C_Master_Seq_Transmit_IT,
+					the I2C event and error interrupts must be enabled.
+			
+*/
+
+#ifdef HAL_DMA_MODULE_ENABLED
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write2_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size); /* This function is for write data to external memory without blocking */
+/*
+	Parameters    :
+					hi2c       : Pointer to a I2C_HandleTypeDef structure that contains
+					             the configuration information for the specified I2C.
+					
+					DevAddress : Target device address: The device 7 bits 
+								  address value in datasheet must be shift
+								  at right before call interface.
+
+					MemAddress : Internal memory address.
+					
+					MemAddSize : Size of internal memory address. this
+								   parameter is :
+												 I2C_MEMADD_SIZE_8BIT
+												 I2C_MEMADD_SIZE_16BIT
+					
+					pData	   : Pointer to data buffer, must stay valid
+								 until the transfer complete callback.
+					Size	   : Amount of data to be sent.
+	
+	Return Values :
+					HAL_OK / HAL_ERROR / HAL_BUSY
+	
+	Example       :
+					uint8_t com_stat;
+					static uint8_t my_data[21] = "I AM Microcontroller";
+					
+					com_stat = HAL_I2C_Mem_Write2_DMA(&hi2c1 , 0xA0 , 75 , I2C_MEMADD_SIZE_16BIT , my_data , 20); (0xA0 : Device Address)
+					
+					Completion is reported by HAL_I2C_MemTxCpltCallback.
+			
+*/
+
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 HAL_StatusTypeDef HAL_I2C_Mem_Read2(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout); /* This function is for read data from external memory */
 /*
 	Parameters    :
@@ -189,12 +281,13 @@ HAL_StatusTypeDef HAL_I2C_Mem_Erase(I2C_HandleTypeDef *hi2c, uint16_t DevAddress
 												 I2C_MEMADD_SIZE_8BIT
 												 I2C_MEMADD_SIZE_16BIT
 					
-					Size       : Amount of data to be read.
-					stwc       : Self timed write cycle.
+					Size       : Amount of data to be erase.
+					stwc       : Self timed write cycle, longest ACK polling
+								 after each page (ms).
 					Timeout    : Timeout duration.
 	
 	Return Values :
-					HAL_OK / HAL_ERROR
+					HAL_OK / HAL_ERROR / HAL_TIMEOUT (write cycle)
 	
 	Example       :
 					uint8_t com_stat;
@@ -203,4 +296,38 @@ HAL_StatusTypeDef HAL_I2C_Mem_Erase(I2C_HandleTypeDef *hi2c, uint16_t DevAddress
 			
 */
 
+HAL_StatusTypeDef HAL_I2C_Mem_WritePages(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t stwc, uint32_t Timeout); /* This function is for write data to external memory page by page */
+/*
+	Parameters    :
+					hi2c       : Pointer to a I2C_HandleTypeDef structure that contains
+					             the configuration information for the specified I2C.
+					
+					DevAddress : Target device address: The device 7 bits 
+								 address value in datasheet must be shift
+								 at right before call interface.
+
+					MemAddress : Internal memory address.
+					
+					MemAddSize : Size of internal memory address. this
+								   parameter is :
+												 I2C_MEMADD_SIZE_8BIT
+												 I2C_MEMADD_SIZE_16BIT
+					
+					pData	   : Pointer to data buffer.
+					Size	   : Amount of data to be sent, split at the
+								 _MEM_PAGE_SIZE boundaries.
+					stwc       : Self timed write cycle, longest ACK polling
+								 after each page (ms).
+					Timeout    : Timeout duration.
+	
+	Return Values :
+					HAL_OK / HAL_ERROR / HAL_TIMEOUT (write cycle)
+	
+	Example       :
+					uint8_t com_stat;
+					
+					com_stat = HAL_I2C_Mem_WritePages(&hi2c1 , 0xA0 , 0 , I2C_MEMADD_SIZE_16BIT , my_splash , 1024 , 5 , 100); (0xA0 : Device Address)
+			
+*/
+
 #endif /* __stm32_i2c_H_ */
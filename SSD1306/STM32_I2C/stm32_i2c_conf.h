@@ -27,6 +27,8 @@
 
 #define _MEM_DEF_VAL_BUFF_LENGTH 50
 
+#define _MEM_PAGE_SIZE 8
+
 /*
 	Guide   :
 			  #define STM32Xx                    : STM32 Family.
@@ -35,12 +37,17 @@
 			  #define _MEM_DEF_VAL_BUFF_LENGTH x : Buffer length for erase memory.
 												   Increase length == Increase speed.
 			  
+			  #define _MEM_PAGE_SIZE x           : Write page of the memory (datasheet),
+												   writes are split at its boundaries.
+			  
 	Example :
 			  #define STM32H7
 			  
 			  #define _CONNECTED_I2C hi2c1
 			  
 			  #define _MEM_DEF_VAL_BUFF_LENGTH 100
+			  
+			  #define _MEM_PAGE_SIZE 32
 */
 
 #endif /* __I2C_EEPROM_CONF_H_ */
@@ -0,0 +1,245 @@
+/*
+------------------------------------------------------------------------------
+~ File   : stm32_spi.c
+~ Author : agent
+~ Version: V0.1.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+~ Description:    Support ARM (STM32) Microcontroller Series.
+
+~ Attention  :    This module required HAL Driver.
+
+~ Changes    :
+				  Add : HAL_SPI_DC_Write     function for send command/data with the D/C line.
+				  Add : HAL_SPI_DC_WriteV    function for send data segments under one chip select.
+				  Add : HAL_SPI_DC_Write_DMA function for send command/data by DMA.
+				  Add : HAL_SPI_DC_Release   function for release chip select after DMA.
+				  Add : HAL_SPI_DC_Reset     function for pulse the RESET line.
+
+------------------------------------------------------------------------------
+*/
+
+#include "stm32_spi.h"
+
+/* ------------------ Prototypes ----------------- */
+
+static void HAL_SPI_DC_Select(const SPI_LinesTypeDef *Lines, uint8_t DC);
+
+/* ------------------ Functions ------------------ */
+
+HAL_StatusTypeDef HAL_SPI_DC_Write(SPI_HandleTypeDef *hspi, const SPI_LinesTypeDef *Lines, uint8_t DC, uint8_t *pData, uint16_t Size, uint32_t Timeout) /* This function is for send command/data with the D/C line */
+{
+
+	/* -------------------------------------------- */
+	
+	HAL_StatusTypeDef spi_status; /* Create enum */
+	
+	/* -------------------------------------------- */
+	
+	HAL_SPI_DC_Select(Lines , DC); /* D/C, CS low */
+	
+	spi_status = HAL_SPI_Transmit(hspi , pData , Size , Timeout); /* Send Data */
+	
+	HAL_SPI_DC_Release(Lines); /* CS high */
+	
+	return spi_status;
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					hspi       : Pointer to a SPI_HandleTypeDef structure that contains
+					             the configuration information for the specified SPI.
+					
+					Lines      : Pointer to the D/C, CS and RESET lines.
+					
+					DC         : Level of D/C line. this parameter is :
+												 _SPI_DC_COMMAND
+												 _SPI_DC_DATA
+					
+					pData	   : Pointer to data buffer.
+					Size	   : Amount of data to be sent.
+					Timeout    : Timeout duration.
+	
+	Return Values :
+					HAL_OK / HAL_ERROR / HAL_BUSY / HAL_TIMEOUT
+	
+	Example       :
+					uint8_t com_stat;
+					uint8_t my_cmd[2] = {0x81,0x7F};
+					SPI_LinesTypeDef my_lines = {GPIOA , GPIO_PIN_1 , GPIOA , GPIO_PIN_2 , NULL , 0};
+					
+					com_stat = HAL_SPI_DC_Write(&hspi1 , &my_lines , _SPI_DC_COMMAND , my_cmd , 2 , 100);
+			
+*/
+
+HAL_StatusTypeDef HAL_SPI_DC_WriteV(SPI_HandleTypeDef *hspi, const SPI_LinesTypeDef *Lines, uint8_t DC, const SPI_SegmentTypeDef *pSegments, uint8_t Count, uint32_t Timeout) /* This function is for send data segments under one chip select */
+{
+
+	/* -------------------------------------------- */
+	
+	HAL_StatusTypeDef spi_status = HAL_OK; /* Create enum */
+	uint8_t counter; /* Segment counter */
+	
+	/* -------------------------------------------- */
+	
+	HAL_SPI_DC_Select(Lines , DC); /* D/C, CS low */
+	
+	for ( counter = 0 ; (counter < Count) && (spi_status == HAL_OK) ; counter++ ) /* Segments follow under the same CS */
+	{
+		
+		if ( pSegments[counter].Size == 0 ) /* Nothing to send */
+		{
+			continue;
+		}
+		
+		spi_status = HAL_SPI_Transmit(hspi , (uint8_t *)pSegments[counter].Data , pSegments[counter].Size , Timeout); /* Send segment */
+		
+	}
+	
+	HAL_SPI_DC_Release(Lines); /* CS high */
+	
+	return spi_status;
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					hspi       : Pointer to a SPI_HandleTypeDef structure that contains
+					             the configuration information for the specified SPI.
+					
+					Lines      : Pointer to the D/C, CS and RESET lines.
+					
+					DC         : Level of D/C line. this parameter is :
+												 _SPI_DC_COMMAND
+												 _SPI_DC_DATA
+					
+					pSegments  : Pointer to array of data segments.
+					Count      : Number of segments.
+					Timeout    : Timeout duration.
+	
+	Return Values :
+					HAL_OK / HAL_ERROR / HAL_BUSY / HAL_TIMEOUT
+	
+	Example       :
+					uint8_t com_stat;
+					SPI_SegmentTypeDef my_segments[2] = {{my_page0 , 20} , {my_page1 , 20}};
+					
+					com_stat = HAL_SPI_DC_WriteV(&hspi1 , &my_lines , _SPI_DC_DATA , my_segments , 2 , 100);
+			
+*/
+
+#ifdef HAL_DMA_MODULE_ENABLED
+
+HAL_StatusTypeDef HAL_SPI_DC_Write_DMA(SPI_HandleTypeDef *hspi, const SPI_LinesTypeDef *Lines, uint8_t DC, uint8_t *pData, uint16_t Size) /* This function is for send command/data by DMA */
+{
+
+	/* -------------------------------------------- */
+	
+	HAL_StatusTypeDef spi_status; /* Create enum */
+	
+	/* -------------------------------------------- */
+	
+	HAL_SPI_DC_Select(Lines , DC); /* D/C, CS low */
+	
+	spi_status = HAL_SPI_Transmit_DMA(hspi , pData , Size); /* Start transfer */
+	
+	if ( spi_status != HAL_OK ) /* Not started, no callback will release CS */
+	{
+		HAL_SPI_DC_Release(Lines);
+	}
+	
+	return spi_status;
+	
+	/* Function End */
+}
+/*
+	Parameters    :
+					hspi       : Pointer to a SPI_HandleTypeDef structure that contains
+					             the configuration information for the specified SPI.
+					
+					Lines      : Pointer to the D/C, CS and RESET lines.
+					
+					DC         : Level of D/C line. this parameter is :
+												 _SPI_DC_COMMAND
+												 _SPI_DC_DATA
+					
+					pData	   : Pointer to data buffer, must stay valid
+								 until the transfer complete callback.
+					Size	   : Amount of data to be sent.
+	
+	Return Values :
+					HAL_OK / HAL_ERROR / HAL_BUSY
+	
+	Example       :
+					uint8_t com_stat;
+					
+					com_stat = HAL_SPI_DC_Write_DMA(&hspi1 , &my_lines , _SPI_DC_DATA , my_buffer , 1024);
+					
+					Call HAL_SPI_DC_Release from HAL_SPI_TxCpltCallback.
+			
+*/
+
+#endif /* HAL_DMA_MODULE_ENABLED */
+
+void HAL_SPI_DC_Release(const SPI_LinesTypeDef *Lines) /* This function is for release chip select after DMA */
+{
+	
+	if ( Lines->CSPort != NULL ) /* CS is connected */
+	{
+		HAL_GPIO_WritePin(Lines->CSPort , Lines->CSPin , GPIO_PIN_SET);
+	}
+	
+}
+/*
+	Parameters    :
+					Lines      : Pointer to the D/C, CS and RESET lines.
+	
+	Return Values :
+	
+	Example       :
+					HAL_SPI_DC_Release(&my_lines);
+			
+*/
+
+void HAL_SPI_DC_Reset(const SPI_LinesTypeDef *Lines) /* This function is for pulse the RESET line */
+{
+	
+	if ( Lines->RSTPort != NULL ) /* RESET is connected */
+	{
+		
+		HAL_GPIO_WritePin(Lines->RSTPort , Lines->RSTPin , GPIO_PIN_RESET);
+		HAL_Delay(_SPI_RESET_PULSE_MS);
+		
+		HAL_GPIO_WritePin(Lines->RSTPort , Lines->RSTPin , GPIO_PIN_SET);
+		HAL_Delay(_SPI_RESET_PULSE_MS);
+		
+	}
+	
+}
+/*
+	Parameters    :
+					Lines      : Pointer to the D/C, CS and RESET lines.
+	
+	Return Values :
+	
+	Example       :
+					HAL_SPI_DC_Reset(&my_lines); (No effect when RSTPort is NULL)
+			
+*/
+
+/* --------------- Static Functions -------------- */
+
+static void HAL_SPI_DC_Select(const SPI_LinesTypeDef *Lines, uint8_t DC) /* Set D/C and select the device */
+{
+	
+	HAL_GPIO_WritePin(Lines->DCPort , Lines->DCPin , (DC == _SPI_DC_DATA) ? GPIO_PIN_SET : GPIO_PIN_RESET);
+	
+	if ( Lines->CSPort != NULL ) /* CS is connected */
+	{
+		HAL_GPIO_WritePin(Lines->CSPort , Lines->CSPin , GPIO_PIN_RESET);
+	}
+	
+}
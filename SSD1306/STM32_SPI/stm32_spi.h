@@ -0,0 +1,242 @@
+/*
+------------------------------------------------------------------------------
+~ File   : stm32_spi.h
+~ Author : agent
+~ Version: V0.1.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+~ Description:    Support ARM (STM32) Microcontroller Series.
+
+~ Attention  :    This module required HAL Driver.
+
+~ Changes    :
+				  Add : HAL_SPI_DC_Write     function for send command/data with the D/C line.
+				  Add : HAL_SPI_DC_WriteV    function for send data segments under one chip select.
+				  Add : HAL_SPI_DC_Write_DMA function for send command/data by DMA.
+				  Add : HAL_SPI_DC_Release   function for release chip select after DMA.
+				  Add : HAL_SPI_DC_Reset     function for pulse the RESET line.
+
+------------------------------------------------------------------------------
+*/
+
+#ifndef __STM32_SPI_H_
+#define __STM32_SPI_H_
+
+/*************************************** Include ***************************************/
+
+#include <stdint.h> /* Import standard integer type */
+#include <stddef.h> /* Import NULL */
+#include "stm32_spi_conf.h" /* Import config file */
+
+/* ------------------------------------------------------------------ */
+
+#ifdef USE_HAL_DRIVER  /* Check driver */
+
+	/* --------------- Check Mainstream series --------------- */
+
+	#ifdef STM32F0
+		#include "stm32f0xx_hal.h"       /* Import HAL library */
+	#elif defined(STM32F1)
+		#include "stm32f1xx_hal.h"       /* Import HAL library */
+	#elif defined(STM32F2)
+		#include "stm32f2xx_hal.h"       /* Import HAL library */
+	#elif defined(STM32F3)
+		#include "stm32f3xx_hal.h"       /* Import HAL library */
+	#elif defined(STM32F4)
+		#include "stm32f4xx_hal.h"       /* Import HAL library */
+	#elif defined(STM32F7)
+		#include "stm32f7xx_hal.h"       /* Import HAL library */
+	#elif defined(STM32G0)
+		#include "stm32g0xx_hal.h"       /* Import HAL library */
+	#elif defined(STM32G4)
+		#include "stm32g4xx_hal.h"       /* Import HAL library */
+
+	/* ------------ Check High Performance series ------------ */
+
+	#elif defined(STM32H7)
+		#include "stm32h7xx_hal.h"       /* Import HAL library */
+
+	/* ------------ Check Ultra low power series ------------- */
+
+	#elif defined(STM32L0)
+		#include "stm32l0xx_hal.h"       /* Import HAL library */
+	#elif defined(STM32L1)
+		#include "stm32l1xx_hal.h"       /* Import HAL library */
+	#elif defined(STM32L5)
+		#include "stm32l5xx_hal.h"       /* Import HAL library */
+	#elif defined(STM32L4)
+		#include "stm32l4xx_hal.h"       /* Import HAL library */
+	#elif defined(STM32H7)
+		#include "stm32h7xx_hal.h"       /* Import HAL library */
+	#else
+	#endif /* STM32F1 */
+	
+	/* ------------------------------------------------------- */
+	
+	#if defined ( __ICCARM__ ) /* ICCARM Compiler */
+	
+	#pragma diag_suppress=Pe177   /* Disable 'unused function' warning */
+	
+	#elif defined   (  __GNUC__  ) /* GNU Compiler */
+	
+	#pragma diag_suppress 177     /* Disable 'unused function' warning */
+	
+	#endif /* __ICCARM__ */
+
+#endif /* USE_HAL_DRIVER */
+
+/* ------------------------------------------------------------------ */
+
+/*************************************** Defines ***************************************/
+
+/* --------------------------------- D/C --------------------------------- */
+
+#define _SPI_DC_COMMAND              0 /* D/C level for command bytes */
+#define _SPI_DC_DATA                 1 /* D/C level for data bytes */
+
+/* -------------------------------- Timing ------------------------------- */
+
+#ifndef _SPI_RESET_PULSE_MS
+	#define _SPI_RESET_PULSE_MS      1 /* RESET low time, SSD1306 needs 3us */
+#endif
+
+/**************************************** Enums ****************************************/
+
+/*************************************** Struct ****************************************/
+
+typedef struct /* Data segment */
+{
+	
+	const uint8_t *Data;
+	uint16_t       Size;
+	
+}SPI_SegmentTypeDef;
+
+typedef struct /* Control lines of the device, NULL port = not connected */
+{
+	
+	GPIO_TypeDef *DCPort;
+	uint16_t      DCPin;
+	GPIO_TypeDef *CSPort;
+	uint16_t      CSPin;
+	GPIO_TypeDef *RSTPort;
+	uint16_t      RSTPin;
+	
+}SPI_LinesTypeDef;
+
+/************************************** Prototype **************************************/
+
+HAL_StatusTypeDef HAL_SPI_DC_Write(SPI_HandleTypeDef *hspi, const SPI_LinesTypeDef *Lines, uint8_t DC, uint8_t *pData, uint16_t Size, uint32_t Timeout); /* This function is for send command/data with the D/C line */
+/*
+	Parameters    :
+					hspi       : Pointer to a SPI_HandleTypeDef structure that contains
+					             the configuration information for the specified SPI.
+					
+					Lines      : Pointer to the D/C, CS and RESET lines.
+					
+					DC         : Level of D/C line. this parameter is :
+												 _SPI_DC_COMMAND
+												 _SPI_DC_DATA
+					
+					pData	   : Pointer to data buffer.
+					Size	   : Amount of data to be sent.
+					Timeout    : Timeout duration.
+	
+	Return Values :
+					HAL_OK / HAL_ERROR / HAL_BUSY / HAL_TIMEOUT
+	
+	Example       :
+					uint8_t com_stat;
+					uint8_t my_cmd[2] = {0x81,0x7F};
+					SPI_LinesTypeDef my_lines = {GPIOA , GPIO_PIN_1 , GPIOA , GPIO_PIN_2 , NULL , 0};
+					
+					com_stat = HAL_SPI_DC_Write(&hspi1 , &my_lines , _SPI_DC_COMMAND , my_cmd , 2 , 100);
+			
+*/
+
+HAL_StatusTypeDef HAL_SPI_DC_WriteV(SPI_HandleTypeDef *hspi, const SPI_LinesTypeDef *Lines, uint8_t DC, const SPI_SegmentTypeDef *pSegments, uint8_t Count, uint32_t Timeout); /* This function is for send data segments under one chip select */
+/*
+	Parameters    :
+					hspi       : Pointer to a SPI_HandleTypeDef structure that contains
+					             the configuration information for the specified SPI.
+					
+					Lines      : Pointer to the D/C, CS and RESET lines.
+					
+					DC         : Level of D/C line. this parameter is :
+												 _SPI_DC_COMMAND
+												 _SPI_DC_DATA
+					
+					pSegments  : Pointer to array of data segments.
+					Count      : Number of segments.
+					Timeout    : Timeout duration.
+	
+	Return Values :
+					HAL_OK / HAL_ERROR / HAL_BUSY / HAL_TIMEOUT
+	
+	Example       :
+					uint8_t com_stat;
+					SPI_SegmentTypeDef my_segments[2] = {{my_page0 , 20} , {my_page1 , 20}};
+					
+					com_stat = HAL_SPI_DC_WriteV(&hspi1 , &my_lines , _SPI_DC_DATA , my_segments , 2 , 100);
+			
+*/
+
+#ifdef HAL_DMA_MODULE_ENABLED
+
+HAL_StatusTypeDef HAL_SPI_DC_Write_DMA(SPI_HandleTypeDef *hspi, const SPI_LinesTypeDef *Lines, uint8_t DC, uint8_t *pData, uint16_t Size); /* This function is for send command/data by DMA */
+/*
+	Parameters    :
+					hspi       : Pointer to a SPI_HandleTypeDef structure that contains
+					             the configuration information for the specified SPI.
+					
+					Lines      : Pointer to the D/C, CS and RESET lines.
+					
+					DC         : Level of D/C line. this parameter is :
+												 _SPI_DC_COMMAND
+												 _SPI_DC_DATA
+					
+					pData	   : Pointer to data buffer, must stay valid
+								 until the transfer complete callback.
+					Size	   : Amount of data to be sent.
+	
+	Return Values :
+					HAL_OK / HAL_ERROR / HAL_BUSY
+	
+	Example       :
+					uint8_t com_stat;
+					
+					com_stat = HAL_SPI_DC_Write_DMA(&hspi1 , &my_lines , _SPI_DC_DATA , my_buffer , 1024);
+					
+					Call HAL_SPI_DC_Release from HAL_SPI_TxCpltCallback.
+			
+*/
+
+#endif /* HAL_DMA_MODULE_ENABLED */
+
+void HAL_SPI_DC_Release(const SPI_LinesTypeDef *Lines); /* This function is for release chip select after DMA */
+/*
+	Parameters    :
+					Lines      : Pointer to the D/C, CS and RESET lines.
+	
+	Return Values :
+	
+	Example       :
+					HAL_SPI_DC_Release(&my_lines);
+			
+*/
+
+void HAL_SPI_DC_Reset(const SPI_LinesTypeDef *Lines); /* This function is for pulse the RESET line */
+/*
+	Parameters    :
+					Lines      : Pointer to the D/C, CS and RESET lines.
+	
+	Return Values :
+	
+	Example       :
+					HAL_SPI_DC_Reset(&my_lines); (No effect when RSTPort is NULL)
+			
+*/
+
+#endif /* __STM32_SPI_H_ */
@@ -0,0 +1,41 @@
+/*
+------------------------------------------------------------------------------
+~ File   : stm32_spi_conf.h
+~ Author : agent
+~ Version: V0.1.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+~ Description:    Support ARM (STM32) Microcontroller Series.
+
+~ Attention  :    This module required HAL Driver.
+
+~ Changes    :
+				  Add : _SPI_RESET_PULSE_MS    RESET low time and wait after it.
+
+------------------------------------------------------------------------------
+*/
+
+#ifndef __STM32_SPI_CONF_H_
+#define __STM32_SPI_CONF_H_
+
+/* -------- Configuration -------- */
+
+#define STM32F1
+
+#define _SPI_RESET_PULSE_MS 1
+
+/*
+	Guide   :
+			  #define STM32Xx                 : STM32 Family.
+
+			  #define _SPI_RESET_PULSE_MS x   : RESET low time and wait after it (ms).
+
+	Example :
+			  #define STM32H7
+
+			  #define _SPI_RESET_PULSE_MS 1
+*/
+
+#endif /* __STM32_SPI_CONF_H_ */
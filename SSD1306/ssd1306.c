@@ -21,14 +21,132 @@
 #include "ssd1306.h"
 
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Variables ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-uint8_t GLCD_Buffer[_GLCD_SCREEN_WIDTH * _GLCD_SCREEN_LINES];
+#ifndef _GLCD_DIRECT_TEXT
+uint8_t GLCD_Buffer[_GLCD_BUFFER_SIZE];
+#endif /* _GLCD_DIRECT_TEXT */
+
+#ifdef _GLCD_TRIPLE_BUFFER
+static uint8_t GLCD_Frames[2][_GLCD_BUFFER_SIZE]; /* Published and shown frames of the main display */
+#endif /* _GLCD_TRIPLE_BUFFER */
 
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Struct ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 GLCD_TypeDef GLCD;
 
+static GLCD_CmdQueueTypeDef GLCD_CmdQueue;
+
+static GLCD_PlanTypeDef      GLCD_Plan;
+static GLCD_CostModelTypeDef GLCD_CostModel = {_GLCD_COST_TRANSACTION, 1};
+static uint16_t              GLCD_PacketSize = _GLCD_PACKET_SIZE;
+
+static const GLCD_TransportTypeDef *GLCD_Transport = _GLCD_TRANSPORT_DEFAULT;
+
+#ifdef _GLCD_DIRECT_TEXT
+static GLCD_DisplayTypeDef  GLCD_Main    = {NULL, _GLCD_DIRTY_INIT, {0}, {_GLCD_MEM_MODE_HORIZONTAL}, _GLCD_TRANSPORT_DEFAULT, 0, {0, 0, 0}, &GLCD_Profile_Default}; /* Drawing goes straight to GDDRAM */
+#else
+static GLCD_DisplayTypeDef  GLCD_Main    = {GLCD_Buffer, _GLCD_DIRTY_INIT, {0}, {_GLCD_MEM_MODE_HORIZONTAL}, _GLCD_TRANSPORT_DEFAULT, 0, {0, 0, 0}, &GLCD_Profile_Default __GLCD_LAYERS_INIT(GLCD_Buffer) __GLCD_TRIPLE_INIT(GLCD_Buffer, GLCD_Frames[0], GLCD_Frames[1])};
+#endif /* _GLCD_DIRECT_TEXT */
+static GLCD_DisplayTypeDef *GLCD_Display = &GLCD_Main; /* Selected display */
+
+#ifdef _GLCD_USE_DMA
+static GLCD_AsyncTypeDef     GLCD_Async;
+#endif /* _GLCD_USE_DMA */
+
+static GLCD_StepTypeDef GLCD_Step; /* Frame of GLCD_RenderStep */
+
+#ifdef _GLCD_LAYERS
+static uint8_t GLCD_LayerStage[_GLCD_LAYER_STAGE]; /* Composed bytes of one transfer */
+#endif /* _GLCD_LAYERS */
+
+#ifdef _GLCD_PAGE_MODE
+static GLCD_ListTypeDef GLCD_List; /* Draw calls, rasterised one page at a time */
+#endif /* _GLCD_PAGE_MODE */
+
+#ifdef _GLCD_DIRECT_TEXT
+static GLCD_RunTypeDef GLCD_Run; /* Glyph bytes waiting for GLCD_DirectWrite */
+#endif /* _GLCD_DIRECT_TEXT */
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Profiles ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+static const uint8_t GLCD_InitDefault[] =
+{
+	__GLCD_PROFILE(_GLCD_CMD_CHARGE_PUMP_ENABLE, _GLCD_PRECHARGE_DEF, _GLCD_CONTRAST_MAX,
+	               _GLCD_CMD_SEGMENT_REMAP_SET | 0x01, _GLCD_CMD_COM_OUTPUT_SCAN_DEC)
+};
+
+static const uint8_t GLCD_InitExternalVcc[] =
+{
+	__GLCD_PROFILE(_GLCD_CMD_CHARGE_PUMP_DISABLE, _GLCD_PRECHARGE_EXT_VCC, _GLCD_CONTRAST_EXT_VCC,
+	               _GLCD_CMD_SEGMENT_REMAP_SET | 0x01, _GLCD_CMD_COM_OUTPUT_SCAN_DEC)
+};
+
+static const uint8_t GLCD_InitRotated[] =
+{
+	__GLCD_PROFILE(_GLCD_CMD_CHARGE_PUMP_ENABLE, _GLCD_PRECHARGE_DEF, _GLCD_CONTRAST_MAX,
+	               _GLCD_CMD_SEGMENT_REMAP_SET, _GLCD_CMD_COM_OUTPUT_SCAN_INC)
+};
+
+const GLCD_ProfileTypeDef GLCD_Profile_Default     = {GLCD_InitDefault, sizeof(GLCD_InitDefault)};
+const GLCD_ProfileTypeDef GLCD_Profile_ExternalVcc = {GLCD_InitExternalVcc, sizeof(GLCD_InitExternalVcc)};
+const GLCD_ProfileTypeDef GLCD_Profile_Rotated     = {GLCD_InitRotated, sizeof(GLCD_InitRotated)};
+
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Prototypes ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 static void GLCD_BufferWrite(const uint8_t x, const uint8_t y, const uint8_t data);
 static uint8_t GLCD_BufferRead(const uint8_t x, const uint8_t y);
+static inline void GLCD_MarkDirty(const uint8_t line, const uint8_t startX, const uint8_t endX);
+static inline void GLCD_MarkClean(void);
+static uint32_t GLCD_DataCost(const uint16_t size);
+static uint32_t GLCD_RectCost(const GLCD_RectTypeDef *rect, const uint8_t commands);
+static uint8_t GLCD_NextTransfer(GLCD_CursorTypeDef *cursor, const GLCD_PlanTypeDef *plan, GLCD_TransferTypeDef *transfer, const uint16_t limit);
+static GLCD_StatusTypeDef GLCD_SendTransfer(const GLCD_TransferTypeDef *transfer);
+static GLCD_StatusTypeDef GLCD_EndTransfer(void);
+static GLCD_StatusTypeDef GLCD_SendPlan(GLCD_CursorTypeDef *cursor, const uint32_t budget);
+static void GLCD_StepAbort(void);
+#ifndef _GLCD_PAGE_MODE
+static void GLCD_PlanCommit(GLCD_PlanTypeDef *plan);
+#endif
+static uint8_t GLCD_PlanLine(const uint8_t line, const uint8_t fold, GLCD_RectTypeDef *span);
+static uint8_t GLCD_IsPending(GLCD_DisplayTypeDef *display);
+#ifdef _GLCD_PAGE_HASH
+static uint32_t GLCD_Hash(uint32_t hash, const uint8_t *data, uint8_t words);
+static void GLCD_HashPages(GLCD_DisplayTypeDef *display);
+#endif
+#ifdef _GLCD_TRIPLE_BUFFER
+static void GLCD_TripleTake(GLCD_DisplayTypeDef *display);
+static void GLCD_TripleMark(const uint8_t line, const uint8_t x);
+static void GLCD_TripleMerge(uint8_t *start, uint8_t *end, const uint8_t *addStart, const uint8_t *addEnd);
+static void GLCD_TripleClean(GLCD_TripleTypeDef *triple, const uint8_t frame);
+#endif
+#ifdef _GLCD_PAGE_FLIP
+static uint8_t GLCD_FlipBack(void);
+static void GLCD_FlipFold(void);
+static void GLCD_FlipLost(const GLCD_CursorTypeDef *cursor);
+static void GLCD_FlipReset(GLCD_DisplayTypeDef *display);
+#endif
+#ifdef _GLCD_PAGE_MODE
+static uint8_t GLCD_ListRecord(const uint8_t op, const uint8_t *args, const uint8_t size, const void *blob, const uint8_t blobSize);
+static void GLCD_ListRun(const uint8_t *entry);
+static void GLCD_ListReset(void);
+static GLCD_StatusTypeDef GLCD_ListRender(uint8_t pages);
+#endif
+#ifdef _GLCD_DIRECT_TEXT
+static GLCD_StatusTypeDef GLCD_DirectWrite(const uint16_t x, const uint8_t line, const uint8_t *data, uint16_t size, const uint8_t repeat);
+static void GLCD_RunBegin(void);
+static void GLCD_RunEnd(void);
+#endif
+#ifdef _GLCD_LAYERS
+static void GLCD_LayerRop(uint8_t *dst, const uint8_t *src, uint16_t size, const GLCD_RopTypeDef rop, const uint8_t invert);
+static void GLCD_LayerCompose(uint8_t *dst, const uint16_t offset, const uint16_t size);
+#endif
+static void GLCD_MarkPending(const GLCD_PlanTypeDef *plan, uint8_t rect);
+static void GLCD_MarkDrawn(void);
+static void GLCD_ShadowClear(GLCD_ShadowTypeDef *shadow);
+static void GLCD_ShadowSend(uint8_t *shadow, const uint8_t value, const uint8_t *commands, const uint8_t quantity);
+static void GLCD_Health(const GLCD_StatusTypeDef status);
+static void GLCD_Probe(void);
+#ifdef _GLCD_USE_DMA
+static GLCD_StatusTypeDef GLCD_AsyncStart(void);
+static GLCD_StatusTypeDef GLCD_AsyncNext(void);
+static uint8_t GLCD_AsyncDone(void *port);
+#endif /* _GLCD_USE_DMA */
 static inline void GLCD_DrawHLine(uint8_t startX, uint8_t endX, const uint8_t y, COLOR_TypeDef color);
 static inline void GLCD_DrawVLine(uint8_t startY, uint8_t endY, const uint8_t x, COLOR_TypeDef color);
 static void Int2bcd(int32_t value, char BCD[]);
@@ -37,7 +155,92 @@ static void Int2bcd(int32_t value, char BCD[]);
 /* :::::::::::::::::: Transmition ::::::::::::::::: */
 void GLCD_TransmitCommand(uint8_t command)
 {
-	_I2C_MEM_WRITE(0 << _GLCD_BIT_DC, I2C_MEMADD_SIZE_8BIT, &command, 1, _GLCD_COM_TIMEOUT_MS);
+	GLCD_QueueCommand(command);
+	GLCD_FlushCommands();
+}
+void GLCD_QueueCommand(const uint8_t command)
+{
+	
+	/* ~~~~~~~~~~~~~~~~~~ Send queue if full ~~~~~~~~~~~~~~~~~~ */
+	if (GLCD_CmdQueue.Count >= _GLCD_CMD_QUEUE_SIZE)
+	{
+		GLCD_FlushCommands();
+	}
+	
+	#ifdef _GLCD_USE_DMA
+	if (GLCD_CmdQueue.Count >= _GLCD_CMD_QUEUE_SIZE)
+	{
+		GLCD.Status = _GLCD_BUSY; // Still full while the DMA render runs, the command is dropped
+		return;
+	}
+	#endif /* _GLCD_USE_DMA */
+	
+	GLCD_CmdQueue.Buffer[GLCD_CmdQueue.Count++] = command;
+	
+}
+void GLCD_QueueCommands(const uint8_t *commands, uint8_t quantity)
+{
+	
+	for (; quantity > 0; quantity--)
+	{
+		GLCD_QueueCommand(*commands++);
+	}
+	
+}
+GLCD_StatusTypeDef GLCD_FlushCommands(void)
+{
+	
+	GLCD_StatusTypeDef   status = _GLCD_OK;
+	GLCD_TransferTypeDef transfer;
+	uint8_t              trial  = 0;
+	
+	/* ~~~~~~~~~~~~~ Display is offline, commands are dropped ~~~~~~~~~~~~~ */
+	if (GLCD_Display->Breaker.Open)
+	{
+		
+		GLCD_CmdQueue.Count = 0; // GLCD_Init after the recovery sets the display up again
+		
+		return _GLCD_OFFLINE;
+		
+	}
+	
+	#ifdef _GLCD_USE_DMA
+	if (GLCD_Async.Busy)
+	{
+		return _GLCD_BUSY; // Queue is kept, the next flush sends it
+	}
+	#endif /* _GLCD_USE_DMA */
+	
+	/* ~~~~~~~~~ Send all queued commands as one burst ~~~~~~~~~ */
+	if (GLCD_CmdQueue.Count > 0)
+	{
+		
+		transfer.Control         = _GLCD_CTRL_COMMAND;
+		transfer.Count           = 1;
+		transfer.Segment[0].Data = GLCD_CmdQueue.Buffer;
+		transfer.Segment[0].Size = GLCD_CmdQueue.Count;
+		
+		do
+		{
+			
+			status = GLCD_SendTransfer(&transfer);
+			
+			if (GLCD_EndTransfer() != _GLCD_OK)
+			{
+				status = _GLCD_ERROR;
+			}
+			
+		}
+		while ((status != _GLCD_OK) && (trial++ < _GLCD_RETRIES));
+		
+		GLCD_CmdQueue.Count = 0;
+		
+		GLCD_Health(status);
+		
+	}
+	
+	return status;
+	
 }
 void GLCD_TransmitData(const uint8_t data)
 {
@@ -48,1437 +251,4460 @@ void GLCD_TransmitData(const uint8_t data)
 void GLCD_Init(void)
 {
 	
-	/* ~~~~~~~~~~~~~~~~~~~~ I2C Init ~~~~~~~~~~~~~~~~~~~~ */
-	// I2C_Init();
-	
-	/* ~~~~~~~~~~~~~~~~~~~~ GLCD Init ~~~~~~~~~~~~~~~~~~~ */
-	GLCD_TransmitCommand(_GLCD_CMD_DISP_OFF); // 0xAE
-	
-	/* ..... Set Clock ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_DISP_CLK_DIV_RATIO_SET); // 0xD5
-	GLCD_TransmitCommand(_GLCD_SUGGEST_RATIO); // 0xF0
-	
-	/* ..... Set MUX Ratio ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_MULTIPLEX_RATIO_SET); // 0xA8
-	GLCD_TransmitCommand(_GLCD_SCREEN_HEIGHT - 1);
+	const GLCD_ProfileTypeDef *profile = GLCD_Display->Profile;
+	uint8_t                    index;
 	
-	/* ..... Set Display Offset ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_DISP_START_OFFSET_SET); // 0xD3
-	GLCD_TransmitCommand(0x00); //No offset
+	#ifdef _GLCD_USE_DMA
+	if (GLCD_Async.Busy)
+	{
+		GLCD.Status = _GLCD_BUSY; // Bus is owned by the DMA render
+		return;
+	}
+	#endif /* _GLCD_USE_DMA */
 	
-	/* ..... Enable Charge Pump Regulator ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_CHARGE_PUMP_SET); // 0x8D
-	GLCD_TransmitCommand(_GLCD_CMD_CHARGE_PUMP_ENABLE); // 0x14
+	/* ~~~~~~~~~~~~~~~~~~~~ Bus Init ~~~~~~~~~~~~~~~~~~~~ */
+	// I2C_Init(); / SPI_Init();
 	
-	/* ..... Set Display Start Line ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_DISP_START_LINE_SET | 0x00); // 0x40 | Start line
+	GLCD_ShadowClear(&GLCD_Display->Shadow);
 	
-	/* ..... Set Memory Address ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_MEM_ADD_SET); // 0x20
-	GLCD_TransmitCommand(0x00); // Horizontal Addressing - Operate like KS0108
+	GLCD_Display->Breaker.Open  = 0; // Init tries the display again
+	GLCD_Display->Breaker.Fails = 0;
 	
-	/* ..... Set Segment re-map ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_SEGMENT_REMAP_SET | 0x01); // 0xA0 - Left towards Right
+	GLCD_StepAbort(); // GDDRAM pointer is set up again
 	
-	/* ..... Set COM Output Scan Direction ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_COM_OUTPUT_SCAN_DEC); // 0xC8 - Up towards Down
+	if ((GLCD_Transport != NULL) && (GLCD_Transport->Init != NULL))
+	{
+		GLCD_Transport->Init(GLCD_Transport->Handle); // RESET pulse / trusted device
+	}
 	
-	/* ..... Set COM Pins hardware configuration ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_COM_PINS_SET); // 0xDA
+	/* ~~~~~~~~~~~~~~~~~~~~ GLCD Init ~~~~~~~~~~~~~~~~~~~ */
+	for (index = 0; index < profile->Size; index++)
+	{
+		GLCD_QueueCommand(pgm_read_byte(&profile->Commands[index])); // One burst while it fits the queue
+	}
 	
-	#if (_GLCD_SIZE == _GLCD_SIZE_128x64)
-		GLCD_TransmitCommand(_GLCD_CMD_SEQUENTIAL_COM_PIN_CFG); // Sequential COM pin configuration
-	#else 
-		GLCD_TransmitCommand(_GLCD_CMD_ALTERNATIVE_COM_PIN_CFG); //Alternative COM pin configuration
-	#endif
+	#ifdef _GLCD_INIT_CLEAR
 	
-	/* ..... Set Contrast Control ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_CONTRAST_SET); // 0x81
-	GLCD_TransmitCommand(_GLCD_CONTRAST_MAX);
+	/* ..... Blank GDDRAM before the panel is turned on ..... */
+	GLCD_FlushCommands();
+	GLCD_ClearGDDRAM();
 	
-	/* ..... Set Precharge Period ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_PRECHARGE_PERIOD_SET); // 0xD9
-	GLCD_TransmitCommand(_GLCD_PRECHARGE_DEF);
+	#endif /* _GLCD_INIT_CLEAR */
 	
-	/* ..... Set VCOM ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_VCOMH_DESELECT_LEVEL_SET); // 0xDB
-	GLCD_TransmitCommand(_GLCD_VCOMH_DESELECT_LEVEL_DEF);
+	GLCD_QueueCommand(_GLCD_CMD_DISP_ON); // 0xAF
 	
-	/* ..... Set Display ..... */
-	GLCD_TransmitCommand(_GLCD_CMD_DISP_ALL_ON_RESUME); // 0xA4
-	GLCD_TransmitCommand(_GLCD_CMD_DISP_NORMAL); // 0xA6
-	GLCD_TransmitCommand(_GLCD_CMD_SCROLL_DEACTIVE); // 0x2E
-	GLCD_TransmitCommand(_GLCD_CMD_DISP_ON); // 0xAF
+	/* ..... Send Init Sequence, the controller is in the state of __GLCD_PROFILE ..... */
+	if (GLCD_FlushCommands() == _GLCD_OK)
+	{
+		
+		GLCD_Display->Shadow.MemMode   = _GLCD_MEM_MODE_HORIZONTAL;
+		GLCD_Display->Shadow.Display   = _GLCD_CMD_DISP_ON;
+		GLCD_Display->Shadow.Inverse   = _GLCD_CMD_DISP_NORMAL;
+		GLCD_Display->Shadow.Scroll    = _GLCD_CMD_SCROLL_DEACTIVE;
+		GLCD_Display->Shadow.StartLine = 0;
+		GLCD_Display->Shadow.Offset    = 0;
+		
+	}
 	
 	/* ~~~~~~~~~~~~~~ Set Display Location ~~~~~~~~~~~~~~ */
 	GLCD_GotoXY(0, 0);
 	
+	/* ..... First render sends the whole buffer (the drawn part after a clear) ..... */
+	#ifndef _GLCD_INIT_CLEAR
+	GLCD_Invalidate();
+	#endif /* _GLCD_INIT_CLEAR */
+	
 	/* ..... Reset GLCD structure ..... */
 	GLCD.Mode = _GLCD_DISP_NON_INVERTED;
 	GLCD.X = GLCD.Y = GLCD.Font.Width = GLCD.Font.Height = GLCD.Font.Lines = 0;
 	
 }
 
-/* :::::::::::::::::::: Control ::::::::::::::::::: */
-void GLCD_Render(void)
+void GLCD_InitWarm(void)
 {
-	/* We have to send buffer as 16-byte packets
+	/* The panel kept power over an MCU reset: setup and GDDRAM are still valid
 	
-	Buffer Size:    Width * Height / Line_Height
-	Packet Size:    16
-	Loop Counter:   Buffer size / Packet Size      =
-	                = ((Width * Height) / 8) / 16  =
-	                = (Width / 16) * (Height / 8)  =
-	                = (Width >> 4) * (Height >> 3)
+	Bus:            Set up by the application, the RESET pulse is not sent
+	Render:         The first render sends the whole buffer and the addressing mode
 	
 	*/
 	
-	uint8_t buff_counter = 0;
-	uint8_t buff_loop    = (_GLCD_SCREEN_WIDTH >> _BIT_SHIFT_FOR_DEVIDE_BY_16) * (_GLCD_SCREEN_HEIGHT >> _BIT_SHIFT_FOR_DIVIDE_BY_8);
+	GLCD_Display->Breaker.Open  = 0;
+	GLCD_Display->Breaker.Fails = 0;
 	
-	/* ~~~~~~~~~~~~~~~~~~~~ Set Columns Add ~~~~~~~~~~~~~~~~~~~~ */
-	GLCD_TransmitCommand(_GLCD_CMD_COLUMN_ADD_SET); // 0x21
-	GLCD_TransmitCommand(0x00); // Start
-	GLCD_TransmitCommand(_GLCD_SCREEN_WIDTH - 1); // End
+	GLCD_StepAbort();
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~~ Set Rows Add ~~~~~~~~~~~~~~~~~~~~~ */
-	GLCD_TransmitCommand(_GLCD_CMD_PAGE_ADD_SET); // 0x22
-	GLCD_TransmitCommand(0x00); // Start
-	GLCD_TransmitCommand(_GLCD_SCREEN_LINES - 1); // End
+	GLCD_GotoXY(0, 0);
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~~ Send Buffer ~~~~~~~~~~~~~~~~~~~~~~ */
-	for (; buff_counter < buff_loop; buff_counter++)
-	{
-		_I2C_MEM_WRITE(1 << _GLCD_BIT_DC, I2C_MEMADD_SIZE_8BIT, &GLCD_Buffer[buff_counter << _GLCD_BUFF_SHIFT_FOR_PACKET], _GLCD_PACKET_SIZE, _GLCD_COM_TIMEOUT_MS);
-	}
+	GLCD_ShadowClear(&GLCD_Display->Shadow); // Registers are kept, but not known
+	GLCD_Invalidate();
+	
+	/* ..... Reset GLCD structure ..... */
+	GLCD.Mode = _GLCD_DISP_NON_INVERTED;
+	GLCD.X = GLCD.Y = GLCD.Font.Width = GLCD.Font.Height = GLCD.Font.Lines = 0;
 	
 }
 
-void GLCD_SetDisplay(const uint8_t on)
-{
-	GLCD_TransmitCommand(on ? _GLCD_CMD_DISP_ON : _GLCD_CMD_DISP_OFF);
-}
-
-void GLCD_SetContrast(const uint8_t contrast)
-{
-	GLCD_TransmitCommand(_GLCD_CMD_CONTRAST_SET);
-	GLCD_TransmitCommand(contrast);
-}
-
-void GLCD_Clear(void)
+void GLCD_SetProfile(const GLCD_ProfileTypeDef *profile)
 {
-	GLCD_FillScreen(_GLCD_WHITE);
+	GLCD_Display->Profile = (profile != NULL) ? profile : &GLCD_Profile_Default;
 }
 
-void GLCD_ClearLine(const uint8_t line)
+GLCD_StatusTypeDef GLCD_ClearGDDRAM(void)
 {
+	/* Zeros are sent from a _GLCD_CLEAR_BLOCK block, GLCD_Buffer is not read
 	
-	uint8_t column_counter = 0;
+	Packets:        GLCD_SetPacketSize, blocks are gathered when the transport can
+	Buffer:         Kept, its drawn part is sent by the next render
 	
-	/* ~~~~~~~~~~~~~~~~~~~~ Check Value ~~~~~~~~~~~~~~~~~~~~ */
-	if (line < _GLCD_SCREEN_LINES)
-	{
-		
-		/* :::::::::: Goto Line :::::::::: */
-		GLCD_GotoXY(0, line * _GLCD_SCREEN_LINE_HEIGHT);
-		
-		/* ::::::::: Fill Pixels ::::::::: */
-		for (column_counter = 0 ; column_counter < _GLCD_SCREEN_WIDTH ; column_counter++)
-		{
-			GLCD_BufferWrite(column_counter, GLCD.Y, _GLCD_WHITE);
-		}
-		
-	}
+	*/
 	
-}
-
-void GLCD_InvertScreen(void)
-{
+	static const uint8_t zeros[_GLCD_CLEAR_BLOCK] = {0};
 	
-	if (GLCD.Mode == _GLCD_DISP_INVERTED)
-	{
-		GLCD.Mode = _GLCD_DISP_NON_INVERTED;
-	}
-	else
+	GLCD_TransferTypeDef transfer;
+	GLCD_StatusTypeDef   status = _GLCD_OK;
+	uint16_t             left   = _GLCD_SCREEN_WIDTH * _GLCD_GDDRAM_LINES;
+	uint16_t             packet = (GLCD_PacketSize == _GLCD_PACKET_SIZE_FRAME) ? UINT16_MAX : GLCD_PacketSize;
+	uint16_t             size;
+	uint8_t              gather = ((GLCD_Transport != NULL) && (GLCD_Transport->WriteDataV != NULL)) ? _GLCD_SCREEN_LINES : 1;
+	
+	#ifdef _GLCD_USE_DMA
+	if (GLCD_Async.Busy)
 	{
-		GLCD.Mode = _GLCD_DISP_INVERTED;
+		return _GLCD_BUSY; // Bus is owned by the DMA render
 	}
-
-	GLCD_TransmitCommand(GLCD.Mode);
+	#endif /* _GLCD_USE_DMA */
 	
-}
-
-void GLCD_InvertRect(uint8_t startX, uint8_t startY, uint8_t endX, uint8_t endY)
-{
+	GLCD_StepAbort(); // GDDRAM pointer is moved
 	
-	uint8_t width;
-	uint8_t height;
-	uint8_t offset;
-	uint8_t mask;
-	uint8_t h;
-	uint8_t i;
-	uint8_t data;
+	/* ~~~~~~~~~~~~~~~~~~~~~~ Whole screen window ~~~~~~~~~~~~~~~~~~~~~~ */
+	GLCD_QueueCommand(_GLCD_CMD_MEM_ADD_SET); // 0x20
+	GLCD_QueueCommand(_GLCD_MEM_MODE_HORIZONTAL);
+	GLCD_QueueCommand(_GLCD_CMD_COLUMN_ADD_SET); // 0x21
+	GLCD_QueueCommand(0);
+	GLCD_QueueCommand(_GLCD_SCREEN_WIDTH - 1);
+	GLCD_QueueCommand(_GLCD_CMD_PAGE_ADD_SET); // 0x22
+	GLCD_QueueCommand(0);
+	GLCD_QueueCommand(_GLCD_GDDRAM_LINES - 1); // Both halves with _GLCD_PAGE_FLIP
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */
-	width   = endX - startX + 1;
-	height  = endY - startY + 1;
-	offset  = startY % _GLCD_SCREEN_LINE_HEIGHT;
-	startY -= offset;
-	mask    = 0xFF;
-	data    = 0;
+	status = GLCD_FlushCommands();
 	
-	/* ~~~~~~~~~~~ Calculate mask for top fractioned region ~~~~~~~~~~ */
-	if (height < (_GLCD_SCREEN_LINE_HEIGHT - offset))
-	{
-		mask >>= (_GLCD_SCREEN_LINE_HEIGHT - height);
-		h = height;
-	}
-	else
+	if (status != _GLCD_OK)
 	{
-		h = _GLCD_SCREEN_LINE_HEIGHT - offset;
+		return status; // Offline or NACK, the window is not set
 	}
 	
-	mask <<= offset;
-	
-	/* ~~~~~~~~ Draw fractional rows at the top of the region ~~~~~~~~ */
-	GLCD_GotoXY(startX, startY);
+	GLCD_Display->Shadow.MemMode = _GLCD_MEM_MODE_HORIZONTAL;
+	GLCD_Display->Shadow.Window.StartX = _GLCD_SHADOW_UNKNOWN; // Pointer leaves the window start
 	
-	for (i = 0; i < width; i++)
-	{
-		
-		data = GLCD_BufferRead(GLCD.X, GLCD.Y);
-		data = ((~data) & mask) | (data & (~mask));
-		
-		GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
-		
-	}
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~ Zero packets ~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	transfer.Control = _GLCD_CTRL_DATA;
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~ Full rows ~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	while ((h + _GLCD_SCREEN_LINE_HEIGHT) <= height)
+	while (left > 0)
 	{
 		
-		h      += _GLCD_SCREEN_LINE_HEIGHT;
-		startY += _GLCD_SCREEN_LINE_HEIGHT;
-		
-		GLCD_GotoXY(startX, startY);
+		transfer.Count = 0;
+		size           = 0;
 		
-		for (i=0; i < width; i++)
+		while ((left > 0) && (transfer.Count < gather) && (size < packet))
 		{
 			
-			data = ~GLCD_BufferRead(GLCD.X, GLCD.Y);
+			transfer.Segment[transfer.Count].Data = zeros;
+			transfer.Segment[transfer.Count].Size = __GLCD_Min(__GLCD_Min(left, (uint16_t)_GLCD_CLEAR_BLOCK), (uint16_t)(packet - size));
 			
-			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
+			size += transfer.Segment[transfer.Count].Size;
+			left -= transfer.Segment[transfer.Count].Size;
+			transfer.Count++;
 			
 		}
 		
+		if (GLCD_SendTransfer(&transfer) != _GLCD_OK)
+		{
+			status = _GLCD_ERROR;
+		}
+		
 	}
 	
-	/* ~~~~~~~~~ Fractional rows at the bottom of the region ~~~~~~~~~ */
-	if (h < height)
+	if (GLCD_EndTransfer() != _GLCD_OK)
+	{
+		status = _GLCD_ERROR;
+	}
+	
+	GLCD_Health(status);
+	
+	/* ~~~~~~~~~~~~~~~ Only what is drawn differs from GDDRAM ~~~~~~~~~~~~~~~ */
+	if (status == _GLCD_OK)
 	{
 		
-		mask = ~(0xFF << (height - h));
+		GLCD_Display->Shadow.Window.StartX    = 0; // Pointer wrapped to the window start
+		GLCD_Display->Shadow.Window.EndX      = _GLCD_SCREEN_WIDTH - 1;
+		GLCD_Display->Shadow.Window.StartLine = 0;
+		GLCD_Display->Shadow.Window.EndLine   = _GLCD_GDDRAM_LINES - 1;
 		
-		GLCD_GotoXY(startX, (startY + _GLCD_SCREEN_LINE_HEIGHT));
-
-		for (i = 0; i < width; i++)
-		{
-			
-			data = GLCD_BufferRead(GLCD.X, GLCD.Y);
-			data = ((~data) & mask) | (data & (~mask));
-			
-			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
-			
-		}
+		GLCD_MarkClean();
+		GLCD_MarkDrawn();
 		
+		#ifdef _GLCD_PAGE_FLIP
+		GLCD_FlipReset(GLCD_Display); // Both halves are blank
+		#endif
+		
+	}
+	else
+	{
+		GLCD_Invalidate(); // GDDRAM is not known
 	}
 	
+	return status;
+	
 }
 
-GLCD_StatusTypeDef GLCD_Status(void)
-{
-	return (GLCD.Status);
-}
-
-/* ::::::::::::::::::: Location ::::::::::::::::::: */
-void GLCD_GotoX(const uint8_t x)
+void GLCD_SetTransport(const GLCD_TransportTypeDef *transport)
 {
-	if (x < _GLCD_SCREEN_WIDTH)
+	
+	#ifdef _GLCD_USE_DMA
+	if (GLCD_Async.Busy)
 	{
-		GLCD.X = x;
+		GLCD.Status = _GLCD_BUSY; // Bus is owned by the DMA render, the transport is kept
+		return;
 	}
-}
-
-void GLCD_GotoY(const uint8_t y)
-{
-	if (GLCD.Y < _GLCD_SCREEN_HEIGHT)
+	#endif /* _GLCD_USE_DMA */
+	
+	GLCD_EndTransfer(); // Close what the old transport holds open
+	
+	GLCD_Transport          = transport;
+	GLCD_Display->Transport = transport;
+	
+	/* ~~~~~~~~~~~~~ Planner follows the cost of the new bus ~~~~~~~~~~~~~ */
+	if ((transport != NULL) && (transport->Overhead != 0))
 	{
-		GLCD.Y = y;
+		GLCD_CostModel.Transaction = transport->Overhead;
 	}
+	
 }
 
-void GLCD_GotoXY(const uint8_t x, const uint8_t y)
+const GLCD_TransportTypeDef *GLCD_GetTransport(void)
 {
-	GLCD_GotoX(x);
-	GLCD_GotoY(y);
+	return GLCD_Transport;
 }
 
-void GLCD_GotoLine(const uint8_t line)
+void GLCD_InitDisplay(GLCD_DisplayTypeDef *display, uint8_t *buffer, const GLCD_TransportTypeDef *transport, const uint8_t group)
 {
-	if (line < _GLCD_SCREEN_LINES)
+	
+	uint16_t index = 0;
+	
+	display->Buffer    = buffer;
+	display->Transport = transport;
+	display->Group     = group;
+	
+	GLCD_ShadowClear(&display->Shadow);
+	
+	display->Breaker.Fails     = 0;
+	display->Breaker.Open      = 0;
+	display->Breaker.Countdown = 0;
+	display->Profile           = &GLCD_Profile_Default;
+	
+	#ifndef _GLCD_DIRECT_TEXT
+	for (; index < _GLCD_BUFFER_SIZE; index++)
 	{
-		GLCD.Y = line * _GLCD_SCREEN_LINE_HEIGHT;
+		buffer[index] = _GLCD_WHITE;
 	}
+	#endif /* _GLCD_DIRECT_TEXT */
+	
+	for (index = 0; index < _GLCD_SCREEN_LINES; index++)
+	{
+		display->Dirty.Start[index] = _GLCD_DIRTY_NONE;
+		display->Dirty.End[index]   = 0;
+	}
+	
+	#ifdef _GLCD_PAGE_HASH
+	for (index = 0; index < (_GLCD_SCREEN_LINES * _GLCD_HASH_SEGMENTS); index++)
+	{
+		display->Dirty.Hash[index] = 0;
+	}
+	#endif
+	
+	#ifdef _GLCD_PAGE_FLIP
+	GLCD_FlipReset(display);
+	#endif
+	
+	#ifdef _GLCD_LAYERS
+	display->Layers.Layer  = NULL;
+	display->Layers.Count  = 0;
+	display->Layers.Canvas = buffer;
+	#endif
+	
+	#ifdef _GLCD_TRIPLE_BUFFER
+	display->Triple.Frame[0] = display->Triple.Frame[1] = display->Triple.Frame[2] = buffer; // GLCD_SetFrames adds the other two
+	display->Triple.Ready    = 1;
+	display->Triple.Draw     = 0;
+	display->Triple.Show     = 2;
+	
+	for (index = 0; index < 3; index++)
+	{
+		GLCD_TripleClean(&display->Triple, (uint8_t)index);
+	}
+	#endif
+	
+	/* ..... Same state as after GLCD_Init ..... */
+	display->State        = GLCD;
+	display->State.Status = _GLCD_OK;
+	display->State.Mode   = _GLCD_DISP_NON_INVERTED;
+	display->State.X      = display->State.Y = 0;
+	display->State.Font.Name  = NULL;
+	display->State.Font.Width = display->State.Font.Height = display->State.Font.Lines = 0;
+	
 }
 
-uint8_t GLCD_GetX(void)
-{
-	return GLCD.X;
-}
-
-uint8_t GLCD_GetY(void)
+void GLCD_Select(GLCD_DisplayTypeDef *display)
 {
-	return GLCD.Y;
-}
-
-uint8_t GLCD_GetLine(void)
-{
-	return (__GLCD_GetLine(GLCD.Y));
+	/* Drawing, GLCD_Init and GLCD_Render work on the selected display
+	
+	NULL:           GLCD_Buffer and the transport of GLCD_SetTransport
+	Switch:         Queued commands and open transfers go to the old display first
+	
+	*/
+	
+	if (display == NULL)
+	{
+		display = &GLCD_Main;
+	}
+	
+	if (display == GLCD_Display)
+	{
+		return;
+	}
+	
+	#ifdef _GLCD_USE_DMA
+	if (GLCD_Async.Busy)
+	{
+		GLCD.Status = _GLCD_BUSY; // Bus is owned by the DMA render, the selection is kept
+		return;
+	}
+	#endif /* _GLCD_USE_DMA */
+	
+	GLCD_StepAbort(); // Plan belongs to the old display
+	GLCD_FlushCommands();
+	GLCD_EndTransfer();
+	
+	GLCD_Display->State = GLCD;
+	
+	GLCD_Display   = display;
+	GLCD           = display->State;
+	GLCD_Transport = display->Transport;
+	
+	if ((GLCD_Transport != NULL) && (GLCD_Transport->Overhead != 0))
+	{
+		GLCD_CostModel.Transaction = GLCD_Transport->Overhead;
+	}
+	
 }
 
-/* :::::::::::::::::: Print data :::::::::::::::::: */
-uint8_t GLCD_GetWidthChar(const char character)
+GLCD_DisplayTypeDef *GLCD_GetDisplay(void)
 {
-	/* +1 for space after each character */
-	return (pgm_read_byte(&(GLCD.Font.Name[(character - 32) * (GLCD.Font.Width * GLCD.Font.Lines + 1)])) + 1);
+	return ((GLCD_Display == &GLCD_Main) ? NULL : GLCD_Display);
 }
 
-uint16_t GLCD_GetWidthString(const char *text)
+uint8_t *GLCD_DrawBuffer(void)
 {
+	/* Frame the drawing functions write to, on the selected display
 	
-	uint16_t width = 0;
-
-	while (*text)
-	{
-		width += GLCD_GetWidthChar(*text++);
-	}
+	Triple Buffer:  Changes with every GLCD_Publish, GLCD_Buffer is only the first frame
+	Layers:         Buffer of GLCD_DrawLayer
+	Page Mode:      The page being rasterised, not a frame
+	Direct Text:    NULL, drawing goes straight to GDDRAM
 	
-	return width;
+	*/
+	
+	return __GLCD_Canvas(GLCD_Display);
 	
 }
 
-uint16_t GLCD_GetWidthString_P(const char *text)
+/* :::::::::::::::::::: Control ::::::::::::::::::: */
+void GLCD_Render(void)
 {
+	/* Dirty spans are turned into a plan, the plan into transfers
+	
+	Full Frame:     0x21 0 Width-1 / 0x22 0 Lines-1, whole buffer
+	Window:         0x21 StartX EndX / 0x22 StartLine EndLine per rectangle
+	Page:           0xB0|Line 0x00|Low 0x10|High per span
+	Packet Size:    GLCD_SetPacketSize (_GLCD_PACKET_SIZE_FRAME = one transaction per run)
+	Error:          The failed packet is sent again after new addressing, _GLCD_RETRIES times,
+	                then the rest is kept dirty for the next render
+	Offline:        After _GLCD_BREAKER_FAILS failed bursts only a probe is sent,
+	                every _GLCD_PROBE_INTERVAL calls; GLCD_Init and a full frame follow it
+	Page Flip:      With _GLCD_PAGE_FLIP the frame goes to the hidden GDDRAM half,
+	                0x40|Line shows it once the last packet is sent
+	Page Mode:      With _GLCD_PAGE_MODE each dirty page is rasterised from the
+	                display list and sent before the next one
+	DMA:            GLCD_Status is _GLCD_BUSY while GLCD_RenderAsync owns the bus,
+	                nothing is sent; commands kept meanwhile go first
 	
-	uint16_t width = 0;
+	*/
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */
-	char r = pgm_read_byte(text++);
-
-	while (r)
+	#ifndef _GLCD_PAGE_MODE
+	GLCD_CursorTypeDef cursor;
+	#endif /* _GLCD_PAGE_MODE */
+	
+	#ifdef _GLCD_USE_DMA
+	if (GLCD_Async.Busy)
+	{
+		GLCD.Status = _GLCD_BUSY; // Bus is owned by the DMA render
+		return;
+	}
+	#endif /* _GLCD_USE_DMA */
+	
+	GLCD_StepAbort(); // A stepped frame is folded into this one
+	GLCD_FlushCommands();
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~ Circuit Breaker ~~~~~~~~~~~~~~~~~~~~~~ */
+	if (GLCD_Display->Breaker.Open)
 	{
 		
-		width += GLCD_GetWidthChar(r);
+		GLCD_Probe();
 		
-		r = pgm_read_byte(text++);
+		if (GLCD_Display->Breaker.Open)
+		{
+			return;
+		}
 		
 	}
 	
-	return width;
+	#ifdef _GLCD_PAGE_MODE
 	
-}
-
-void GLCD_PutChar(char character)
-{
+	GLCD_ListRender(_GLCD_SCREEN_LINES);
 	
-	/* If it doesn't work, replace pgm_read_byte with pgm_read_word */
-	uint16_t fontStart    = 0;
-	uint16_t fontRead     = 0;
-	uint16_t fontReadPrev = 0;
+	#else
 	
-	uint8_t x        = 0;
-	uint8_t y        = 0;
-	uint8_t y2       = 0;
-	uint8_t i        = 0;
-	uint8_t j        = 0;
-	uint8_t width    = 0;
-	uint8_t overflow = 0;
-	uint8_t data     = 0;
-	uint8_t dataPrev = 0;
+	/* ~~~~~~~~~~~~~~~~~~~~~~ Make Plan ~~~~~~~~~~~~~~~~~~~~~~~~ */
+	GLCD_PlanCommit(&GLCD_Plan);
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~ Save current position ~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	x = GLCD.X;
-	y = y2 = GLCD.Y;
+	/* ~~~~~~~~~~~~~~~~~~~~~~ Send Plan ~~~~~~~~~~~~~~~~~~~~~~~~ */
+	cursor.Rect   = 0;
+	cursor.Setup  = _GLCD_SETUP_RECT;
+	cursor.Trial  = 0;
+	cursor.Gather = ((GLCD_Transport != NULL) && (GLCD_Transport->WriteDataV != NULL)) ? _GLCD_SCREEN_LINES : 1;
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~ Remove leading empty characters ~~~~~~~~~~~~~~~~~~~~~ */
-	character -= 32; // 32 is the ASCII of the first printable character
+	GLCD_SendPlan(&cursor, _GLCD_BUDGET_NONE);
 	
-	/* ~~~~~~~~~~~~ Find the start of the character in the font array ~~~~~~~~~~~~ */
-	fontStart = character * (GLCD.Font.Width * GLCD.Font.Lines + 1); // +1 due to first byte of each array line being the width
+	#endif /* _GLCD_PAGE_MODE */
 	
-	/* ~~~~ Update width-First byte of each line is the width of the character ~~~ */
-	width = pgm_read_byte(&(GLCD.Font.Name[fontStart++]));
+}
+
+GLCD_StatusTypeDef GLCD_RenderStep(const uint16_t budget)
+{
+	/* Part of a render, the bus is free again when it returns
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~~~~ Calculate overflowing bits ~~~~~~~~~~~~~~~~~~~~~~~ */
-	overflow = GLCD.Y % _GLCD_SCREEN_LINE_HEIGHT;
+	Budget:         Bus bytes of this step, payload plus the transaction cost of
+	                GLCD_SetCostModel (__GLCD_BUDGET_US converts a time);
+	                one transfer is always sent, packets are cut to the budget
+	Frame:          Planned at the first step, drawing meanwhile goes to the next frame
+	Return:         _GLCD_BUSY while the frame has packets left, _GLCD_OK when it is
+	                complete, _GLCD_ERROR / _GLCD_OFFLINE like GLCD_Render
+	Page Mode:      One page per step, the budget is not used
+	DMA:            _GLCD_BUSY while GLCD_RenderAsync owns the bus, nothing is sent
 	
-	/* ~~~~~~~~~~~~~~~ Print the character / Scan the lines needed ~~~~~~~~~~~~~~~ */
-	for (j = 0; j < GLCD.Font.Lines; j++)
+	*/
+	
+	#ifdef _GLCD_USE_DMA
+	if (GLCD_Async.Busy)
+	{
+		return _GLCD_BUSY; // Bus is owned by the DMA render
+	}
+	#endif /* _GLCD_USE_DMA */
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~ Start a frame ~~~~~~~~~~~~~~~~~~~~~~~~ */
+	if (!GLCD_Step.Active)
 	{
 		
-		/* ::::::::::: Go to the start of the line ::::::::::: */
-		GLCD_GotoXY(x, y);
-		
-		/* ::::: Update the indices for reading the line ::::: */
-		fontRead     = fontStart + j;
-		fontReadPrev = fontRead - 1;
-		
-		/* ::::::::::: Scan bytes of selected line ::::::::::: */
-		for (i = 0 ; i < width ; i++)
+		if (GLCD_Display->Breaker.Open)
 		{
 			
-			/* ----------------- Read Byte --------------- */
-			data = pgm_read_byte(&(GLCD.Font.Name[fontRead]));
-			
-			/* ---------------- Shift Byte --------------- */
-			data <<= overflow;
-			
-			/* ------- Merge byte with previous one ------ */
-			if (j > 0)
-			{
-				dataPrev       = pgm_read_byte(&(GLCD.Font.Name[fontReadPrev]));
-				dataPrev     >>= _GLCD_SCREEN_LINE_HEIGHT - overflow;
-				data          |= dataPrev;
-				fontReadPrev  += GLCD.Font.Lines;
-			}
+			GLCD_Probe();
 			
-			/* ----- Edit byte depending on the mode ----- */
-			if (GLCD.Font.Mode == _GLCD_PRINT_MODE_MERGE)
+			if (GLCD_Display->Breaker.Open)
 			{
-				data |= GLCD_BufferRead(GLCD.X, GLCD.Y);
+				return _GLCD_OFFLINE;
 			}
 			
-			/* ----------------- Send Byte --------------- */
-			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
-			
-			/* -------------- Increase index ------------- */
-			fontRead += GLCD.Font.Lines;
-			
 		}
 		
-		/* :::::: Send an empty column of 1px in the end ::::: */
-		if (GLCD.Font.Mode == _GLCD_PRINT_MODE_OVERWRITE)
+		GLCD_FlushCommands();
+		
+		#ifdef _GLCD_PAGE_MODE
+		
+		return GLCD_ListRender(1); // Steps never stay active in page mode
+		
+		#else
+		
+		GLCD_PlanCommit(&GLCD_Plan);
+		
+		if (GLCD_Plan.Count == 0)
 		{
-			GLCD_BufferWrite(GLCD.X, GLCD.Y, _GLCD_WHITE);
+			return _GLCD_OK;
 		}
 		
-		/* :::::::::::::: Increase line counter :::::::::::::: */
-		y += _GLCD_SCREEN_LINE_HEIGHT;
+		GLCD_Step.Cursor.Rect   = 0;
+		GLCD_Step.Cursor.Setup  = _GLCD_SETUP_RECT;
+		GLCD_Step.Cursor.Trial  = 0;
+		GLCD_Step.Cursor.Gather = ((GLCD_Transport != NULL) && (GLCD_Transport->WriteDataV != NULL)) ? _GLCD_SCREEN_LINES : 1;
+		GLCD_Step.Active        = 1;
+		
+		#endif /* _GLCD_PAGE_MODE */
 		
 	}
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~~~ Update last line, if needed  ~~~~~~~~~~~~~~~~~~~~~~ */
-	//if (LINE_STARTING != LINE_ENDING)
-	if (__GLCD_GetLine(y2) != __GLCD_GetLine(y2 + GLCD.Font.Height))
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~ Continue it ~~~~~~~~~~~~~~~~~~~~~~~~ */
+	GLCD_Step.Status = GLCD_SendPlan(&GLCD_Step.Cursor, budget);
+	
+	if (GLCD_Step.Status != _GLCD_BUSY)
+	{
+		GLCD_Step.Active = 0;
+	}
+	
+	return GLCD_Step.Status;
+	
+}
+
+uint8_t GLCD_RenderDisplays(GLCD_DisplayTypeDef *const *displays, const uint8_t count)
+{
+	/* Pending displays are rendered group by group, lowest group first
+	
+	Group:          Mux channel of the display (__GLCD_MUX_GROUP), so a pass
+	                selects each channel once
+	Selection:      The selected display is restored at the end
+	
+	*/
+	
+	GLCD_DisplayTypeDef *selected = GLCD_GetDisplay();
+	uint16_t             group    = 0;
+	uint16_t             next;
+	uint8_t              index;
+	uint8_t              rendered = 0;
+	
+	#ifdef _GLCD_USE_DMA
+	if (GLCD_Async.Busy)
+	{
+		return 0; // Bus is owned by the DMA render
+	}
+	#endif /* _GLCD_USE_DMA */
+	
+	do
 	{
 		
-		/* ::::::::::::::: Go to the start of the line ::::::::::::::: */
-		GLCD_GotoXY(x, y);
-		
-		/* :::: pdate the index for reading the last printed line :::: */
-		fontReadPrev = fontStart + j - 1;
+		next = _GLCD_GROUP_END;
 		
-		/* ::::::::::::::: Scan bytes of selected line ::::::::::::::: */
-		for (i = 0; i < width; i++)
+		for (index = 0; index < count; index++)
 		{
 			
-			/* ----------------- Read Byte --------------- */
-			data = GLCD_BufferRead(GLCD.X, GLCD.Y);
-			
-			/* ------- Merge byte with previous one ------ */
-			dataPrev   = pgm_read_byte(&(GLCD.Font.Name[fontReadPrev]));
-			dataPrev >>= _GLCD_SCREEN_LINE_HEIGHT - overflow;
-			data      |= dataPrev;
-			
-			/* ----- Edit byte depending on the mode ----- */
-			if (GLCD.Font.Mode == _GLCD_PRINT_MODE_MERGE)
+			if (!GLCD_IsPending(displays[index]))
 			{
-				data |= GLCD_BufferRead(GLCD.X, GLCD.Y);
+				continue;
 			}
 			
-			/* ----------------- Send Byte --------------- */
-			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
-			
-			/* -------------- Increase index ------------- */
-			fontReadPrev += GLCD.Font.Lines;
+			/* ~~~~~~~~~~~~~~~~ Render the current group, find the next ~~~~~~~~~~~~~~~~ */
+			if (displays[index]->Group == group)
+			{
+				
+				GLCD_Select(displays[index]);
+				GLCD_Render();
+				
+				rendered++;
+				
+			}
+			else if ((displays[index]->Group > group) && (displays[index]->Group < next))
+			{
+				next = displays[index]->Group;
+			}
 			
 		}
 		
-		/* :::::::::: Send an empty column of 1px in the end ::::::::: */
-		if (GLCD.Font.Mode == _GLCD_PRINT_MODE_OVERWRITE)
-		{
-			GLCD_BufferWrite(GLCD.X, GLCD.Y, _GLCD_WHITE);
-		}
+		group = next;
 		
 	}
+	while (group != _GLCD_GROUP_END);
 	
-	/* ~~~~~~~~~~~~~ Move cursor to the end of the printed character ~~~~~~~~~~~~~ */
-	GLCD_GotoXY(x + width + 1, y2);
+	GLCD_Select(selected);
+	
+	return rendered;
 	
 }
 
-void GLCD_PutString(const char *text)
+#ifdef _GLCD_USE_DMA
+GLCD_StatusTypeDef GLCD_RenderAsync(void)
 {
+	/* Same plan as GLCD_Render, each transfer is started by DMA
+	   from the completion interrupt of the previous one
 	
-	while(*text)
+	Busy:           GLCD_IsBusy, the callback is called at the end
+	Render in use:  Request is kept and started when the current ends, unless
+	                commands were kept meanwhile: they go first with the next call
+	Buffer:         Pixels drawn meanwhile are marked dirty again
+	Offline:        Probe and init sequence are blocking, the frame after them is not
+	In Flight:      Other rendering, init and selection calls return _GLCD_BUSY
+	                (GLCD_Status for the void ones) instead of waiting
+	
+	*/
+	
+	if ((GLCD_Transport == NULL) || (GLCD_Transport->WriteAsync == NULL))
+	{
+		return _GLCD_ERROR; // Transport has no async hook, use GLCD_Render
+	}
+	
+	if (GLCD_Async.Busy)
+	{
+		GLCD_Async.Pending = 1;
+		return _GLCD_BUSY;
+	}
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~ Offline: probe ~~~~~~~~~~~~~~~~~~~~~~ */
+	if (GLCD_Display->Breaker.Open)
 	{
 		
-		/* ~~~~~~~~~~~~~~~~~~~~~ Check width ~~~~~~~~~~~~~~~~~~~~~ */
-		if ((GLCD.X + GLCD.Font.Width) >= _GLCD_SCREEN_WIDTH)
+		GLCD_Probe();
+		
+		if (GLCD_Display->Breaker.Open)
 		{
-			break;
+			return _GLCD_OFFLINE;
 		}
 		
-		/* ~~~~~~~~~~~~~~~~~~~~~ Print data ~~~~~~~~~~~~~~~~~~~~~~ */
-		GLCD_PutChar(*text++);
-		
 	}
 	
+	GLCD_FlushCommands();
+	
+	return GLCD_AsyncStart();
+	
 }
 
-void GLCD_PutString_P(const char *text)
+uint8_t GLCD_IsBusy(void)
+{
+	return GLCD_Async.Busy;
+}
+
+void GLCD_SetRenderCallback(GLCD_RenderCallbackTypeDef callback)
 {
+	/* Called from the completion interrupt with the status of the render
 	
-	char r = pgm_read_byte(text++);
+	Re-entry:       It must not call GLCD_Render / GLCD_RenderStep / GLCD_RenderAsync,
+	                GLCD_Init, GLCD_Select or drawing functions; set a flag for the
+	                main loop (a GLCD_RenderAsync made while busy chains a frame)
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	while(r)
+	*/
+	
+	GLCD_Async.Callback = callback;
+	
+}
+
+void GLCD_DMA_TxCpltCallback(void *port)
+{
+	if (GLCD_Async.Busy && GLCD_AsyncDone(port))
+	{
+		GLCD_AsyncNext();
+	}
+}
+
+void GLCD_DMA_ErrorCallback(void *port)
+{
+	
+	if (GLCD_Async.Busy && GLCD_AsyncDone(port))
 	{
 		
-		/* :::::::::::::::: Check width :::::::::::::::: */
-		if ((GLCD.X + GLCD.Font.Width) >= _GLCD_SCREEN_WIDTH)
-		{
-			break;
-		}
+		/* ~~~~~~~~~~~~ Drop the rest, resend on next render ~~~~~~~~~~~ */
+		#ifdef _GLCD_PAGE_FLIP
+		GLCD_FlipLost(&GLCD_Async.Cursor);
+		#endif
 		
-		/* ::::::::::::::::: Print data :::::::::::::::: */
-		GLCD_PutChar(r);
+		GLCD_Async.Status      = _GLCD_ERROR;
+		GLCD_Async.Cursor.Rect = GLCD_Plan.Count + _GLCD_FLIP_TAIL; // Half written frame is not shown
+		GLCD_Invalidate();
 		
-		r = pgm_read_byte(text++);
+		GLCD_AsyncNext();
 		
 	}
 	
 }
+#endif /* _GLCD_USE_DMA */
 
-void GLCD_PutInteger(const int32_t value)
+#ifdef _GLCD_PAGE_MODE
+uint16_t GLCD_GetListUsed(void)
 {
+	/* Arena bytes in use, _GLCD_LIST_OVERFLOW once an op did not fit
 	
-	//int32_max_bytes + sign + null = 12 bytes
-	char bcd[12] = {'\0'};
+	Reset:          GLCD_Clear / GLCD_FillScreen start the list over
 	
-	if (value == 0)
-	{
-		GLCD_PutChar('0');
-	}
-	else if ((value > INT32_MIN) && (value <= INT32_MAX))
-	{
-		
-		/* ~~~~~~~~~~~~~~ Convert integer to array ~~~~~~~~~~~~~~~ */
-		Int2bcd(value, bcd);
-		
-		/* ~~~~~~~~~~~ Print from first non-zero digit ~~~~~~~~~~~ */
-		GLCD_PutString(bcd);
-		
-	}
-	else { }
+	*/
+	
+	return (GLCD_List.Overflow ? _GLCD_LIST_OVERFLOW : GLCD_List.Used);
 	
 }
+#endif /* _GLCD_PAGE_MODE */
 
-void GLCD_PutDouble(double value, const uint32_t tens)
+#ifdef _GLCD_TRIPLE_BUFFER
+void GLCD_SetFrames(uint8_t *second, uint8_t *third)
 {
+	/* Two more _GLCD_BUFFER_SIZE frames for a display of GLCD_InitDisplay
 	
-	if (value == 0)
+	Main Display:   Has its frames already
+	Contents:       Copied from Buffer
+	Call:           While the display is not rendered
+	
+	*/
+	
+	GLCD_TripleTypeDef *triple = &GLCD_Display->Triple;
+	
+	#ifdef _GLCD_USE_DMA
+	if (GLCD_Async.Busy)
 	{
-		
-		GLCD_PutChar('0');
-		GLCD_PutChar('.');
-		GLCD_PutChar('0');
-		
+		GLCD.Status = _GLCD_BUSY; // Shown frame is on the wire, the frames are kept
+		return;
 	}
-	else if ((value >= (-2147483647)) && (value < 2147483648))
+	#endif /* _GLCD_USE_DMA */
+	
+	GLCD_StepAbort();
+	
+	memcpy(second, GLCD_Display->Buffer, _GLCD_BUFFER_SIZE);
+	memcpy(third, GLCD_Display->Buffer, _GLCD_BUFFER_SIZE);
+	
+	triple->Frame[0] = GLCD_Display->Buffer;
+	triple->Frame[1] = second;
+	triple->Frame[2] = third;
+	triple->Ready    = 1;
+	triple->Draw     = 0;
+	triple->Show     = 2;
+	
+	GLCD_TripleClean(triple, 0);
+	GLCD_TripleClean(triple, 1);
+	GLCD_TripleClean(triple, 2);
+	
+}
+
+void GLCD_Publish(void)
+{
+	/* The drawn frame goes to the renderer, drawing goes on in a copy of it
+	
+	Hand-off:       One _GLCD_ATOMIC_XCHG, a render in an ISR / thread may run meanwhile
+	Stale Frames:   A frame the renderer has not taken yet is replaced, never shown
+	Render:         Takes the latest frame when it plans one, the spans drawn into it
+	                (and into replaced frames) go with it, writes that bypassed the
+	                drawing functions are found by the page hash; nothing drawn is
+	                sent before it is published
+	Buffer:         Another frame afterwards, see GLCD_DrawBuffer
+	
+	*/
+	
+	GLCD_TripleTypeDef *triple = &GLCD_Display->Triple;
+	uint8_t             draw   = triple->Draw;
+	uint8_t             ready  = _GLCD_ATOMIC_LOAD(&triple->Ready);
+	
+	/* ~~~~~~~~~~~ A frame that is replaced untaken hands its spans on ~~~~~~~~~~~ */
+	if (ready & _GLCD_TRIPLE_FRESH)
 	{
 		
-		/* ~~~~~~~~~~~~~~~~~~ Print sign ~~~~~~~~~~~~~~~~~~ */
-		if (value < 0)
-		{
-			value = -value;
-			GLCD_PutChar('-');
-		}
-		
-		/* ~~~~~~~~~~~~~~ Print integer part ~~~~~~~~~~~~~~ */
-		GLCD_PutInteger(value);
-		
-		/* ~~~~~~~~~~~~~~~~~~~ Print dot ~~~~~~~~~~~~~~~~~~ */
-		GLCD_PutChar('.');
+		ready &= _GLCD_TRIPLE_INDEX; // Read only by the renderer, a superset if it was taken meanwhile
 		
-		/* ~~~~~~~~~~~~~~ Print decimal part ~~~~~~~~~~~~~~ */
-		GLCD_PutInteger((value - (uint32_t)(value)) * tens);
+		GLCD_TripleMerge(triple->Start[draw], triple->End[draw], triple->Start[ready], triple->End[ready]);
 		
 	}
 	
+	triple->Draw = _GLCD_ATOMIC_XCHG(&triple->Ready, (uint8_t)(draw | _GLCD_TRIPLE_FRESH)) & _GLCD_TRIPLE_INDEX;
+	
+	GLCD_TripleClean(triple, triple->Draw); // Drawing starts over from the published frame
+	
+	/* ~~~~~~~~~~~~ Frame out of the slot is the producer's alone until the next publish ~~~~~~~~~~~~ */
+	if (triple->Frame[triple->Draw] != triple->Frame[draw])
+	{
+		memcpy(triple->Frame[triple->Draw], triple->Frame[draw], _GLCD_BUFFER_SIZE);
+	}
+	
+	GLCD_Display->Buffer = triple->Frame[triple->Draw];
+	
 }
+#endif /* _GLCD_TRIPLE_BUFFER */
 
-/* ::::::::::::::::::::: Draw ::::::::::::::::::::: */
-void GLCD_SetPixel(const uint8_t x, const uint8_t y, COLOR_TypeDef color)
+#ifdef _GLCD_LAYERS
+void GLCD_SetLayers(GLCD_LayerTypeDef *layers, const uint8_t count)
 {
-	uint8_t data = 0;
+	/* Overlays are combined with Buffer page by page while packets are built
 	
-	/* ~~~~~~~~~~~~~~~~~~~~ Goto Point ~~~~~~~~~~~~~~~~~~~~ */
-	GLCD_GotoXY(x, y);
+	Order:          Buffer is the base, layers[0] goes on it, layers[count - 1] on top
+	Buffers:        _GLCD_BUFFER_SIZE bytes each, nothing is flattened in RAM
+	Changes:        Drawing marks the display dirty whatever layer it goes to;
+	                call GLCD_Invalidate after changing Rop / Invert
+	Drawing:        Goes to Buffer again, see GLCD_DrawLayer
 	
-	/* ~~~~~~~~~~~~~~~~~~~~ Read Data ~~~~~~~~~~~~~~~~~~~~~ */
-	data = GLCD_BufferRead(GLCD.X, GLCD.Y);
+	*/
 	
-	/* ~~~~~~~~~~~~~~~~~~~~ Set Pixel ~~~~~~~~~~~~~~~~~~~~~ */
-	if (color == _GLCD_BLACK)
+	#ifdef _GLCD_USE_DMA
+	if (GLCD_Async.Busy)
 	{
-		__BitSet(data, y % 8);
+		GLCD.Status = _GLCD_BUSY; // Packets are composed from the layers, they are kept
+		return;
 	}
-	else
+	#endif /* _GLCD_USE_DMA */
+	
+	GLCD_Display->Layers.Layer  = (count > 0) ? layers : NULL;
+	GLCD_Display->Layers.Count  = (layers != NULL) ? count : 0;
+	GLCD_Display->Layers.Canvas = GLCD_Display->Buffer;
+	
+	GLCD_Invalidate();
+	
+}
+
+void GLCD_DrawLayer(const uint8_t layer)
+{
+	/* 0: Buffer, 1 .. count: layers[layer - 1] of GLCD_SetLayers */
+	
+	if (layer == 0)
 	{
-		__BitClear(data, y % 8);
+		GLCD_Display->Layers.Canvas = GLCD_Display->Buffer;
+	}
+	else if (layer <= GLCD_Display->Layers.Count)
+	{
+		GLCD_Display->Layers.Canvas = GLCD_Display->Layers.Layer[layer - 1].Buffer;
 	}
-	
-	/* ~~~~~~~~~~~~~~~~~~~~ Sent Data ~~~~~~~~~~~~~~~~~~~~~ */
-	GLCD_BufferWrite(GLCD.X, GLCD.Y, data);
 	
 }
+#endif /* _GLCD_LAYERS */
 
-void GLCD_SetPixels(const uint8_t startX, uint8_t startY, const uint8_t endX, const uint8_t endY, COLOR_TypeDef color)
+void GLCD_PlanRender(GLCD_PlanTypeDef *plan)
 {
+	/* Plan of the next render from the changes recorded so far, nothing is changed
 	
-	uint8_t reg_height   = 0;
-	uint8_t reg_width    = 0;
-	uint8_t reg_offset   = 0;
-	uint8_t reg_mask     = 0;
-	uint8_t nreg_height  = 0;
-	uint8_t pixel_count  = 0;
-	uint8_t data         = 0;
+	Pending:        Writes found by _GLCD_PAGE_HASH and a frame published for
+	                _GLCD_TRIPLE_BUFFER come in when a render takes them
+	Page Flip:      Planned for the hidden half, with what it lacks
 	
-	/* ~~~~~~~~~~~~~~~~~~~~ Check Value ~~~~~~~~~~~~~~~~~~~~ */
-	if ((startX < _GLCD_SCREEN_WIDTH) && (endX < _GLCD_SCREEN_WIDTH) &&
-	    (startY < _GLCD_SCREEN_HEIGHT) && (endY < _GLCD_SCREEN_HEIGHT))
+	*/
+	
+	GLCD_RectTypeDef span;
+	GLCD_RectTypeDef merged;
+	GLCD_RectTypeDef full = {0, _GLCD_SCREEN_WIDTH - 1, 0, _GLCD_SCREEN_LINES - 1};
+	
+	uint32_t window_cost  = 0;
+	uint32_t page_cost    = 0;
+	uint32_t full_cost    = 0;
+	uint8_t  line_counter = 0;
+	uint8_t  last         = 0;
+	uint8_t  fold         = 0;
+	
+	plan->Mode  = _GLCD_PLAN_NONE;
+	plan->Count = 0;
+	plan->Cost  = 0;
+	plan->Page  = 0;
+	
+	#ifdef _GLCD_PAGE_FLIP
+	
+	/* ..... Only new changes make a frame, it carries what the hidden half lacks ..... */
+	plan->Page = GLCD_FlipBack() * _GLCD_SCREEN_LINES;
+	
+	for (; (line_counter < _GLCD_SCREEN_LINES) && !fold; line_counter++)
+	{
+		fold = (GLCD_Display->Dirty.Start[line_counter] != _GLCD_DIRTY_NONE);
+	}
+	
+	line_counter = 0;
+	
+	#endif /* _GLCD_PAGE_FLIP */
+	
+	/* ~~~~~~~~~~~~ Window: merge spans while it is cheaper ~~~~~~~~~~~~ */
+	for (; line_counter < _GLCD_SCREEN_LINES; line_counter++)
 	{
 		
-		reg_height  = endY - startY + 1;
-		reg_width   = endX - startX + 1;
-		reg_offset  = startY % _GLCD_SCREEN_LINE_HEIGHT;
-		startY     -= reg_offset;
-		reg_mask    = 0xFF;
-		data        = 0;
-		
-		/* ::::::: Calculate Mask For Top Fractioned Region :::::::: */
-		if (reg_height < (_GLCD_SCREEN_LINE_HEIGHT - reg_offset))
+		if (GLCD_PlanLine(line_counter, fold, &span))
 		{
 			
-			reg_mask    >>= (_GLCD_SCREEN_LINE_HEIGHT - reg_height);
-			nreg_height   = reg_height;
+			page_cost += GLCD_RectCost(&span, _GLCD_PLAN_PAGE_CMDS);
+			
+			if (plan->Count > 0)
+			{
+				
+				last   = plan->Count - 1;
+				merged = plan->Rect[last];
+				
+				merged.StartX  = __GLCD_Min(merged.StartX, span.StartX);
+				merged.EndX    = ((merged.EndX > span.EndX) ? merged.EndX : span.EndX);
+				merged.EndLine = line_counter;
+				
+				if (GLCD_RectCost(&merged, _GLCD_PLAN_WINDOW_CMDS) <= (GLCD_RectCost(&plan->Rect[last], _GLCD_PLAN_WINDOW_CMDS) + GLCD_RectCost(&span, _GLCD_PLAN_WINDOW_CMDS)))
+				{
+					plan->Rect[last] = merged;
+				}
+				else
+				{
+					plan->Rect[plan->Count++] = span;
+				}
+				
+			}
+			else
+			{
+				plan->Rect[plan->Count++] = span;
+			}
 			
 		}
-		else
+		
+	}
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~ Compare costs ~~~~~~~~~~~~~~~~~~~~~~~~ */
+	if (plan->Count > 0)
+	{
+		
+		for (last = 0; last < plan->Count; last++)
 		{
-			nreg_height = _GLCD_SCREEN_LINE_HEIGHT - reg_offset;
+			window_cost += GLCD_RectCost(&plan->Rect[last], _GLCD_PLAN_WINDOW_CMDS);
 		}
 		
-		reg_mask <<= reg_offset;
-		
-		/* ::::: Draw Fractional Rows At The Top Of The Region ::::: */
-		GLCD_GotoXY(startX, startY);
+		full_cost = GLCD_RectCost(&full, _GLCD_PLAN_WINDOW_CMDS);
 		
-		for (pixel_count = 0 ; pixel_count < reg_width ; pixel_count++)
+		/* ..... Addressing mode switch ..... */
+		if (GLCD_Display->Shadow.MemMode == _GLCD_MEM_MODE_HORIZONTAL)
 		{
-			
-			/* ----- Read ----- */
-			data = GLCD_BufferRead(GLCD.X, GLCD.Y);
-			
-			/* ----- Mask ----- */
-			data = ((color == _GLCD_BLACK) ? (data | reg_mask) : (data & ~reg_mask));
-			
-			/* ---- Write ----- */
-			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
-			
+			page_cost += _GLCD_PLAN_MODE_CMDS * GLCD_CostModel.Byte;
+		}
+		else
+		{
+			window_cost += _GLCD_PLAN_MODE_CMDS * GLCD_CostModel.Byte;
+			full_cost   += _GLCD_PLAN_MODE_CMDS * GLCD_CostModel.Byte;
 		}
 		
-		/* ::::::::::::::::::::::: Full rows ::::::::::::::::::::::: */
-		while ((nreg_height + _GLCD_SCREEN_LINE_HEIGHT) <= reg_height)
+		/* ..... Select ..... */
+		if ((full_cost <= window_cost) && (full_cost <= page_cost))
 		{
 			
-			/* ----- Set Point ----- */
-			nreg_height += _GLCD_SCREEN_LINE_HEIGHT;
-			startY      += _GLCD_SCREEN_LINE_HEIGHT;
-			
-			/* ---- Goto Point ----- */
-			GLCD_GotoXY(startX, startY);
-			
-			/* ---- Write Buff ----- */
-			for (pixel_count = 0; pixel_count < reg_width; pixel_count++)
-			{
-				GLCD_BufferWrite(GLCD.X++, GLCD.Y, color);
-			}
+			plan->Mode    = _GLCD_PLAN_FULL_FRAME;
+			plan->Count   = 1;
+			plan->Rect[0] = full;
+			plan->Cost    = full_cost;
 			
 		}
-		
-		/* :::::: Fractional Rows At The Bottom Of The Region :::::: */
-		if (nreg_height < reg_height)
+		else if (page_cost < window_cost)
 		{
 			
-			reg_mask = ~(0xFF << (reg_height - nreg_height));
-			
-			/* ----- Goto Point ----- */
-			GLCD_GotoXY(startX, startY + _GLCD_SCREEN_LINE_HEIGHT);
+			plan->Mode  = _GLCD_PLAN_PAGE;
+			plan->Count = 0;
+			plan->Cost  = page_cost;
 			
-			for (pixel_count = 0; pixel_count < reg_width; pixel_count++)
+			for (line_counter = 0; line_counter < _GLCD_SCREEN_LINES; line_counter++)
 			{
 				
-				/* """"" Read """"" */
-				data = GLCD_BufferRead(GLCD.X, GLCD.Y);
-				
-				/* """"" Mask """"" */
-				data = ((color == _GLCD_BLACK) ? (data | reg_mask) : (data & ~reg_mask));
-				
-				/* """" Write """"" */
-				GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
+				if (GLCD_PlanLine(line_counter, fold, &plan->Rect[plan->Count]))
+				{
+					plan->Count++;
+				}
 				
 			}
 			
 		}
+		else
+		{
+			
+			plan->Mode = _GLCD_PLAN_WINDOW;
+			plan->Cost = window_cost;
+			
+		}
 		
 	}
 	
 }
 
-void GLCD_DrawBitmap(const uint8_t *bitmap, uint8_t width, const uint8_t height, GLCD_PrintModeTypeDef mode)
+const GLCD_PlanTypeDef *GLCD_GetPlan(void)
+{
+	return (&GLCD_Plan);
+}
+
+void GLCD_SetCostModel(const uint8_t transaction, const uint8_t byte)
+{
+	GLCD_CostModel.Transaction = transaction;
+	GLCD_CostModel.Byte        = byte;
+}
+
+void GLCD_SetPacketSize(const uint16_t size)
+{
+	GLCD_PacketSize = size;
+}
+
+uint16_t GLCD_GetPacketSize(void)
+{
+	return GLCD_PacketSize;
+}
+
+#ifdef _GLCD_GET_TICK
+uint16_t GLCD_CalibratePacketSize(uint32_t *rates)
 {
 	
-	uint16_t lines              = 0;
-	uint16_t line_counter       = 0;
-	uint16_t line_pixels_ounter = 0;
-	
-	uint16_t bmpRead     = 0;
-	uint16_t bmpReadPrev = 0;
-	uint16_t data        = 0;
-	uint16_t dataPrev    = 0;
-	uint16_t overflow    = 0;
-	
-	/* ~~~~~~~~~~~~~~~~~~~~ Save Current Position ~~~~~~~~~~~~~~~~~~~~ */
-	uint8_t  x_pos           = GLCD.X;
-	uint16_t y_pos           = GLCD.Y;
-	uint16_t y_pos_for_draw  = GLCD.Y;
+	static const uint16_t sizes[_GLCD_CALIB_SIZES] = {16, 32, 64, 128, _GLCD_PACKET_SIZE_FRAME};
 	
-	/* ~~~~~~~~~~~~~~~~ Read Width - First Two Bytes ~~~~~~~~~~~~~~~~~ */
-	data = GLCD.X + width; // "data" is used temporarily
+	uint32_t tick      = 0;
+	uint32_t rate      = 0;
+	uint32_t best_rate = 0;
+	uint16_t best_size = GLCD_PacketSize;
+	uint8_t  size_counter  = 0;
+	uint8_t  frame_counter = 0;
 	
-	/* .....  Reduce Bitmap Data For Screen Size ..... */
-	if (data >= _GLCD_SCREEN_WIDTH)
+	for (; size_counter < _GLCD_CALIB_SIZES; size_counter++)
 	{
-		width -= (data - _GLCD_SCREEN_WIDTH);
+		
+		GLCD_PacketSize = sizes[size_counter];
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~ Send full frames ~~~~~~~~~~~~~~~~~~~~~ */
+		tick = _GLCD_GET_TICK();
+		
+		for (frame_counter = 0; frame_counter < _GLCD_CALIB_FRAMES; frame_counter++)
+		{
+			GLCD_Invalidate();
+			GLCD_Render();
+		}
+		
+		tick = _GLCD_GET_TICK() - tick;
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~~~ Bytes/second ~~~~~~~~~~~~~~~~~~~~~~~ */
+		if (tick == 0)
+		{
+			tick = 1; // Faster than the tick resolution
+		}
+		
+		rate = ((uint32_t)_GLCD_CALIB_FRAMES * _GLCD_SCREEN_WIDTH * _GLCD_SCREEN_LINES * 1000UL) / tick;
+		
+		if (rates != NULL)
+		{
+			rates[size_counter] = rate;
+		}
+		
+		if (rate > best_rate)
+		{
+			best_rate = rate;
+			best_size = sizes[size_counter];
+		}
+		
 	}
 	
-	/* ~~~~~~ Read Height - Second Two Bytes - Convert To Lines ~~~~~~ */
-	lines = (height + _GLCD_SCREEN_LINE_HEIGHT - 1) / _GLCD_SCREEN_LINE_HEIGHT; // lines = Ceiling(A/B) = (A+B-1)/B
-	data  = GLCD.Y / _GLCD_SCREEN_LINE_HEIGHT + lines; // "data" is used temporarily
+	GLCD_PacketSize = best_size;
 	
-	/* .....  Reduce Bitmap Data For Screen Size ..... */
-	if (data > _GLCD_SCREEN_LINES)
+	return best_size;
+	
+}
+#endif /* _GLCD_GET_TICK */
+
+void GLCD_Invalidate(void)
+{
+	
+	uint8_t line_counter = 0;
+	
+	for (; line_counter < _GLCD_SCREEN_LINES; line_counter++)
 	{
-		lines -= data - _GLCD_SCREEN_LINES;
+		GLCD_MarkDirty(line_counter, 0, _GLCD_SCREEN_WIDTH - 1);
 	}
 	
-	/* ~~~~~~~~~~~~~~~~~ Calculate Overflowing Bits ~~~~~~~~~~~~~~~~~~ */
-	overflow = GLCD.Y % _GLCD_SCREEN_LINE_HEIGHT;
+}
+
+void GLCD_InvalidateRect(const uint8_t startX, const uint8_t startY, const uint8_t endX, const uint8_t endY)
+{
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~ Print The Character ~~~~~~~~~~~~~~~~~~~~~ */
-	/* ..... Scan The Lines Needed ..... */
+	uint8_t line_counter = 0;
+	
+	/* ~~~~~~~~~~~~~~~~~~~~ Check Value ~~~~~~~~~~~~~~~~~~~~ */
+	if ((startX <= endX) && (endX < _GLCD_SCREEN_WIDTH) &&
+	    (startY <= endY) && (endY < _GLCD_SCREEN_HEIGHT))
+	{
+		
+		for (line_counter = (startY / _GLCD_SCREEN_LINE_HEIGHT); line_counter <= (endY / _GLCD_SCREEN_LINE_HEIGHT); line_counter++)
+		{
+			GLCD_MarkDirty(line_counter, startX, endX);
+		}
+		
+	}
+	
+}
+
+void GLCD_SetDisplay(const uint8_t on)
+{
+	
+	uint8_t command = on ? _GLCD_CMD_DISP_ON : _GLCD_CMD_DISP_OFF;
+	
+	GLCD_ShadowSend(&GLCD_Display->Shadow.Display, command, &command, 1);
+	
+}
+
+void GLCD_SetContrast(const uint8_t contrast)
+{
+	
+	if (GLCD_Display->Shadow.Contrast == contrast)
+	{
+		return;
+	}
+	
+	GLCD_QueueCommand(_GLCD_CMD_CONTRAST_SET);
+	GLCD_QueueCommand(contrast);
+	
+	GLCD_Display->Shadow.Contrast = (GLCD_FlushCommands() == _GLCD_OK) ? contrast : _GLCD_CONTRAST_UNKNOWN;
+	
+}
+
+void GLCD_SetStartLine(const uint8_t line)
+{
+	
+	uint8_t command = _GLCD_CMD_DISP_START_LINE_SET | (line & _GLCD_START_LINE_MASK);
+	
+	GLCD_ShadowSend(&GLCD_Display->Shadow.StartLine, line & _GLCD_START_LINE_MASK, &command, 1);
+	
+}
+
+void GLCD_SetDisplayOffset(const uint8_t offset)
+{
+	
+	uint8_t commands[2] = {_GLCD_CMD_DISP_START_OFFSET_SET, offset & _GLCD_START_LINE_MASK};
+	
+	GLCD_ShadowSend(&GLCD_Display->Shadow.Offset, commands[1], commands, 2);
+	
+}
+
+void GLCD_InvalidateShadow(void)
+{
+	/* The panel may have been reset or written by someone else: every register is sent again */
+	
+	GLCD_StepAbort(); // A window of the stepped frame is not trusted
+	GLCD_ShadowClear(&GLCD_Display->Shadow);
+	
+}
+
+void GLCD_Clear(void)
+{
+	GLCD_FillScreen(_GLCD_WHITE);
+}
+
+void GLCD_ClearLine(const uint8_t line)
+{
+	
+	#ifdef _GLCD_DIRECT_TEXT
+	uint8_t block[_GLCD_CLEAR_BLOCK];
+	#else
+	uint8_t column_counter = 0;
+	#endif /* _GLCD_DIRECT_TEXT */
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {line};
+	
+	if (GLCD_ListRecord(_GLCD_OP_CLEAR_LINE, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	/* ~~~~~~~~~~~~~~~~~~~~ Check Value ~~~~~~~~~~~~~~~~~~~~ */
+	if (line < _GLCD_SCREEN_LINES)
+	{
+		
+		/* :::::::::: Goto Line :::::::::: */
+		GLCD_GotoXY(0, line * _GLCD_SCREEN_LINE_HEIGHT);
+		
+		/* ::::::::: Fill Pixels ::::::::: */
+		#ifdef _GLCD_DIRECT_TEXT
+		memset(block, _GLCD_WHITE, sizeof(block));
+		
+		GLCD_DirectWrite(0, line, block, _GLCD_SCREEN_WIDTH, 1);
+		#else
+		for (column_counter = 0 ; column_counter < _GLCD_SCREEN_WIDTH ; column_counter++)
+		{
+			GLCD_BufferWrite(column_counter, GLCD.Y, _GLCD_WHITE);
+		}
+		#endif /* _GLCD_DIRECT_TEXT */
+		
+	}
+	
+}
+
+void GLCD_InvertScreen(void)
+{
+	
+	uint8_t command;
+	
+	if (GLCD.Mode == _GLCD_DISP_INVERTED)
+	{
+		GLCD.Mode = _GLCD_DISP_NON_INVERTED;
+	}
+	else
+	{
+		GLCD.Mode = _GLCD_DISP_INVERTED;
+	}
+	
+	command = GLCD.Mode;
+	
+	GLCD_ShadowSend(&GLCD_Display->Shadow.Inverse, command, &command, 1);
+	
+}
+
+void GLCD_InvertRect(uint8_t startX, uint8_t startY, uint8_t endX, uint8_t endY)
+{
+	
+	uint8_t width;
+	uint8_t height;
+	uint8_t offset;
+	uint8_t mask;
+	uint8_t h;
+	uint8_t i;
+	uint8_t data;
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {startX, startY, endX, endY};
+	
+	if (GLCD_ListRecord(_GLCD_OP_INVERT_RECT, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */
+	width   = endX - startX + 1;
+	height  = endY - startY + 1;
+	offset  = startY % _GLCD_SCREEN_LINE_HEIGHT;
+	startY -= offset;
+	mask    = 0xFF;
+	data    = 0;
+	
+	/* ~~~~~~~~~~~ Calculate mask for top fractioned region ~~~~~~~~~~ */
+	if (height < (_GLCD_SCREEN_LINE_HEIGHT - offset))
+	{
+		mask >>= (_GLCD_SCREEN_LINE_HEIGHT - height);
+		h = height;
+	}
+	else
+	{
+		h = _GLCD_SCREEN_LINE_HEIGHT - offset;
+	}
+	
+	mask <<= offset;
+	
+	/* ~~~~~~~~ Draw fractional rows at the top of the region ~~~~~~~~ */
+	GLCD_GotoXY(startX, startY);
+	
+	for (i = 0; i < width; i++)
+	{
+		
+		data = GLCD_BufferRead(GLCD.X, GLCD.Y);
+		data = ((~data) & mask) | (data & (~mask));
+		
+		GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
+		
+	}
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~ Full rows ~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	while ((h + _GLCD_SCREEN_LINE_HEIGHT) <= height)
+	{
+		
+		h      += _GLCD_SCREEN_LINE_HEIGHT;
+		startY += _GLCD_SCREEN_LINE_HEIGHT;
+		
+		GLCD_GotoXY(startX, startY);
+		
+		for (i=0; i < width; i++)
+		{
+			
+			data = ~GLCD_BufferRead(GLCD.X, GLCD.Y);
+			
+			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
+			
+		}
+		
+	}
+	
+	/* ~~~~~~~~~ Fractional rows at the bottom of the region ~~~~~~~~~ */
+	if (h < height)
+	{
+		
+		mask = ~(0xFF << (height - h));
+		
+		GLCD_GotoXY(startX, (startY + _GLCD_SCREEN_LINE_HEIGHT));
+
+		for (i = 0; i < width; i++)
+		{
+			
+			data = GLCD_BufferRead(GLCD.X, GLCD.Y);
+			data = ((~data) & mask) | (data & (~mask));
+			
+			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
+			
+		}
+		
+	}
+	
+}
+
+GLCD_StatusTypeDef GLCD_Status(void)
+{
+	return (GLCD.Status);
+}
+
+/* ::::::::::::::::::: Location ::::::::::::::::::: */
+void GLCD_GotoX(const uint8_t x)
+{
+	if (x < _GLCD_SCREEN_WIDTH)
+	{
+		GLCD.X = x;
+	}
+}
+
+void GLCD_GotoY(const uint8_t y)
+{
+	if (GLCD.Y < _GLCD_SCREEN_HEIGHT)
+	{
+		GLCD.Y = y;
+	}
+}
+
+void GLCD_GotoXY(const uint8_t x, const uint8_t y)
+{
+	GLCD_GotoX(x);
+	GLCD_GotoY(y);
+}
+
+void GLCD_GotoLine(const uint8_t line)
+{
+	if (line < _GLCD_SCREEN_LINES)
+	{
+		GLCD.Y = line * _GLCD_SCREEN_LINE_HEIGHT;
+	}
+}
+
+uint8_t GLCD_GetX(void)
+{
+	return GLCD.X;
+}
+
+uint8_t GLCD_GetY(void)
+{
+	return GLCD.Y;
+}
+
+uint8_t GLCD_GetLine(void)
+{
+	return (__GLCD_GetLine(GLCD.Y));
+}
+
+/* :::::::::::::::::: Print data :::::::::::::::::: */
+uint8_t GLCD_GetWidthChar(const char character)
+{
+	/* +1 for space after each character */
+	return (pgm_read_byte(&(GLCD.Font.Name[(character - 32) * (GLCD.Font.Width * GLCD.Font.Lines + 1)])) + 1);
+}
+
+uint16_t GLCD_GetWidthString(const char *text)
+{
+	
+	uint16_t width = 0;
+
+	while (*text)
+	{
+		width += GLCD_GetWidthChar(*text++);
+	}
+	
+	return width;
+	
+}
+
+uint16_t GLCD_GetWidthString_P(const char *text)
+{
+	
+	uint16_t width = 0;
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */
+	char r = pgm_read_byte(text++);
+
+	while (r)
+	{
+		
+		width += GLCD_GetWidthChar(r);
+		
+		r = pgm_read_byte(text++);
+		
+	}
+	
+	return width;
+	
+}
+
+void GLCD_PutChar(char character)
+{
+	
+	/* If it doesn't work, replace pgm_read_byte with pgm_read_word */
+	uint16_t fontStart    = 0;
+	uint16_t fontRead     = 0;
+	uint16_t fontReadPrev = 0;
+	
+	uint8_t x        = 0;
+	uint8_t y        = 0;
+	uint8_t y2       = 0;
+	uint8_t i        = 0;
+	uint8_t j        = 0;
+	uint8_t width    = 0;
+	uint8_t overflow = 0;
+	uint8_t data     = 0;
+	uint8_t dataPrev = 0;
+	
+	#ifdef _GLCD_DIRECT_TEXT
+	uint8_t  stage[_GLCD_GLYPH_STAGE];
+	uint8_t  count  = 0;
+	uint16_t column = 0;
+	#endif /* _GLCD_DIRECT_TEXT */
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {(uint8_t)character};
+	
+	if (GLCD_ListRecord(_GLCD_OP_CHAR, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~ Save current position ~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	x = GLCD.X;
+	y = y2 = GLCD.Y;
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~ Remove leading empty characters ~~~~~~~~~~~~~~~~~~~~~ */
+	character -= 32; // 32 is the ASCII of the first printable character
+	
+	/* ~~~~~~~~~~~~ Find the start of the character in the font array ~~~~~~~~~~~~ */
+	fontStart = character * (GLCD.Font.Width * GLCD.Font.Lines + 1); // +1 due to first byte of each array line being the width
+	
+	/* ~~~~ Update width-First byte of each line is the width of the character ~~~ */
+	width = pgm_read_byte(&(GLCD.Font.Name[fontStart++]));
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~ Calculate overflowing bits ~~~~~~~~~~~~~~~~~~~~~~~ */
+	overflow = GLCD.Y % _GLCD_SCREEN_LINE_HEIGHT;
+	
+	#ifdef _GLCD_DIRECT_TEXT
+	
+	/* ~~~~~~~~~~~~~~~~~ Page aligned: glyph columns go straight to GDDRAM ~~~~~~~~~~~~~~~~~ */
+	if (overflow == 0)
+	{
+		
+		for (j = 0; j < GLCD.Font.Lines; j++)
+		{
+			
+			fontRead = fontStart + j;
+			column   = x;
+			count    = 0;
+			
+			for (i = 0 ; i < width ; i++)
+			{
+				
+				stage[count++] = pgm_read_byte(&(GLCD.Font.Name[fontRead]));
+				fontRead      += GLCD.Font.Lines;
+				
+				/* ..... Stage is full, send it and go on ..... */
+				if (count == _GLCD_GLYPH_STAGE)
+				{
+					
+					GLCD_DirectWrite(column, (y / _GLCD_SCREEN_LINE_HEIGHT) + j, stage, count, 0);
+					
+					column += count;
+					count   = 0;
+					
+				}
+				
+			}
+			
+			/* ..... Empty column of 1px, merge mode keeps what is there ..... */
+			if (GLCD.Font.Mode == _GLCD_PRINT_MODE_OVERWRITE)
+			{
+				stage[count++] = _GLCD_WHITE;
+			}
+			
+			GLCD_DirectWrite(column, (y / _GLCD_SCREEN_LINE_HEIGHT) + j, stage, count, 0);
+			
+		}
+		
+		GLCD_GotoXY(x + width + 1, y2);
+		
+		return;
+		
+	}
+	
+	GLCD_RunBegin(); // Shifted rows are gathered page by page
+	
+	#endif /* _GLCD_DIRECT_TEXT */
+	
+	/* ~~~~~~~~~~~~~~~ Print the character / Scan the lines needed ~~~~~~~~~~~~~~~ */
+	for (j = 0; j < GLCD.Font.Lines; j++)
+	{
+		
+		/* ::::::::::: Go to the start of the line ::::::::::: */
+		GLCD_GotoXY(x, y);
+		
+		/* ::::: Update the indices for reading the line ::::: */
+		fontRead     = fontStart + j;
+		fontReadPrev = fontRead - 1;
+		
+		/* ::::::::::: Scan bytes of selected line ::::::::::: */
+		for (i = 0 ; i < width ; i++)
+		{
+			
+			/* ----------------- Read Byte --------------- */
+			data = pgm_read_byte(&(GLCD.Font.Name[fontRead]));
+			
+			/* ---------------- Shift Byte --------------- */
+			data <<= overflow;
+			
+			/* ------- Merge byte with previous one ------ */
+			if (j > 0)
+			{
+				dataPrev       = pgm_read_byte(&(GLCD.Font.Name[fontReadPrev]));
+				dataPrev     >>= _GLCD_SCREEN_LINE_HEIGHT - overflow;
+				data          |= dataPrev;
+				fontReadPrev  += GLCD.Font.Lines;
+			}
+			
+			/* ----- Edit byte depending on the mode ----- */
+			if (GLCD.Font.Mode == _GLCD_PRINT_MODE_MERGE)
+			{
+				data |= GLCD_BufferRead(GLCD.X, GLCD.Y);
+			}
+			
+			/* ----------------- Send Byte --------------- */
+			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
+			
+			/* -------------- Increase index ------------- */
+			fontRead += GLCD.Font.Lines;
+			
+		}
+		
+		/* :::::: Send an empty column of 1px in the end ::::: */
+		if (GLCD.Font.Mode == _GLCD_PRINT_MODE_OVERWRITE)
+		{
+			GLCD_BufferWrite(GLCD.X, GLCD.Y, _GLCD_WHITE);
+		}
+		
+		/* :::::::::::::: Increase line counter :::::::::::::: */
+		y += _GLCD_SCREEN_LINE_HEIGHT;
+		
+	}
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~ Update last line, if needed  ~~~~~~~~~~~~~~~~~~~~~~ */
+	//if (LINE_STARTING != LINE_ENDING)
+	if (__GLCD_GetLine(y2) != __GLCD_GetLine(y2 + GLCD.Font.Height))
+	{
+		
+		/* ::::::::::::::: Go to the start of the line ::::::::::::::: */
+		GLCD_GotoXY(x, y);
+		
+		/* :::: pdate the index for reading the last printed line :::: */
+		fontReadPrev = fontStart + j - 1;
+		
+		/* ::::::::::::::: Scan bytes of selected line ::::::::::::::: */
+		for (i = 0; i < width; i++)
+		{
+			
+			/* ----------------- Read Byte --------------- */
+			data = GLCD_BufferRead(GLCD.X, GLCD.Y);
+			
+			/* ------- Merge byte with previous one ------ */
+			dataPrev   = pgm_read_byte(&(GLCD.Font.Name[fontReadPrev]));
+			dataPrev >>= _GLCD_SCREEN_LINE_HEIGHT - overflow;
+			data      |= dataPrev;
+			
+			/* ----- Edit byte depending on the mode ----- */
+			if (GLCD.Font.Mode == _GLCD_PRINT_MODE_MERGE)
+			{
+				data |= GLCD_BufferRead(GLCD.X, GLCD.Y);
+			}
+			
+			/* ----------------- Send Byte --------------- */
+			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
+			
+			/* -------------- Increase index ------------- */
+			fontReadPrev += GLCD.Font.Lines;
+			
+		}
+		
+		/* :::::::::: Send an empty column of 1px in the end ::::::::: */
+		if (GLCD.Font.Mode == _GLCD_PRINT_MODE_OVERWRITE)
+		{
+			GLCD_BufferWrite(GLCD.X, GLCD.Y, _GLCD_WHITE);
+		}
+		
+	}
+	
+	#ifdef _GLCD_DIRECT_TEXT
+	GLCD_RunEnd();
+	#endif /* _GLCD_DIRECT_TEXT */
+	
+	/* ~~~~~~~~~~~~~ Move cursor to the end of the printed character ~~~~~~~~~~~~~ */
+	GLCD_GotoXY(x + width + 1, y2);
+	
+}
+
+void GLCD_PutString(const char *text)
+{
+	
+	#ifdef _GLCD_PAGE_MODE
+	size_t length = strlen(text);
+	
+	if (length > _GLCD_SCREEN_WIDTH)
+	{
+		length = _GLCD_SCREEN_WIDTH; // The rest can not fit
+	}
+	
+	if (GLCD_ListRecord(_GLCD_OP_STRING, NULL, 0, text, (uint8_t)(length + 1)))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	while(*text)
+	{
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~ Check width ~~~~~~~~~~~~~~~~~~~~~ */
+		if ((GLCD.X + GLCD.Font.Width) >= _GLCD_SCREEN_WIDTH)
+		{
+			break;
+		}
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~ Print data ~~~~~~~~~~~~~~~~~~~~~~ */
+		GLCD_PutChar(*text++);
+		
+	}
+	
+}
+
+void GLCD_PutString_P(const char *text)
+{
+	
+	char r;
+	
+	#ifdef _GLCD_PAGE_MODE
+	if (GLCD_ListRecord(_GLCD_OP_STRING_P, NULL, 0, &text, sizeof(text)))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	r = pgm_read_byte(text++);
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	while(r)
+	{
+		
+		/* :::::::::::::::: Check width :::::::::::::::: */
+		if ((GLCD.X + GLCD.Font.Width) >= _GLCD_SCREEN_WIDTH)
+		{
+			break;
+		}
+		
+		/* ::::::::::::::::: Print data :::::::::::::::: */
+		GLCD_PutChar(r);
+		
+		r = pgm_read_byte(text++);
+		
+	}
+	
+}
+
+void GLCD_PutInteger(const int32_t value)
+{
+	
+	//int32_max_bytes + sign + null = 12 bytes
+	char bcd[12] = {'\0'};
+	
+	if (value == 0)
+	{
+		GLCD_PutChar('0');
+	}
+	else if ((value > INT32_MIN) && (value <= INT32_MAX))
+	{
+		
+		/* ~~~~~~~~~~~~~~ Convert integer to array ~~~~~~~~~~~~~~~ */
+		Int2bcd(value, bcd);
+		
+		/* ~~~~~~~~~~~ Print from first non-zero digit ~~~~~~~~~~~ */
+		GLCD_PutString(bcd);
+		
+	}
+	else { }
+	
+}
+
+void GLCD_PutDouble(double value, const uint32_t tens)
+{
+	
+	if (value == 0)
+	{
+		
+		GLCD_PutChar('0');
+		GLCD_PutChar('.');
+		GLCD_PutChar('0');
+		
+	}
+	else if ((value >= (-2147483647)) && (value < 2147483648))
+	{
+		
+		/* ~~~~~~~~~~~~~~~~~~ Print sign ~~~~~~~~~~~~~~~~~~ */
+		if (value < 0)
+		{
+			value = -value;
+			GLCD_PutChar('-');
+		}
+		
+		/* ~~~~~~~~~~~~~~ Print integer part ~~~~~~~~~~~~~~ */
+		GLCD_PutInteger(value);
+		
+		/* ~~~~~~~~~~~~~~~~~~~ Print dot ~~~~~~~~~~~~~~~~~~ */
+		GLCD_PutChar('.');
+		
+		/* ~~~~~~~~~~~~~~ Print decimal part ~~~~~~~~~~~~~~ */
+		GLCD_PutInteger((value - (uint32_t)(value)) * tens);
+		
+	}
+	
+}
+
+/* ::::::::::::::::::::: Draw ::::::::::::::::::::: */
+void GLCD_SetPixel(const uint8_t x, const uint8_t y, COLOR_TypeDef color)
+{
+	uint8_t data = 0;
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {x, y, color};
+	
+	if (GLCD_ListRecord(_GLCD_OP_PIXEL, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	/* ~~~~~~~~~~~~~~~~~~~~ Goto Point ~~~~~~~~~~~~~~~~~~~~ */
+	GLCD_GotoXY(x, y);
+	
+	/* ~~~~~~~~~~~~~~~~~~~~ Read Data ~~~~~~~~~~~~~~~~~~~~~ */
+	data = GLCD_BufferRead(GLCD.X, GLCD.Y);
+	
+	/* ~~~~~~~~~~~~~~~~~~~~ Set Pixel ~~~~~~~~~~~~~~~~~~~~~ */
+	if (color == _GLCD_BLACK)
+	{
+		__BitSet(data, y % 8);
+	}
+	else
+	{
+		__BitClear(data, y % 8);
+	}
+	
+	/* ~~~~~~~~~~~~~~~~~~~~ Sent Data ~~~~~~~~~~~~~~~~~~~~~ */
+	GLCD_BufferWrite(GLCD.X, GLCD.Y, data);
+	
+}
+
+void GLCD_SetPixels(const uint8_t startX, uint8_t startY, const uint8_t endX, const uint8_t endY, COLOR_TypeDef color)
+{
+	
+	uint8_t reg_height   = 0;
+	uint8_t reg_width    = 0;
+	uint8_t reg_offset   = 0;
+	uint8_t reg_mask     = 0;
+	uint8_t nreg_height  = 0;
+	uint8_t pixel_count  = 0;
+	uint8_t data         = 0;
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {startX, startY, endX, endY, color};
+	
+	if (GLCD_ListRecord(_GLCD_OP_PIXELS, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	/* ~~~~~~~~~~~~~~~~~~~~ Check Value ~~~~~~~~~~~~~~~~~~~~ */
+	if ((startX < _GLCD_SCREEN_WIDTH) && (endX < _GLCD_SCREEN_WIDTH) &&
+	    (startY < _GLCD_SCREEN_HEIGHT) && (endY < _GLCD_SCREEN_HEIGHT))
+	{
+		
+		reg_height  = endY - startY + 1;
+		reg_width   = endX - startX + 1;
+		reg_offset  = startY % _GLCD_SCREEN_LINE_HEIGHT;
+		startY     -= reg_offset;
+		reg_mask    = 0xFF;
+		data        = 0;
+		
+		/* ::::::: Calculate Mask For Top Fractioned Region :::::::: */
+		if (reg_height < (_GLCD_SCREEN_LINE_HEIGHT - reg_offset))
+		{
+			
+			reg_mask    >>= (_GLCD_SCREEN_LINE_HEIGHT - reg_height);
+			nreg_height   = reg_height;
+			
+		}
+		else
+		{
+			nreg_height = _GLCD_SCREEN_LINE_HEIGHT - reg_offset;
+		}
+		
+		reg_mask <<= reg_offset;
+		
+		/* ::::: Draw Fractional Rows At The Top Of The Region ::::: */
+		GLCD_GotoXY(startX, startY);
+		
+		for (pixel_count = 0 ; pixel_count < reg_width ; pixel_count++)
+		{
+			
+			/* ----- Read ----- */
+			data = GLCD_BufferRead(GLCD.X, GLCD.Y);
+			
+			/* ----- Mask ----- */
+			data = ((color == _GLCD_BLACK) ? (data | reg_mask) : (data & ~reg_mask));
+			
+			/* ---- Write ----- */
+			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
+			
+		}
+		
+		/* ::::::::::::::::::::::: Full rows ::::::::::::::::::::::: */
+		while ((nreg_height + _GLCD_SCREEN_LINE_HEIGHT) <= reg_height)
+		{
+			
+			/* ----- Set Point ----- */
+			nreg_height += _GLCD_SCREEN_LINE_HEIGHT;
+			startY      += _GLCD_SCREEN_LINE_HEIGHT;
+			
+			/* ---- Goto Point ----- */
+			GLCD_GotoXY(startX, startY);
+			
+			/* ---- Write Buff ----- */
+			for (pixel_count = 0; pixel_count < reg_width; pixel_count++)
+			{
+				GLCD_BufferWrite(GLCD.X++, GLCD.Y, color);
+			}
+			
+		}
+		
+		/* :::::: Fractional Rows At The Bottom Of The Region :::::: */
+		if (nreg_height < reg_height)
+		{
+			
+			reg_mask = ~(0xFF << (reg_height - nreg_height));
+			
+			/* ----- Goto Point ----- */
+			GLCD_GotoXY(startX, startY + _GLCD_SCREEN_LINE_HEIGHT);
+			
+			for (pixel_count = 0; pixel_count < reg_width; pixel_count++)
+			{
+				
+				/* """"" Read """"" */
+				data = GLCD_BufferRead(GLCD.X, GLCD.Y);
+				
+				/* """"" Mask """"" */
+				data = ((color == _GLCD_BLACK) ? (data | reg_mask) : (data & ~reg_mask));
+				
+				/* """" Write """"" */
+				GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
+				
+			}
+			
+		}
+		
+	}
+	
+}
+
+void GLCD_DrawBitmap(const uint8_t *bitmap, uint8_t width, const uint8_t height, GLCD_PrintModeTypeDef mode)
+{
+	
+	uint16_t lines              = 0;
+	uint16_t line_counter       = 0;
+	uint16_t line_pixels_ounter = 0;
+	
+	uint16_t bmpRead     = 0;
+	uint16_t bmpReadPrev = 0;
+	uint16_t data        = 0;
+	uint16_t dataPrev    = 0;
+	uint16_t overflow    = 0;
+	
+	/* ~~~~~~~~~~~~~~~~~~~~ Save Current Position ~~~~~~~~~~~~~~~~~~~~ */
+	uint8_t  x_pos           = GLCD.X;
+	uint16_t y_pos           = GLCD.Y;
+	uint16_t y_pos_for_draw  = GLCD.Y;
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {width, height, mode};
+	
+	if (GLCD_ListRecord(_GLCD_OP_BITMAP, args, sizeof(args), &bitmap, sizeof(bitmap)))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	/* ~~~~~~~~~~~~~~~~ Read Width - First Two Bytes ~~~~~~~~~~~~~~~~~ */
+	data = GLCD.X + width; // "data" is used temporarily
+	
+	/* .....  Reduce Bitmap Data For Screen Size ..... */
+	if (data >= _GLCD_SCREEN_WIDTH)
+	{
+		width -= (data - _GLCD_SCREEN_WIDTH);
+	}
+	
+	/* ~~~~~~ Read Height - Second Two Bytes - Convert To Lines ~~~~~~ */
+	lines = (height + _GLCD_SCREEN_LINE_HEIGHT - 1) / _GLCD_SCREEN_LINE_HEIGHT; // lines = Ceiling(A/B) = (A+B-1)/B
+	data  = GLCD.Y / _GLCD_SCREEN_LINE_HEIGHT + lines; // "data" is used temporarily
+	
+	/* .....  Reduce Bitmap Data For Screen Size ..... */
+	if (data > _GLCD_SCREEN_LINES)
+	{
+		lines -= data - _GLCD_SCREEN_LINES;
+	}
+	
+	/* ~~~~~~~~~~~~~~~~~ Calculate Overflowing Bits ~~~~~~~~~~~~~~~~~~ */
+	overflow = GLCD.Y % _GLCD_SCREEN_LINE_HEIGHT;
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~ Print The Character ~~~~~~~~~~~~~~~~~~~~~ */
+	/* ..... Scan The Lines Needed ..... */
 	for (line_counter = 0; line_counter < lines; line_counter++)
 	{
 		
-		/* ::::::::::: Goto The Start Of The Line :::::::::::: */
-		GLCD_GotoXY(x_pos, y_pos_for_draw);
+		/* ::::::::::: Goto The Start Of The Line :::::::::::: */
+		GLCD_GotoXY(x_pos, y_pos_for_draw);
+		
+		/* ::::: Update The Indices For Reading The Line ::::: */
+		bmpRead     = line_counter * width;
+		bmpReadPrev = bmpRead - width; // Previous = 4 + (j - 1) * width = Current - width
+		
+		/* ::::::::::: Scan Bytes Of Selected Line ::::::::::: */
+		for (line_pixels_ounter = 0 ; line_pixels_ounter < width ; line_pixels_ounter++)
+		{
+			
+			/* ----------------- Read Byte --------------- */
+			data = pgm_read_byte(&(bitmap[bmpRead++]));
+			
+			/* ---------------- Shift Byte --------------- */
+			data <<= overflow;
+			
+			/* ------- Merge Byte With Previous One ------ */
+			if (line_counter > 0)
+			{
+				
+				dataPrev   = pgm_read_byte( &(bitmap[bmpReadPrev++]) );
+				dataPrev >>= _GLCD_SCREEN_LINE_HEIGHT - overflow;
+				data      |= dataPrev;
+				
+			}
+			
+			/* ----- Edit Byte Depending On The Mode ----- */
+			if (mode == _GLCD_PRINT_MODE_MERGE)
+			{
+				data |= GLCD_BufferRead(GLCD.X, GLCD.Y);
+			}
+			
+			/* ---------------- Send Byte ---------------- */
+			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
+			
+		}
+		
+		/* :::::: Send An Empty Column Of 1px In The End ::::: */
+		if (GLCD.Font.Mode == _GLCD_PRINT_MODE_OVERWRITE)
+		{
+			data = _GLCD_WHITE;
+		}
+		else
+		{
+			data = GLCD_BufferRead(GLCD.X, GLCD.Y);
+		}
+		
+		GLCD_BufferWrite(GLCD.X, GLCD.Y, data);
+		
+		/* :::::::::::::: Increase Line Counter :::::::::::::: */
+		y_pos_for_draw += _GLCD_SCREEN_LINE_HEIGHT;
+		
+	}
+	
+	/* ~~~~~~~~~~~~~~~~~ Update Last Line, If Needed ~~~~~~~~~~~~~~~~~ */
+	if (lines > 1)
+	{
+		
+		/* :::::::::::::::::: Goto The Start Of The Line :::::::::::::::::: */
+		GLCD_GotoXY(x_pos, y_pos_for_draw);
+		
+		/* ::::: Update The Indices For Reading The Last Printed Line ::::: */
+		bmpReadPrev = (line_counter - 1) * width;
+		
+		/* ::::::::::::::::: Scan Bytes Of Selected Line :::::::::::::::::: */
+		for (line_pixels_ounter = 0 ; line_pixels_ounter < width ; line_pixels_ounter++)
+		{
+			
+			/* ----------------- Read Byte --------------- */
+			data = GLCD_BufferRead(GLCD.X, GLCD.Y);
+			
+			/* ------- Merge Byte With Previous One ------ */
+			dataPrev   = pgm_read_byte( &(bitmap[bmpReadPrev++]) );
+			dataPrev >>= _GLCD_SCREEN_LINE_HEIGHT - overflow;
+			data      |= dataPrev;
+			
+			/* ----- Edit Byte Depending On The Mode ----- */
+			if (mode == _GLCD_PRINT_MODE_MERGE)
+			{
+				data |= GLCD_BufferRead(GLCD.X, GLCD.Y);
+			}
+			
+			/* ---------------- Send Byte ---------------- */
+			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
+			
+		}
+		
+		/* :::::::::::: Send An Empty Column Of 1px In The End :::::::::::: */
+		if (GLCD.Font.Mode == _GLCD_PRINT_MODE_OVERWRITE)
+		{
+			data = _GLCD_WHITE;
+		}
+		else if (GLCD.Font.Mode == _GLCD_PRINT_MODE_MERGE)
+		{
+			data = GLCD_BufferRead(GLCD.X, GLCD.Y);
+		}
+		else
+		{
+			data = ~GLCD_BufferRead(GLCD.X, GLCD.Y);
+		}
+		
+		GLCD_BufferWrite(GLCD.X++, GLCD.Y,data);
+		
+	}
+	
+	/* ~~~~~~ Goto The Upper-Right Corner Of The Printed Bitmap ~~~~~~ */
+	GLCD_GotoXY(GLCD_GetX(), y_pos);
+	
+}
+
+void GLCD_DrawLine(uint8_t startX, uint8_t startY, uint8_t endX, uint8_t endY, COLOR_TypeDef color)
+{
+	
+	int8_t error   = 0;
+	int8_t y_step  = 0;
+	
+	uint8_t deltax = 0;
+	uint8_t deltay = 0;
+	uint8_t x_pos  = 0;
+	uint8_t y_pos  = 0;
+	uint8_t slope  = 0;
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {startX, startY, endX, endY, color};
+	
+	if (GLCD_ListRecord(_GLCD_OP_LINE, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~ Check Value ~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	if ((startX < _GLCD_SCREEN_WIDTH) && (endX < _GLCD_SCREEN_WIDTH) &&
+	   (startY < _GLCD_SCREEN_HEIGHT) && (endY < _GLCD_SCREEN_HEIGHT))
+	{
+		
+		/* :::::::::: Check Line Pos :::::::::: */
+		if (startX == endX)
+		{
+			GLCD_DrawVLine(startY, endY, startX, color);
+		}
+		else if (startY == endY)
+		{
+			GLCD_DrawHLine(startX, endX, startY, color);
+		}
+		else
+		{
+			
+			/* ------------------ Check Slope ------------------ */
+			slope = ((__GLCD_AbsDiff(startY, endY) > __GLCD_AbsDiff(startX,endX)) ? 1 : 0);
+			
+			if (slope)
+			{
+				
+				/* """""""""" Swap startX, startY """""""""" */
+				__GLCD_Swap(startX, startY);
+				
+				/* """""""""""" Swap endX, endY """""""""""" */
+				__GLCD_Swap(endX, endY);
+				
+			}
+			
+			if (startX > endX)
+			{
+				
+				/* """"""""""" Swap startX, endX """"""""""" */
+				__GLCD_Swap(startX, endX);
+				
+				/* """"""""""" Swap startY, endY """"""""""" */
+				__GLCD_Swap(startY, endY);
+				
+			}
+			
+			/* ---------------- Calculate Param ---------------- */
+			deltax  = endX - startX;
+			deltay  = __GLCD_AbsDiff(endY, startY);
+			error   = deltax / 2;
+			y_pos   = startY;
+			y_step  = ((startY < endY) ? 1 : -1);
+			endX   += 1;
+			
+			/* ------------------ Set Pixels ------------------- */
+			for (x_pos = startX ; x_pos < endX ; x_pos++)
+			{
+				
+				if (slope)
+				{
+					GLCD_SetPixel(y_pos, x_pos, color);
+				}
+				else
+				{
+					GLCD_SetPixel(x_pos, y_pos, color);
+				}
+				
+				error -= deltay;
+				
+				if (error < 0)
+				{
+					y_pos = y_pos + y_step;
+					error = error + deltax;
+				}
+				
+			}
+			
+		}
+		
+	}
+	
+}
+
+void GLCD_DrawRectangle(const uint8_t startX, const uint8_t startY, const uint8_t endX, const uint8_t endY, COLOR_TypeDef color)
+{
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {startX, startY, endX, endY, color};
+	
+	if (GLCD_ListRecord(_GLCD_OP_RECTANGLE, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	if ((startX < _GLCD_SCREEN_WIDTH) && (endX < _GLCD_SCREEN_WIDTH) &&
+	    (startY < _GLCD_SCREEN_HEIGHT) && (endY < _GLCD_SCREEN_HEIGHT))
+	{
+		
+		GLCD_DrawHLine(startX, endX, startY, color);
+		GLCD_DrawHLine(startX, endX, endY, color);
+		GLCD_DrawVLine(startY, endY, startX, color);
+		GLCD_DrawVLine(startY, endY, endX, color);
+		
+	}
+	
+}
+
+void GLCD_DrawRoundRectangle(const uint8_t startX, const uint8_t startY, const uint8_t endX, const uint8_t endY, const uint8_t radius, COLOR_TypeDef color)
+{
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {startX, startY, endX, endY, radius, color};
+	
+	if (GLCD_ListRecord(_GLCD_OP_ROUND_RECTANGLE, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	if ((startX<_GLCD_SCREEN_WIDTH) && (endX<_GLCD_SCREEN_WIDTH) && (startY<_GLCD_SCREEN_HEIGHT) && (endY<_GLCD_SCREEN_HEIGHT))
+	{
+		
+		uint8_t width;
+		uint8_t height;
+		uint8_t x;
+		uint8_t y;
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */
+		int16_t tSwitch = 3 - 2 * radius;
+		
+		width  = endX - startX;
+		height = endY - startY;
+		x      = 0;
+		y      = radius;
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~~~ Draw Perimeter ~~~~~~~~~~~~~~~~~~~~~~~~ */
+		GLCD_DrawHLine(startX + radius, endX - radius, startY, color); // Top
+		GLCD_DrawHLine(startX + radius, endX - radius, endY, color); // Bottom
+		GLCD_DrawVLine(startY + radius, endY - radius, startX, color); // Left
+		GLCD_DrawVLine(startY + radius, endY - radius, endX, color); // Right
+		
+		while (x <= y)
+		{
+			
+			/* :::::::::::: Upper left corner :::::::::::: */
+			GLCD_SetPixel(startX + radius - x, startY + radius - y, color);
+			GLCD_SetPixel(startX + radius - y, startY + radius - x, color);
+
+			/* :::::::::::: Upper right corner ::::::::::: */
+			GLCD_SetPixel(startX + width - radius + x, startY + radius - y, color);
+			GLCD_SetPixel(startX + width - radius + y, startY + radius - x, color);
+
+			/* :::::::::::: Lower left corner :::::::::::: */
+			GLCD_SetPixel(startX + radius - x, startY + height - radius + y, color);
+			GLCD_SetPixel(startX + radius - y, startY + height - radius + x, color);
+
+			/* :::::::::::: Lower right corner ::::::::::: */
+			GLCD_SetPixel(startX + width - radius + x, startY + height - radius + y, color);
+			GLCD_SetPixel(startX + width - radius + y, startY + height - radius + x, color);
+
+			if (tSwitch < 0)
+			{
+				tSwitch += 4 * x + 6;
+			}
+			else
+			{
+				tSwitch += 4 * (x - y) + 10;
+				y--;
+			}
+			
+			x++;
+			
+		}
+		
+	}
+	
+}
+
+void GLCD_DrawTriangle(const uint8_t x1, const uint8_t y1, const uint8_t x2, const uint8_t y2, const uint8_t x3, const uint8_t y3, COLOR_TypeDef color)
+{
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {x1, y1, x2, y2, x3, y3, color};
+	
+	if (GLCD_ListRecord(_GLCD_OP_TRIANGLE, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	if (((x1 < _GLCD_SCREEN_WIDTH) && (x2 < _GLCD_SCREEN_WIDTH) && (x3 < _GLCD_SCREEN_WIDTH) &&
+		(y1 < _GLCD_SCREEN_HEIGHT) && (y2 < _GLCD_SCREEN_HEIGHT) && (y3 < _GLCD_SCREEN_HEIGHT)))
+	{
+		
+		GLCD_DrawLine(x1, y1, x2, y2, color);
+		GLCD_DrawLine(x2, y2, x3, y3, color);
+		GLCD_DrawLine(x3, y3, x1, y1, color);
+		
+	}
+	
+}
+
+void GLCD_DrawCircle(const uint8_t centerX, const uint8_t centerY, const uint8_t radius, COLOR_TypeDef color)
+{
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {centerX, centerY, radius, color};
+	
+	if (GLCD_ListRecord(_GLCD_OP_CIRCLE, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	if (((centerX + radius) < _GLCD_SCREEN_WIDTH) && ((centerY + radius) < _GLCD_SCREEN_HEIGHT))
+	{
+		
+		uint8_t  x;
+		uint8_t  y;
+		
+		uint16_t yChange;
+		
+		int16_t  xChange;
+		int16_t  radiusError;
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */
+		x           = radius;
+		y           = 0;
+		xChange     = 1 - 2 * radius;
+		yChange     = 1;
+		radiusError = 0;
+		
+		while (x >= y)
+		{
+			
+			GLCD_SetPixel(centerX + x, centerY + y, color);
+			GLCD_SetPixel(centerX - x, centerY + y, color);
+			GLCD_SetPixel(centerX - x, centerY - y, color);
+			GLCD_SetPixel(centerX + x, centerY - y, color);
+			GLCD_SetPixel(centerX + y, centerY + x, color);
+			GLCD_SetPixel(centerX - y, centerY + x, color);
+			GLCD_SetPixel(centerX - y, centerY - x, color);
+			GLCD_SetPixel(centerX + y, centerY - x, color);
+			
+			/* ::::::::::::::::::::::::::::::::::::::::::: */
+			y++;
+			radiusError += yChange;
+			yChange     += 2;
+			
+			if ((2 * radiusError + xChange) > 0)
+			{
+				
+				x--;
+				radiusError += xChange;
+				xChange     += 2;
+				
+			}
+			
+		}
+		
+	}
+	
+}
+
+void GLCD_FillScreen(COLOR_TypeDef color)
+{
+	
+	uint8_t i;
+	uint8_t j;
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {color};
+	
+	/* ..... Every earlier op is covered, the list starts over ..... */
+	if (GLCD_List.Mode == _GLCD_LIST_RECORD)
+	{
+		
+		GLCD_ListReset();
+		
+		if (color == _GLCD_WHITE)
+		{
+			return; // Pages are rasterised on white
+		}
+		
+	}
+	
+	if (GLCD_ListRecord(_GLCD_OP_FILL_SCREEN, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	#ifdef _GLCD_DIRECT_TEXT
+	uint8_t block[_GLCD_CLEAR_BLOCK];
+	
+	/* ..... Blank is one burst, other colours a streamed block per page ..... */
+	if (color == _GLCD_WHITE)
+	{
+		
+		GLCD_ClearGDDRAM();
+		
+		return;
+		
+	}
+	
+	memset(block, color, sizeof(block));
+	
+	for (j = 0; j < _GLCD_SCREEN_LINES; j++)
+	{
+		GLCD_DirectWrite(0, j, block, _GLCD_SCREEN_WIDTH, 1);
+	}
+	
+	return;
+	#endif /* _GLCD_DIRECT_TEXT */
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	for (j = 0 ; j < _GLCD_SCREEN_HEIGHT ; j += _GLCD_SCREEN_LINE_HEIGHT)
+	{
+		
+		for (i = 0 ; i < _GLCD_SCREEN_WIDTH ; i++)
+		{
+			GLCD_BufferWrite(i, j, color);
+		}
+		
+	}
+			
+}
+
+void GLCD_DrawFilledRectangle(const uint8_t startX, const uint8_t startY, const uint8_t endX, const uint8_t endY, COLOR_TypeDef color)
+{
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {startX, startY, endX, endY, color};
+	
+	if (GLCD_ListRecord(_GLCD_OP_FILLED_RECTANGLE, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	GLCD_SetPixels(startX, startY, endX, endY, color);
+}
+
+void GLCD_DrawFilledRoundRectangle(const uint8_t startX, const uint8_t startY, const uint8_t endX, const uint8_t endY, const uint8_t radius, COLOR_TypeDef color)
+{
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {startX, startY, endX, endY, radius, color};
+	
+	if (GLCD_ListRecord(_GLCD_OP_FILLED_ROUND_RECTANGLE, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	if ((startX < _GLCD_SCREEN_WIDTH) && (endX < _GLCD_SCREEN_WIDTH) && (startY < _GLCD_SCREEN_HEIGHT) && (endY < _GLCD_SCREEN_HEIGHT))
+	{
+		
+		uint8_t width;
+		uint8_t height;
+		uint8_t x;
+		uint8_t y;
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */
+		int16_t tSwitch = 3 - 2 * radius;
+		
+		width  = endX - startX;
+		height = endY - startY;
+		x      = 0;
+		y      = radius;
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~~ Fill Center Block ~~~~~~~~~~~~~~~~~~~~~~ */
+		GLCD_DrawFilledRectangle(startX + radius, startY, endX - radius, endY, color);
+		
+		while (x <= y)
+		{
+			
+			/* :::::::::::::::: Left side :::::::::::::::: */
+			GLCD_DrawLine(startX + radius - x, startY + radius - y, // Upper left corner upper half
+			              startX + radius - x, startY + height - radius + y, // Lower left corner lower half
+			              color);
+						  
+			GLCD_DrawLine(startX + radius - y, startY + radius - x, // Upper left corner lower half
+			              startX + radius - y, startY + height - radius + x, // Lower left corner upper half
+			              color);
+						
+			/* :::::::::::::::: Right side ::::::::::::::: */
+			GLCD_DrawLine(startX + width - radius	+ x, startY + radius - y, // Upper right corner upper half
+			              startX + width - radius + x, startY + height - radius + y, // Lower right corner lower half
+			              color);
+			
+			GLCD_DrawLine(startX + width - radius + y, startY + radius - x, // Upper right corner lower half
+			              startX + width - radius + y, startY + height - radius + x, // Lower right corner upper half
+			              color);
+			
+			/* ::::::::::::::::::::::::::::::::::::::::::: */
+			if (tSwitch < 0)
+			{
+				tSwitch += 4 * x +6;
+			}
+			else
+			{
+				tSwitch += 4 * (x - y) + 10;
+				y--;
+			}
+			
+			x++;
+			
+		}
+		
+	}
+	
+}
+
+void GLCD_DrawFilledTriangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t x3, uint8_t y3, COLOR_TypeDef color)
+{
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {x1, y1, x2, y2, x3, y3, color};
+	
+	if (GLCD_ListRecord(_GLCD_OP_FILLED_TRIANGLE, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	if (((x1 < _GLCD_SCREEN_WIDTH) && (x2 < _GLCD_SCREEN_WIDTH) && (x3 < _GLCD_SCREEN_WIDTH) &&
+		(y1 < _GLCD_SCREEN_HEIGHT) && (y2 < _GLCD_SCREEN_HEIGHT) && (y3 < _GLCD_SCREEN_HEIGHT)))
+	{
+		
+		uint8_t sl  = 0;
+		uint8_t sx1 = 0;
+		uint8_t sx2 = 0;
+		
+		double  m1  = 0;
+		double  m2  = 0;
+		double  m3  = 0;
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */	
+		if (y2 > y3)
+		{
+			__GLCD_Swap(x2, x3);
+			__GLCD_Swap(y2, y3);
+		}
+		
+		if (y1 > y2)
+		{
+			__GLCD_Swap(x1, x2);
+			__GLCD_Swap(y1, y2);
+		}
+		
+		m1 = (double)(x1 - x2) / (y1 - y2);
+		m2 = (double)(x2 - x3) / (y2 - y3);
+		m3 = (double)(x3 - x1) / (y3 - y1);
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~~~ Draw In Display ~~~~~~~~~~~~~~~~~~~~~~~ */
+		for(sl = y1; sl <= y2; sl++)
+		{
+			
+			/* :::::::::::::::: Calculate :::::::::::::::: */
+			sx1 = m1 * (sl - y1) + x1;
+			sx2 = m3 * (sl - y1) + x1;
+			
+			if (sx1 > sx2)
+			{
+				__GLCD_Swap(sx1, sx2);
+			}
+			
+			/* :::::::::::::::: Draw line :::::::::::::::: */
+			GLCD_DrawLine(sx1, sl, sx2, sl, color);
+			
+		}
+		
+		for (sl = y2; sl <= y3; sl++)
+		{
+			
+			/* :::::::::::::::: Calculate :::::::::::::::: */
+			sx1 = m2 * (sl - y3) + x3;
+			sx2 = m3 * (sl - y1) + x1;
+			
+			if (sx1 > sx2)
+			{
+				__GLCD_Swap(sx1, sx2);
+			}
+			
+			/* :::::::::::::::: Draw line :::::::::::::::: */
+			GLCD_DrawLine(sx1, sl, sx2, sl, color);
+			
+		}
+		
+	}
+	
+}
+
+void GLCD_DrawFilledCircle(const uint8_t centerX, const uint8_t centerY, const uint8_t radius, COLOR_TypeDef color)
+{
+	
+	#ifdef _GLCD_PAGE_MODE
+	const uint8_t args[] = {centerX, centerY, radius, color};
+	
+	if (GLCD_ListRecord(_GLCD_OP_FILLED_CIRCLE, args, sizeof(args), NULL, 0))
+	{
+		return;
+	}
+	#endif /* _GLCD_PAGE_MODE */
+	
+	if (((centerX + radius) < _GLCD_SCREEN_WIDTH) && ((centerY + radius) < _GLCD_SCREEN_HEIGHT))
+	{
+		
+		uint8_t x;
+		uint8_t y;
+		
+		int8_t  f;
+		int8_t  ddF_x;
+		int8_t  ddF_y;
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */	
+		f     = 1 - radius;
+		ddF_x = 1;
+		ddF_y = -2 * radius;
+		x     = 0;
+		y     = radius;
+		
+		/* ~~~~~~~~~~ Fill in the center between the two halves ~~~~~~~~~~ */
+		GLCD_DrawLine(centerX, centerY - radius, centerX, centerY + radius, color);
+
+		while(x < y)
+		{
+			
+			//ddF_x = 2 * x + 1;
+			//ddF_y = -2 * y;
+			//f     = x * x + y * y - radius * radius + 2 * x - y + 1;
+			
+			/* :::::::::::::::: Calculate :::::::::::::::: */
+			if (f >= 0)
+			{
+				
+				y--;
+				ddF_y += 2;
+				f     += ddF_y;
+				
+			}
+			
+			x++;
+			ddF_x += 2;
+			f     += ddF_x;
+			
+			/* :::::::::::::::: Draw line :::::::::::::::: */
+			/*
+			  Now draw vertical lines between the points on the circle rather than
+			  draw the points of the circle. This draws lines between the
+			  perimeter points on the upper and lower quadrants of the 2 halves of the circle.
+			*/
+			GLCD_DrawVLine(centerY + y, centerY - y, centerX + x, color);
+			GLCD_DrawVLine(centerY + y, centerY - y, centerX - x, color);
+			GLCD_DrawVLine(centerY + x, centerY - x, centerX + y, color);
+			GLCD_DrawVLine(centerY + x, centerY - x, centerX - y, color);
+			
+		}
+		
+	}
+	
+}
+
+/* :::::::::::::::::::: Scroll :::::::::::::::::::: */
+void GLCD_ScrollLeft(const uint8_t start, const uint8_t end)
+{
+	
+	// The display is 16 rows tall. To scroll the whole display, run:
+	GLCD_QueueCommand(_GLCD_CMD_SCROLL_LEFT);
+	GLCD_QueueCommand(0x00); //Dummy
+
+	GLCD_QueueCommand(start); //Start
+	GLCD_QueueCommand(0x00); //Frames: 5
+	GLCD_QueueCommand(end); //End
+
+	GLCD_QueueCommand(0x00); //Dummy
+	GLCD_QueueCommand(UINT8_MAX); //Dummy
+	GLCD_QueueCommand(_GLCD_CMD_SCROLL_ACTIVE);
+	
+	GLCD_Display->Shadow.Scroll = (GLCD_FlushCommands() == _GLCD_OK) ? _GLCD_CMD_SCROLL_ACTIVE : _GLCD_SHADOW_UNKNOWN;
+	
+}
+
+void GLCD_ScrollRight(const uint8_t start, const uint8_t end)
+{
+	
+	// The display is 16 rows tall. To scroll the whole display, run:
+	GLCD_QueueCommand(_GLCD_CMD_SCROLL_RIGHT);
+	GLCD_QueueCommand(0x00); //Dummy
+
+	GLCD_QueueCommand(start); //Start
+	GLCD_QueueCommand(0x00); //Frames: 5
+	GLCD_QueueCommand(end); //End
+
+	GLCD_QueueCommand(0x00); //Dummy
+	GLCD_QueueCommand(UINT8_MAX); //Dummy
+	GLCD_QueueCommand(_GLCD_CMD_SCROLL_ACTIVE);
+	
+	GLCD_Display->Shadow.Scroll = (GLCD_FlushCommands() == _GLCD_OK) ? _GLCD_CMD_SCROLL_ACTIVE : _GLCD_SHADOW_UNKNOWN;
+	
+}
+
+void GLCD_ScrollDiagonalLeft(const uint8_t start, const uint8_t end)
+{
+	
+	// The display is 16 rows tall. To scroll the whole display, run:
+	GLCD_QueueCommand(_GLCD_CMD_SCROLL_VAREA_SET);
+	GLCD_QueueCommand(0x00);
+	GLCD_QueueCommand(_GLCD_SCREEN_HEIGHT);
+
+	GLCD_QueueCommand(_GLCD_CMD_SCROLL_VLEFT);
+	GLCD_QueueCommand(0x00); //Dummy
+	GLCD_QueueCommand(start); //Start
+	GLCD_QueueCommand(0x00); //Frames: 5
+	GLCD_QueueCommand(end); //End
+	GLCD_QueueCommand(0x01); //Vertical offset: 1
+
+	GLCD_QueueCommand(_GLCD_CMD_SCROLL_ACTIVE);
+	
+	GLCD_Display->Shadow.Scroll = (GLCD_FlushCommands() == _GLCD_OK) ? _GLCD_CMD_SCROLL_ACTIVE : _GLCD_SHADOW_UNKNOWN;
+	
+}
+
+void GLCD_ScrollDiagonalRight(const uint8_t start, const uint8_t end)
+{
+	
+	// The display is 16 rows tall. To scroll the whole display, run:
+	GLCD_QueueCommand(_GLCD_CMD_SCROLL_VAREA_SET);
+	GLCD_QueueCommand(0x00);
+	GLCD_QueueCommand(_GLCD_SCREEN_HEIGHT);
+
+	GLCD_QueueCommand(_GLCD_CMD_SCROLL_VRIGHT);
+	GLCD_QueueCommand(0x00); //Dummy
+	GLCD_QueueCommand(start); //Start
+	GLCD_QueueCommand(0x00); //Frames: 5
+	GLCD_QueueCommand(end); //End
+	GLCD_QueueCommand(0x01); //Vertical offset: 1
+
+	GLCD_QueueCommand(_GLCD_CMD_SCROLL_ACTIVE);
+	
+	GLCD_Display->Shadow.Scroll = (GLCD_FlushCommands() == _GLCD_OK) ? _GLCD_CMD_SCROLL_ACTIVE : _GLCD_SHADOW_UNKNOWN;
+	
+}
+
+void GLCD_ScrollStop(void)
+{
+	
+	uint8_t command = _GLCD_CMD_SCROLL_DEACTIVE;
+	
+	GLCD_ShadowSend(&GLCD_Display->Shadow.Scroll, command, &command, 1);
+	
+}
+
+/* ::::::::::::::::::::: Font ::::::::::::::::::::: */
+void GLCD_SetFont(const uint8_t *name, const uint8_t width, const uint8_t height, GLCD_PrintModeTypeDef mode)
+{
+	
+	if ((width < _GLCD_SCREEN_WIDTH) && (height < _GLCD_SCREEN_HEIGHT) && ((mode == _GLCD_PRINT_MODE_OVERWRITE) || (mode == _GLCD_PRINT_MODE_MERGE)))
+	{
+		
+		/* ~~~~~~~~~~~~~~~~~ Change font pointer to new font ~~~~~~~~~~~~~~~~~ */
+		GLCD.Font.Name = (uint8_t *)(name);
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~~~~ Update font's size ~~~~~~~~~~~~~~~~~~~~~~~ */
+		GLCD.Font.Width  = width;
+		GLCD.Font.Height = height;
+		
+		/* ~~~ Update lines required for a character to be fully displayed ~~~ */
+		GLCD.Font.Lines = (height - 1) / _GLCD_SCREEN_LINE_HEIGHT + 1;
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~~~ Update blending mode ~~~~~~~~~~~~~~~~~~~~~~ */
+		GLCD.Font.Mode = mode;
+		
+	}
+	
+}
+
+/* :::::::::::::::::::::::::::::::::::::::::::::::: */
+#ifdef _GLCD_PAGE_MODE
+static void GLCD_BufferWrite(const uint8_t x, const uint8_t y, const uint8_t data)
+{
+	
+	uint8_t line = y / _GLCD_SCREEN_LINE_HEIGHT;
+	
+	/* ~~~~~~~~~~~ Only the page being rasterised is kept ~~~~~~~~~~~ */
+	if ((x < _GLCD_SCREEN_WIDTH) && (line < _GLCD_SCREEN_LINES))
+	{
+		
+		GLCD_List.Touched |= (uint8_t)(1U << line);
+		
+		if ((GLCD_List.Mode == _GLCD_LIST_RASTER) && (line == GLCD_List.Page))
+		{
+			GLCD_Display->Buffer[x] = data;
+		}
+		
+	}
+	
+}
+
+static uint8_t GLCD_BufferRead(const uint8_t x, const uint8_t y)
+{
+	
+	if ((GLCD_List.Mode == _GLCD_LIST_RASTER) && ((y / _GLCD_SCREEN_LINE_HEIGHT) == GLCD_List.Page) && (x < _GLCD_SCREEN_WIDTH))
+	{
+		return GLCD_Display->Buffer[x];
+	}
+	
+	return _GLCD_WHITE; // Other pages are not in RAM
+	
+}
+#elif defined(_GLCD_DIRECT_TEXT)
+static void GLCD_BufferWrite(const uint8_t x, const uint8_t y, const uint8_t data)
+{
+	
+	uint8_t line = y / _GLCD_SCREEN_LINE_HEIGHT;
+	
+	if (!GLCD_Run.Open)
+	{
+		
+		GLCD_DirectWrite(x, line, &data, 1, 0);
+		
+		return;
+		
+	}
+	
+	/* ~~~~~~~~~~ Bytes of a column run go out with one addressing ~~~~~~~~~~ */
+	if ((GLCD_Run.Count == _GLCD_GLYPH_STAGE) || (line != GLCD_Run.Line) || (x != (GLCD_Run.X + GLCD_Run.Count)))
+	{
+		
+		GLCD_RunEnd();
+		
+		GLCD_Run.Open = 1;
+		GLCD_Run.X    = x;
+		GLCD_Run.Line = line;
+		
+	}
+	
+	GLCD_Run.Data[GLCD_Run.Count++] = data;
+	
+}
+
+static uint8_t GLCD_BufferRead(const uint8_t x, const uint8_t y)
+{
+	
+	(void)x;
+	(void)y;
+	
+	return _GLCD_WHITE; // GDDRAM is not read back over the bus
+	
+}
+#else
+static void GLCD_BufferWrite(const uint8_t x, const uint8_t y, const uint8_t data)
+{
+	
+	uint16_t index = __GLCD_Pointer(x, y);
+	
+	/* ~~~~~~~~~~~ Only a real change makes the page dirty ~~~~~~~~~~~ */
+	if ((index < _GLCD_BUFFER_SIZE) && (__GLCD_Canvas(GLCD_Display)[index] != data))
+	{
+		
+		__GLCD_Canvas(GLCD_Display)[index] = data;
+		
+		/* ..... Triple buffer: Dirty is the renderer's, the span goes with the published frame ..... */
+		#ifdef _GLCD_TRIPLE_BUFFER
+		GLCD_TripleMark(index / _GLCD_SCREEN_WIDTH, index % _GLCD_SCREEN_WIDTH);
+		#else
+		GLCD_MarkDirty(index / _GLCD_SCREEN_WIDTH, index % _GLCD_SCREEN_WIDTH, index % _GLCD_SCREEN_WIDTH);
+		#endif /* _GLCD_TRIPLE_BUFFER */
+		
+	}
+	
+}
+
+static uint8_t GLCD_BufferRead(const uint8_t x, const uint8_t y)
+{
+	// y >> 3 = y / 8
+	return (__GLCD_Canvas(GLCD_Display)[__GLCD_Pointer(x, y)]);
+}
+#endif /* _GLCD_PAGE_MODE */
+
+static inline void GLCD_MarkDirty(const uint8_t line, const uint8_t startX, const uint8_t endX)
+{
+	
+	#ifdef _GLCD_DIRECT_TEXT
+	
+	(void)line;
+	(void)startX;
+	(void)endX;
+	
+	#else
+	
+	if ((GLCD_Display->Dirty.Start[line] == _GLCD_DIRTY_NONE) || (startX < GLCD_Display->Dirty.Start[line]))
+	{
+		GLCD_Display->Dirty.Start[line] = startX;
+	}
+	
+	if (endX > GLCD_Display->Dirty.End[line])
+	{
+		GLCD_Display->Dirty.End[line] = endX;
+	}
+	
+	#endif /* _GLCD_DIRECT_TEXT */
+	
+}
+
+static uint8_t GLCD_IsPending(GLCD_DisplayTypeDef *display)
+{
+	
+	uint8_t line_counter = 0;
+	
+	#ifdef _GLCD_TRIPLE_BUFFER
+	if (_GLCD_ATOMIC_LOAD(&display->Triple.Ready) & _GLCD_TRIPLE_FRESH)
+	{
+		return 1; // Taken by the render, not while a stepped frame runs
+	}
+	#endif
+	
+	#ifdef _GLCD_PAGE_HASH
+	GLCD_HashPages(display);
+	#endif
+	
+	for (; line_counter < _GLCD_SCREEN_LINES; line_counter++)
+	{
+		
+		if (display->Dirty.Start[line_counter] != _GLCD_DIRTY_NONE)
+		{
+			return 1;
+		}
+		
+	}
+	
+	return 0;
+	
+}
+
+#ifdef _GLCD_PAGE_HASH
+static uint32_t GLCD_Hash(uint32_t hash, const uint8_t *data, uint8_t words)
+{
+	
+	/* FNV-1a over 32-bit words: a quarter of the multiplies of the byte form.
+	   The multiply only carries upward, so the high half is folded down after
+	   it; without that, bit 31 of two words (bottom pixel of columns 4k+3)
+	   could flip and leave the hash as it was */
+	uint32_t word;
+	
+	for (; words > 0; words--)
+	{
+		
+		word  = (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+		hash  = (hash ^ word) * _GLCD_HASH_PRIME;
+		hash ^= hash >> 15;
+		
+		data += 4;
+		
+	}
+	
+	return hash;
+	
+}
+
+static void GLCD_HashPages(GLCD_DisplayTypeDef *display)
+{
+	
+	uint32_t hash;
+	uint16_t offset = 0;
+	uint8_t  line_counter;
+	uint8_t  segment;
+	uint8_t  startX;
+	uint8_t  index  = 0;
+	
+	#ifdef _GLCD_LAYERS
+	uint8_t  layer;
+	#endif
+	
+	for (line_counter = 0; line_counter < _GLCD_SCREEN_LINES; line_counter++)
+	{
+		
+		for (segment = 0; segment < _GLCD_HASH_SEGMENTS; segment++, index++)
+		{
+			
+			hash = GLCD_Hash(_GLCD_HASH_SEED, &__GLCD_Shown(display)[offset], _GLCD_HASH_SPAN / 4);
+			
+			#ifdef _GLCD_LAYERS
+			
+			/* ..... Overlays are chained in, with their ROP and invert ..... */
+			for (layer = 0; layer < display->Layers.Count; layer++)
+			{
+				hash ^= ((uint32_t)display->Layers.Layer[layer].Rop << 1) | display->Layers.Layer[layer].Invert;
+				hash  = GLCD_Hash(hash, &display->Layers.Layer[layer].Buffer[offset], _GLCD_HASH_SPAN / 4);
+			}
+			
+			#endif /* _GLCD_LAYERS */
+			
+			offset += _GLCD_HASH_SPAN;
+			
+			if (hash == display->Dirty.Hash[index])
+			{
+				continue;
+			}
+			
+			/* ~~~~~~~~~~~~~~~~ Changed since the last render: send the whole span ~~~~~~~~~~~~~~~~ */
+			display->Dirty.Hash[index] = hash;
+			
+			startX = segment * _GLCD_HASH_SPAN;
+			
+			if ((display->Dirty.Start[line_counter] == _GLCD_DIRTY_NONE) || (startX < display->Dirty.Start[line_counter]))
+			{
+				display->Dirty.Start[line_counter] = startX;
+			}
+			
+			if ((startX + _GLCD_HASH_SPAN - 1) > display->Dirty.End[line_counter])
+			{
+				display->Dirty.End[line_counter] = startX + _GLCD_HASH_SPAN - 1;
+			}
+			
+		}
+		
+	}
+	
+}
+#endif /* _GLCD_PAGE_HASH */
+
+#ifdef _GLCD_TRIPLE_BUFFER
+static void GLCD_TripleTake(GLCD_DisplayTypeDef *display)
+{
+	
+	GLCD_TripleTypeDef *triple = &display->Triple;
+	
+	/* ~~~~~~~~~~~~ Newest frame in, the one sent before goes back to the slot ~~~~~~~~~~~~ */
+	if (_GLCD_ATOMIC_LOAD(&triple->Ready) & _GLCD_TRIPLE_FRESH)
+	{
+		
+		triple->Show = _GLCD_ATOMIC_XCHG(&triple->Ready, triple->Show) & _GLCD_TRIPLE_INDEX;
+		
+		/* ..... Spans of the frame are planned even when the page hash collides ..... */
+		GLCD_TripleMerge(display->Dirty.Start, display->Dirty.End, triple->Start[triple->Show], triple->End[triple->Show]);
+		
+	}
+	
+}
+
+static void GLCD_TripleMark(const uint8_t line, const uint8_t x)
+{
+	
+	GLCD_TripleTypeDef *triple = &GLCD_Display->Triple;
+	uint8_t             draw   = triple->Draw;
+	
+	if ((triple->Start[draw][line] == _GLCD_DIRTY_NONE) || (x < triple->Start[draw][line]))
+	{
+		triple->Start[draw][line] = x;
+	}
+	
+	if (x > triple->End[draw][line])
+	{
+		triple->End[draw][line] = x;
+	}
+	
+}
+
+static void GLCD_TripleMerge(uint8_t *start, uint8_t *end, const uint8_t *addStart, const uint8_t *addEnd)
+{
+	
+	uint8_t line_counter = 0;
+	
+	for (; line_counter < _GLCD_SCREEN_LINES; line_counter++)
+	{
+		
+		if (addStart[line_counter] == _GLCD_DIRTY_NONE)
+		{
+			continue;
+		}
+		
+		if ((start[line_counter] == _GLCD_DIRTY_NONE) || (addStart[line_counter] < start[line_counter]))
+		{
+			start[line_counter] = addStart[line_counter];
+		}
+		
+		if (addEnd[line_counter] > end[line_counter])
+		{
+			end[line_counter] = addEnd[line_counter];
+		}
+		
+	}
+	
+}
+
+static void GLCD_TripleClean(GLCD_TripleTypeDef *triple, const uint8_t frame)
+{
+	
+	uint8_t line_counter = 0;
+	
+	for (; line_counter < _GLCD_SCREEN_LINES; line_counter++)
+	{
+		triple->Start[frame][line_counter] = _GLCD_DIRTY_NONE;
+		triple->End[frame][line_counter]   = 0;
+	}
+	
+}
+#endif /* _GLCD_TRIPLE_BUFFER */
+
+#ifdef _GLCD_PAGE_FLIP
+static uint8_t GLCD_FlipBack(void)
+{
+	/* Half the start line does not show, the upper one while it is not known */
+	
+	return ((GLCD_Display->Shadow.StartLine == (_GLCD_SCREEN_LINES * _GLCD_SCREEN_LINE_HEIGHT)) ? 0 : 1);
+	
+}
+
+static void GLCD_FlipFold(void)
+{
+	/* New changes are owed to both halves, the hidden one gets all it lacks
+	
+	Plan:           GLCD_PlanRender has sent the hidden half's lag with them,
+	                the other half keeps the new changes
+	Nothing New:    Dirty stays empty, the hidden half waits for the next change
+	
+	*/
+	
+	GLCD_DirtyTypeDef *dirty = &GLCD_Display->Dirty;
+	uint8_t            back  = GLCD_FlipBack();
+	uint8_t            shown = back ^ 1;
+	uint8_t            line_counter;
+	
+	for (line_counter = 0; (line_counter < _GLCD_SCREEN_LINES) && (dirty->Start[line_counter] == _GLCD_DIRTY_NONE); line_counter++);
+	
+	if (line_counter == _GLCD_SCREEN_LINES)
+	{
+		return;
+	}
+	
+	for (line_counter = 0; line_counter < _GLCD_SCREEN_LINES; line_counter++)
+	{
+		
+		/* ~~~~~~~~~~~~~~~~~~~~ Shown half lacks the new span ~~~~~~~~~~~~~~~~~~~~ */
+		if (dirty->Start[line_counter] != _GLCD_DIRTY_NONE)
+		{
+			
+			if ((dirty->LagStart[shown][line_counter] == _GLCD_DIRTY_NONE) || (dirty->Start[line_counter] < dirty->LagStart[shown][line_counter]))
+			{
+				dirty->LagStart[shown][line_counter] = dirty->Start[line_counter];
+			}
+			
+			if (dirty->End[line_counter] > dirty->LagEnd[shown][line_counter])
+			{
+				dirty->LagEnd[shown][line_counter] = dirty->End[line_counter];
+			}
+			
+		}
+		
+		/* ~~~~~~~~~~~~~~~~~~ The hidden half is in the plan ~~~~~~~~~~~~~~~~~~ */
+		dirty->LagStart[back][line_counter] = _GLCD_DIRTY_NONE;
+		dirty->LagEnd[back][line_counter]   = 0;
+		
+	}
+	
+}
+
+static void GLCD_FlipLost(const GLCD_CursorTypeDef *cursor)
+{
+	
+	/* ..... Start line command was in the failed transfer, the shown half is not known ..... */
+	if (cursor->Rect > GLCD_Plan.Count)
+	{
+		GLCD_Display->Shadow.StartLine = _GLCD_SHADOW_UNKNOWN;
+	}
+	
+}
+
+static void GLCD_FlipReset(GLCD_DisplayTypeDef *display)
+{
+	
+	uint8_t line_counter = 0;
+	
+	for (; line_counter < _GLCD_SCREEN_LINES; line_counter++)
+	{
+		display->Dirty.LagStart[0][line_counter] = display->Dirty.LagStart[1][line_counter] = _GLCD_DIRTY_NONE;
+		display->Dirty.LagEnd[0][line_counter]   = display->Dirty.LagEnd[1][line_counter]   = 0;
+	}
+	
+}
+#endif /* _GLCD_PAGE_FLIP */
+
+#ifdef _GLCD_LAYERS
+static void GLCD_LayerRop(uint8_t *dst, const uint8_t *src, uint16_t size, const GLCD_RopTypeDef rop, const uint8_t invert)
+{
+	/* dst = (dst & A) ^ (src & B) ^ (dst & src & C), every mask is 0 or all ones
+	
+	COPY:           A = 0, B = 1, C = 0
+	OR:             A = 1, B = 1, C = 1 (d ^ s ^ d.s)
+	AND_NOT:        A = 1, B = 0, C = 1 (d ^ d.s)
+	XOR:            A = 1, B = 1, C = 0
+	
+	*/
+	
+	static const uint8_t rop_masks[] = {0x02, 0x07, 0x05, 0x03}; // Bit 0: A, 1: B, 2: C
+	
+	uint32_t a   = (rop_masks[rop] & 0x01) ? UINT32_MAX : 0;
+	uint32_t b   = (rop_masks[rop] & 0x02) ? UINT32_MAX : 0;
+	uint32_t c   = (rop_masks[rop] & 0x04) ? UINT32_MAX : 0;
+	uint32_t inv = invert ? UINT32_MAX : 0;
+	uint32_t d;
+	uint32_t s;
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~ Word at a time ~~~~~~~~~~~~~~~~~~~~~~~ */
+	for (; size >= 4; size -= 4, dst += 4, src += 4)
+	{
+		
+		memcpy(&d, dst, 4); // Single load where the core allows unaligned words
+		memcpy(&s, src, 4);
+		
+		s ^= inv;
+		d  = (d & a) ^ (s & b) ^ (d & s & c);
+		
+		memcpy(dst, &d, 4);
+		
+	}
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~ Tail ~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	for (; size > 0; size--, dst++, src++)
+	{
+		
+		s    = *src ^ inv;
+		*dst = (uint8_t)((*dst & a) ^ (s & b) ^ (*dst & s & c));
+		
+	}
+	
+}
+
+static void GLCD_LayerCompose(uint8_t *dst, const uint16_t offset, const uint16_t size)
+{
+	
+	const GLCD_LayerTypeDef *layer = GLCD_Display->Layers.Layer;
+	uint8_t                  index = 0;
+	
+	GLCD_LayerRop(dst, &GLCD_Display->Buffer[offset], size, _GLCD_ROP_COPY, 0);
+	
+	for (; index < GLCD_Display->Layers.Count; index++, layer++)
+	{
+		GLCD_LayerRop(dst, &layer->Buffer[offset], size, layer->Rop, layer->Invert);
+	}
+	
+}
+#endif /* _GLCD_LAYERS */
+
+#ifdef _GLCD_PAGE_MODE
+static uint8_t GLCD_ListRecord(const uint8_t op, const uint8_t *args, const uint8_t size, const void *blob, const uint8_t blobSize)
+{
+	/* Draw call is kept in the list instead of drawn, 1: the caller returns
+	
+	Entry:          [op][pages][size][X Y of text / bitmap ops][args][blob]
+	Dry Run:        The op runs once with no page in RAM, for its cursor moves and pages
+	Overflow:       Op is not kept and runs the same way, nothing of it is shown
+	
+	*/
+	
+	uint8_t  state = (op >= _GLCD_OP_CHAR) ? 2 : 0;
+	uint8_t *entry;
+	uint16_t need  = _GLCD_LIST_HEADER + state + size + blobSize;
+	uint8_t  line_counter = 0;
+	
+	if (GLCD_List.Mode != _GLCD_LIST_RECORD)
+	{
+		return 0; // Called by an op, or replayed
+	}
+	
+	/* ~~~~~~~~~~~~~~~~~~~~ Font goes in once per change ~~~~~~~~~~~~~~~~~~~~ */
+	if (state && (memcmp(&GLCD.Font, &GLCD_List.Font, sizeof(GLCD_FontTypeDef)) != 0))
+	{
+		
+		if ((GLCD_List.Used + _GLCD_LIST_HEADER + sizeof(GLCD_FontTypeDef)) <= _GLCD_LIST_SIZE)
+		{
+			
+			entry    = &GLCD_List.Arena[GLCD_List.Used];
+			entry[0] = _GLCD_OP_FONT;
+			entry[1] = _GLCD_LIST_ALL_PAGES;
+			entry[2] = sizeof(GLCD_FontTypeDef);
+			
+			memcpy(&entry[_GLCD_LIST_HEADER], &GLCD.Font, sizeof(GLCD_FontTypeDef));
+			
+			GLCD_List.Used += _GLCD_LIST_HEADER + sizeof(GLCD_FontTypeDef);
+			GLCD_List.Font  = GLCD.Font;
+			
+		}
+		
+	}
+	
+	if ((need > (_GLCD_LIST_HEADER + UINT8_MAX)) || ((GLCD_List.Used + need) > _GLCD_LIST_SIZE) ||
+	    (state && (memcmp(&GLCD.Font, &GLCD_List.Font, sizeof(GLCD_FontTypeDef)) != 0)))
+	{
+		
+		GLCD_List.Overflow = 1;
+		
+		return 0;
+		
+	}
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Append ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	entry    = &GLCD_List.Arena[GLCD_List.Used];
+	entry[0] = op;
+	entry[2] = need - _GLCD_LIST_HEADER;
+	
+	if (state)
+	{
+		entry[_GLCD_LIST_HEADER]     = GLCD.X;
+		entry[_GLCD_LIST_HEADER + 1] = GLCD.Y;
+	}
+	
+	if (size > 0)
+	{
+		memcpy(&entry[_GLCD_LIST_HEADER + state], args, size);
+	}
+	
+	if (blobSize > 0)
+	{
+		memcpy(&entry[_GLCD_LIST_HEADER + state + size], blob, blobSize);
+	}
+	
+	if (op == _GLCD_OP_STRING)
+	{
+		entry[need - 1] = '\0'; // Text is cut to the screen width
+	}
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Dry run ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	GLCD_List.Mode    = _GLCD_LIST_DRY;
+	GLCD_List.Touched = 0;
+	
+	GLCD_ListRun(entry);
+	
+	GLCD_List.Mode = _GLCD_LIST_RECORD;
+	
+	if (GLCD_List.Touched == 0)
+	{
+		return 1; // Off screen, nothing to replay
+	}
+	
+	entry[1]         = GLCD_List.Touched;
+	GLCD_List.Used  += need;
+	GLCD_List.Drawn |= GLCD_List.Touched;
+	
+	for (; line_counter < _GLCD_SCREEN_LINES; line_counter++)
+	{
+		
+		if (GLCD_List.Touched & (1U << line_counter))
+		{
+			GLCD_MarkDirty(line_counter, 0, _GLCD_SCREEN_WIDTH - 1);
+		}
+		
+	}
+	
+	return 1;
+	
+}
+
+static void GLCD_ListRun(const uint8_t *entry)
+{
+	
+	const uint8_t *arg = &entry[_GLCD_LIST_HEADER];
+	const uint8_t *data;
+	
+	/* ~~~~~~~~~~~~~~~~~~~~ Cursor of text / bitmap ops ~~~~~~~~~~~~~~~~~~~~ */
+	if (entry[0] >= _GLCD_OP_CHAR)
+	{
+		
+		GLCD.X = *arg++;
+		GLCD.Y = *arg++;
+		
+	}
+	
+	switch (entry[0])
+	{
+		
+		case _GLCD_OP_FONT:
+			memcpy(&GLCD.Font, arg, sizeof(GLCD_FontTypeDef));
+			break;
+		case _GLCD_OP_CLEAR_LINE:
+			GLCD_ClearLine(arg[0]);
+			break;
+		case _GLCD_OP_INVERT_RECT:
+			GLCD_InvertRect(arg[0], arg[1], arg[2], arg[3]);
+			break;
+		case _GLCD_OP_PIXEL:
+			GLCD_SetPixel(arg[0], arg[1], (COLOR_TypeDef)arg[2]);
+			break;
+		case _GLCD_OP_PIXELS:
+			GLCD_SetPixels(arg[0], arg[1], arg[2], arg[3], (COLOR_TypeDef)arg[4]);
+			break;
+		case _GLCD_OP_LINE:
+			GLCD_DrawLine(arg[0], arg[1], arg[2], arg[3], (COLOR_TypeDef)arg[4]);
+			break;
+		case _GLCD_OP_RECTANGLE:
+			GLCD_DrawRectangle(arg[0], arg[1], arg[2], arg[3], (COLOR_TypeDef)arg[4]);
+			break;
+		case _GLCD_OP_ROUND_RECTANGLE:
+			GLCD_DrawRoundRectangle(arg[0], arg[1], arg[2], arg[3], arg[4], (COLOR_TypeDef)arg[5]);
+			break;
+		case _GLCD_OP_TRIANGLE:
+			GLCD_DrawTriangle(arg[0], arg[1], arg[2], arg[3], arg[4], arg[5], (COLOR_TypeDef)arg[6]);
+			break;
+		case _GLCD_OP_CIRCLE:
+			GLCD_DrawCircle(arg[0], arg[1], arg[2], (COLOR_TypeDef)arg[3]);
+			break;
+		case _GLCD_OP_FILL_SCREEN:
+			GLCD_FillScreen((COLOR_TypeDef)arg[0]);
+			break;
+		case _GLCD_OP_FILLED_RECTANGLE:
+			GLCD_DrawFilledRectangle(arg[0], arg[1], arg[2], arg[3], (COLOR_TypeDef)arg[4]);
+			break;
+		case _GLCD_OP_FILLED_ROUND_RECTANGLE:
+			GLCD_DrawFilledRoundRectangle(arg[0], arg[1], arg[2], arg[3], arg[4], (COLOR_TypeDef)arg[5]);
+			break;
+		case _GLCD_OP_FILLED_TRIANGLE:
+			GLCD_DrawFilledTriangle(arg[0], arg[1], arg[2], arg[3], arg[4], arg[5], (COLOR_TypeDef)arg[6]);
+			break;
+		case _GLCD_OP_FILLED_CIRCLE:
+			GLCD_DrawFilledCircle(arg[0], arg[1], arg[2], (COLOR_TypeDef)arg[3]);
+			break;
+		case _GLCD_OP_CHAR:
+			GLCD_PutChar((char)arg[0]);
+			break;
+		case _GLCD_OP_STRING:
+			GLCD_PutString((const char *)arg);
+			break;
+		case _GLCD_OP_STRING_P:
+			memcpy(&data, arg, sizeof(data));
+			GLCD_PutString_P((const char *)data);
+			break;
+		case _GLCD_OP_BITMAP:
+			memcpy(&data, &arg[3], sizeof(data));
+			GLCD_DrawBitmap(data, arg[0], arg[1], (GLCD_PrintModeTypeDef)arg[2]);
+			break;
+		default:
+			break;
+		
+	}
+	
+}
+
+static void GLCD_ListReset(void)
+{
+	
+	uint8_t line_counter = 0;
+	
+	/* ~~~~~~~~~~~~~~~~~ Pages with drawing go blank ~~~~~~~~~~~~~~~~~ */
+	for (; line_counter < _GLCD_SCREEN_LINES; line_counter++)
+	{
+		
+		if (GLCD_List.Drawn & (1U << line_counter))
+		{
+			GLCD_MarkDirty(line_counter, 0, _GLCD_SCREEN_WIDTH - 1);
+		}
+		
+	}
+	
+	GLCD_List.Used     = 0;
+	GLCD_List.Drawn    = 0;
+	GLCD_List.Overflow = 0;
+	
+	memset(&GLCD_List.Font, 0, sizeof(GLCD_FontTypeDef)); // Font a replay starts with
+	
+}
+
+static GLCD_StatusTypeDef GLCD_ListRender(uint8_t pages)
+{
+	
+	GLCD_CursorTypeDef cursor;
+	GLCD_FontTypeDef   font   = GLCD.Font;
+	GLCD_StatusTypeDef status = _GLCD_OK;
+	
+	uint16_t used;
+	uint8_t  x            = GLCD.X;
+	uint8_t  y            = GLCD.Y;
+	uint8_t  line_counter = 0;
+	
+	for (; line_counter < _GLCD_SCREEN_LINES; line_counter++)
+	{
+		
+		if (GLCD_Display->Dirty.Start[line_counter] == _GLCD_DIRTY_NONE)
+		{
+			continue;
+		}
+		
+		if (pages == 0)
+		{
+			
+			status = _GLCD_BUSY;
+			break;
+			
+		}
+		
+		pages--;
+		
+		/* ~~~~~~~~~~~~~~~~~~ Rasterise the page ~~~~~~~~~~~~~~~~~~ */
+		memset(GLCD_Display->Buffer, _GLCD_WHITE, _GLCD_SCREEN_WIDTH);
+		memset(&GLCD.Font, 0, sizeof(GLCD_FontTypeDef));
+		
+		GLCD_List.Mode = _GLCD_LIST_RASTER;
+		GLCD_List.Page = line_counter;
+		
+		for (used = 0; used < GLCD_List.Used; used += _GLCD_LIST_HEADER + GLCD_List.Arena[used + 2])
+		{
+			
+			if (GLCD_List.Arena[used + 1] & (1U << line_counter))
+			{
+				GLCD_ListRun(&GLCD_List.Arena[used]);
+			}
+			
+		}
+		
+		GLCD_List.Mode = _GLCD_LIST_RECORD;
+		
+		GLCD.X    = x;
+		GLCD.Y    = y;
+		GLCD.Font = font;
+		
+		/* ~~~~~~~~~~~~~~~~~~~~~ Send the page ~~~~~~~~~~~~~~~~~~~~ */
+		GLCD_Plan.Mode  = _GLCD_PLAN_PAGE;
+		GLCD_Plan.Count = 1;
+		GLCD_Plan.Cost  = 0;
+		GLCD_Plan.Page  = 0;
+		
+		GLCD_Plan.Rect[0].StartX    = 0;
+		GLCD_Plan.Rect[0].EndX      = _GLCD_SCREEN_WIDTH - 1;
+		GLCD_Plan.Rect[0].StartLine = line_counter;
+		GLCD_Plan.Rect[0].EndLine   = line_counter;
+		
+		GLCD_Display->Dirty.Start[line_counter] = _GLCD_DIRTY_NONE; // Marked again if the page fails
+		GLCD_Display->Dirty.End[line_counter]   = 0;
+		
+		cursor.Rect   = 0;
+		cursor.Setup  = _GLCD_SETUP_RECT;
+		cursor.Trial  = 0;
+		cursor.Gather = 1;
+		
+		status = GLCD_SendPlan(&cursor, _GLCD_BUDGET_NONE);
+		
+		if (status != _GLCD_OK)
+		{
+			break;
+		}
+		
+	}
+	
+	return status;
+	
+}
+#endif /* _GLCD_PAGE_MODE */
+
+#ifdef _GLCD_DIRECT_TEXT
+static GLCD_StatusTypeDef GLCD_DirectWrite(const uint16_t x, const uint8_t line, const uint8_t *data, uint16_t size, const uint8_t repeat)
+{
+	/* size bytes to GDDRAM from column x of page line, cut at the screen edge
+	
+	Repeat:         data is one _GLCD_CLEAR_BLOCK block sent again and again (fills)
+	Addressing:     Page mode, skipped while the pointer is already there
+	
+	*/
+	
+	GLCD_TransferTypeDef transfer;
+	GLCD_ShadowTypeDef  *shadow = &GLCD_Display->Shadow;
+	GLCD_StatusTypeDef   status = _GLCD_OK;
+	uint16_t             packet = (GLCD_PacketSize == _GLCD_PACKET_SIZE_FRAME) ? UINT16_MAX : GLCD_PacketSize;
+	uint16_t             left;
+	uint16_t             sent;
+	uint8_t              gather = ((GLCD_Transport != NULL) && (GLCD_Transport->WriteDataV != NULL)) ? _GLCD_SCREEN_LINES : 1;
+	
+	if ((x >= _GLCD_SCREEN_WIDTH) || (line >= _GLCD_SCREEN_LINES) || (size == 0))
+	{
+		return _GLCD_OK;
+	}
+	
+	if (GLCD_Display->Breaker.Open)
+	{
+		return _GLCD_OFFLINE; // Redrawn by the application after the recovery
+	}
+	
+	size = __GLCD_Min(size, (uint16_t)(_GLCD_SCREEN_WIDTH - x));
+	left = size;
+	
+	/* ~~~~~~~~~~~~~~~~~~~ Pointer is moved only when elsewhere ~~~~~~~~~~~~~~~~~~~ */
+	if ((shadow->MemMode != _GLCD_MEM_MODE_PAGE) || (shadow->Page != line) || (shadow->Column != x))
+	{
+		
+		if (shadow->MemMode != _GLCD_MEM_MODE_PAGE)
+		{
+			GLCD_QueueCommand(_GLCD_CMD_MEM_ADD_SET); // 0x20
+			GLCD_QueueCommand(_GLCD_MEM_MODE_PAGE);
+		}
 		
-		/* ::::: Update The Indices For Reading The Line ::::: */
-		bmpRead     = line_counter * width;
-		bmpReadPrev = bmpRead - width; // Previous = 4 + (j - 1) * width = Current - width
+		GLCD_QueueCommand(_GLCD_CMD_PAGE_ADD_PAGE_START_SET | line); // 0xB0
+		GLCD_QueueCommand(_GLCD_CMD_PAGE_ADD_COLUMN_LOWER_SET | (x & 0x0F)); // 0x00
+		GLCD_QueueCommand(_GLCD_CMD_PAGE_ADD_COLUMN_HIGHER_SET | (x >> 4)); // 0x10
 		
-		/* ::::::::::: Scan Bytes Of Selected Line ::::::::::: */
-		for (line_pixels_ounter = 0 ; line_pixels_ounter < width ; line_pixels_ounter++)
+		status = GLCD_FlushCommands();
+		
+		shadow->MemMode       = (status == _GLCD_OK) ? _GLCD_MEM_MODE_PAGE : _GLCD_MEM_MODE_UNKNOWN;
+		shadow->Window.StartX = _GLCD_SHADOW_UNKNOWN; // Page addressing moves the pointer
+		
+		if (status != _GLCD_OK)
 		{
 			
-			/* ----------------- Read Byte --------------- */
-			data = pgm_read_byte(&(bitmap[bmpRead++]));
+			shadow->Page = _GLCD_SHADOW_UNKNOWN;
 			
-			/* ---------------- Shift Byte --------------- */
-			data <<= overflow;
+			return status;
 			
-			/* ------- Merge Byte With Previous One ------ */
-			if (line_counter > 0)
+		}
+		
+	}
+	
+	shadow->Page = _GLCD_SHADOW_UNKNOWN; // Until the data is through
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Data packets ~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	transfer.Control = _GLCD_CTRL_DATA;
+	
+	while (left > 0)
+	{
+		
+		transfer.Count = 0;
+		sent           = 0;
+		
+		while ((left > 0) && (transfer.Count < gather) && (sent < packet))
+		{
+			
+			transfer.Segment[transfer.Count].Data = data;
+			transfer.Segment[transfer.Count].Size = __GLCD_Min(left, (uint16_t)(packet - sent));
+			
+			if (repeat)
 			{
-				
-				dataPrev   = pgm_read_byte( &(bitmap[bmpReadPrev++]) );
-				dataPrev >>= _GLCD_SCREEN_LINE_HEIGHT - overflow;
-				data      |= dataPrev;
-				
+				transfer.Segment[transfer.Count].Size = __GLCD_Min(transfer.Segment[transfer.Count].Size, (uint16_t)_GLCD_CLEAR_BLOCK);
 			}
-			
-			/* ----- Edit Byte Depending On The Mode ----- */
-			if (mode == _GLCD_PRINT_MODE_MERGE)
+			else
 			{
-				data |= GLCD_BufferRead(GLCD.X, GLCD.Y);
+				data += transfer.Segment[transfer.Count].Size;
 			}
 			
-			/* ---------------- Send Byte ---------------- */
-			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
+			sent += transfer.Segment[transfer.Count].Size;
+			left -= transfer.Segment[transfer.Count].Size;
+			transfer.Count++;
 			
 		}
 		
-		/* :::::: Send An Empty Column Of 1px In The End ::::: */
-		if (GLCD.Font.Mode == _GLCD_PRINT_MODE_OVERWRITE)
+		if (GLCD_SendTransfer(&transfer) != _GLCD_OK)
 		{
-			data = _GLCD_WHITE;
+			status = _GLCD_ERROR;
 		}
-		else
+		
+	}
+	
+	if (GLCD_EndTransfer() != _GLCD_OK)
+	{
+		status = _GLCD_ERROR;
+	}
+	
+	GLCD_Health(status);
+	
+	/* ..... Next glyph on the same page goes without addressing ..... */
+	if ((status == _GLCD_OK) && ((x + size) < _GLCD_SCREEN_WIDTH))
+	{
+		shadow->Column = x + size;
+		shadow->Page   = line;
+	}
+	
+	return status;
+	
+}
+
+static void GLCD_RunBegin(void)
+{
+	
+	GLCD_Run.Open  = 1;
+	GLCD_Run.Count = 0;
+	
+}
+
+static void GLCD_RunEnd(void)
+{
+	
+	/* ~~~~~~~~~~~~~~~~~~ Staged run goes out as one data write ~~~~~~~~~~~~~~~~~~ */
+	if (GLCD_Run.Count > 0)
+	{
+		GLCD_DirectWrite(GLCD_Run.X, GLCD_Run.Line, GLCD_Run.Data, GLCD_Run.Count, 0);
+	}
+	
+	GLCD_Run.Open  = 0;
+	GLCD_Run.Count = 0;
+	
+}
+#endif /* _GLCD_DIRECT_TEXT */
+
+static void GLCD_MarkPending(const GLCD_PlanTypeDef *plan, uint8_t rect)
+{
+	
+	uint8_t line_counter;
+	
+	/* ~~~~~~~~~~~~~~~~~ Rectangles that did not reach the display ~~~~~~~~~~~~~~~~~ */
+	for (; rect < plan->Count; rect++)
+	{
+		
+		for (line_counter = plan->Rect[rect].StartLine; line_counter <= plan->Rect[rect].EndLine; line_counter++)
 		{
-			data = GLCD_BufferRead(GLCD.X, GLCD.Y);
+			GLCD_MarkDirty(line_counter, plan->Rect[rect].StartX, plan->Rect[rect].EndX);
 		}
 		
-		GLCD_BufferWrite(GLCD.X, GLCD.Y, data);
+	}
+	
+}
+
+static void GLCD_MarkDrawn(void)
+{
+	
+	#if defined(_GLCD_DIRECT_TEXT)
+	
+	/* Nothing is kept besides GDDRAM */
+	
+	#elif defined(_GLCD_PAGE_MODE)
+	
+	uint8_t line_counter = 0;
+	
+	/* ..... Pages the list draws on, the buffer holds no frame ..... */
+	for (; line_counter < _GLCD_SCREEN_LINES; line_counter++)
+	{
 		
-		/* :::::::::::::: Increase Line Counter :::::::::::::: */
-		y_pos_for_draw += _GLCD_SCREEN_LINE_HEIGHT;
+		if (GLCD_List.Drawn & (1U << line_counter))
+		{
+			GLCD_MarkDirty(line_counter, 0, _GLCD_SCREEN_WIDTH - 1);
+		}
 		
 	}
 	
-	/* ~~~~~~~~~~~~~~~~~ Update Last Line, If Needed ~~~~~~~~~~~~~~~~~ */
-	if (lines > 1)
+	#else
+	
+	uint8_t *row;
+	uint8_t  line_counter = 0;
+	uint8_t  first;
+	uint8_t  last;
+	uint8_t  x;
+	
+	/* ~~~~~~~~~~~~~~~~~~~~ Non-blank span of every page ~~~~~~~~~~~~~~~~~~~~ */
+	for (; line_counter < _GLCD_SCREEN_LINES; line_counter++)
 	{
 		
-		/* :::::::::::::::::: Goto The Start Of The Line :::::::::::::::::: */
-		GLCD_GotoXY(x_pos, y_pos_for_draw);
+		row   = &__GLCD_Shown(GLCD_Display)[line_counter * _GLCD_SCREEN_WIDTH];
+		first = _GLCD_DIRTY_NONE;
+		last  = 0;
 		
-		/* ::::: Update The Indices For Reading The Last Printed Line ::::: */
-		bmpReadPrev = (line_counter - 1) * width;
+		#ifdef _GLCD_LAYERS
+		if (GLCD_Display->Layers.Count > 0)
+		{
+			GLCD_LayerCompose(GLCD_LayerStage, line_counter * _GLCD_SCREEN_WIDTH, _GLCD_SCREEN_WIDTH);
+			row = GLCD_LayerStage; // What the panel shows
+		}
+		#endif /* _GLCD_LAYERS */
 		
-		/* ::::::::::::::::: Scan Bytes Of Selected Line :::::::::::::::::: */
-		for (line_pixels_ounter = 0 ; line_pixels_ounter < width ; line_pixels_ounter++)
+		for (x = 0; x < _GLCD_SCREEN_WIDTH; x++)
 		{
 			
-			/* ----------------- Read Byte --------------- */
-			data = GLCD_BufferRead(GLCD.X, GLCD.Y);
-			
-			/* ------- Merge Byte With Previous One ------ */
-			dataPrev   = pgm_read_byte( &(bitmap[bmpReadPrev++]) );
-			dataPrev >>= _GLCD_SCREEN_LINE_HEIGHT - overflow;
-			data      |= dataPrev;
-			
-			/* ----- Edit Byte Depending On The Mode ----- */
-			if (mode == _GLCD_PRINT_MODE_MERGE)
+			if (row[x] != _GLCD_WHITE)
 			{
-				data |= GLCD_BufferRead(GLCD.X, GLCD.Y);
+				
+				if (first == _GLCD_DIRTY_NONE)
+				{
+					first = x;
+				}
+				
+				last = x;
+				
 			}
 			
-			/* ---------------- Send Byte ---------------- */
-			GLCD_BufferWrite(GLCD.X++, GLCD.Y, data);
-			
 		}
 		
-		/* :::::::::::: Send An Empty Column Of 1px In The End :::::::::::: */
-		if (GLCD.Font.Mode == _GLCD_PRINT_MODE_OVERWRITE)
+		if (first != _GLCD_DIRTY_NONE)
 		{
-			data = _GLCD_WHITE;
-		}
-		else if (GLCD.Font.Mode == _GLCD_PRINT_MODE_MERGE)
-		{
-			data = GLCD_BufferRead(GLCD.X, GLCD.Y);
-		}
-		else
-		{
-			data = ~GLCD_BufferRead(GLCD.X, GLCD.Y);
+			GLCD_MarkDirty(line_counter, first, last);
 		}
 		
-		GLCD_BufferWrite(GLCD.X++, GLCD.Y,data);
+	}
+	
+	#endif /* _GLCD_DIRECT_TEXT */
+	
+}
+
+static void GLCD_ShadowClear(GLCD_ShadowTypeDef *shadow)
+{
+	
+	shadow->MemMode       = _GLCD_MEM_MODE_UNKNOWN;
+	shadow->Window.StartX = _GLCD_SHADOW_UNKNOWN;
+	shadow->Contrast      = _GLCD_CONTRAST_UNKNOWN;
+	shadow->Display       = _GLCD_SHADOW_UNKNOWN;
+	shadow->Inverse       = _GLCD_SHADOW_UNKNOWN;
+	shadow->Scroll        = _GLCD_SHADOW_UNKNOWN;
+	shadow->StartLine     = _GLCD_SHADOW_UNKNOWN;
+	shadow->Offset        = _GLCD_SHADOW_UNKNOWN;
+	
+	#ifdef _GLCD_DIRECT_TEXT
+	shadow->Column        = _GLCD_SHADOW_UNKNOWN;
+	shadow->Page          = _GLCD_SHADOW_UNKNOWN;
+	#endif /* _GLCD_DIRECT_TEXT */
+	
+}
+
+static void GLCD_ShadowSend(uint8_t *shadow, const uint8_t value, const uint8_t *commands, const uint8_t quantity)
+{
+	
+	/* ~~~~~~~~~~~~~~~~~~ Controller has the value already ~~~~~~~~~~~~~~~~~~ */
+	if (*shadow == value)
+	{
+		return;
+	}
+	
+	GLCD_QueueCommands(commands, quantity);
+	
+	*shadow = (GLCD_FlushCommands() == _GLCD_OK) ? value : _GLCD_SHADOW_UNKNOWN;
+	
+}
+
+static void GLCD_Health(const GLCD_StatusTypeDef status)
+{
+	
+	GLCD_BreakerTypeDef *breaker = &GLCD_Display->Breaker;
+	
+	if (status == _GLCD_OK)
+	{
+		
+		breaker->Fails = 0;
+		GLCD.Status    = _GLCD_OK;
+		
+		return;
+		
+	}
+	
+	GLCD.Status = _GLCD_ERROR;
+	
+	/* ..... A lost packet leaves the addressing and the pointer unknown ..... */
+	GLCD_Display->Shadow.MemMode       = _GLCD_MEM_MODE_UNKNOWN;
+	GLCD_Display->Shadow.Window.StartX = _GLCD_SHADOW_UNKNOWN;
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~ Trip the breaker ~~~~~~~~~~~~~~~~~~~~~~ */
+	if (++breaker->Fails >= _GLCD_BREAKER_FAILS)
+	{
+		
+		breaker->Fails     = _GLCD_BREAKER_FAILS;
+		breaker->Open      = 1;
+		breaker->Countdown = _GLCD_PROBE_INTERVAL;
+		GLCD.Status        = _GLCD_OFFLINE;
+		
+	}
+	
+}
+
+static void GLCD_Probe(void)
+{
+	
+	uint8_t            command = _GLCD_CMD_NOP;
+	GLCD_StatusTypeDef status;
+	GLCD_TypeDef       state;
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~ Low rate ~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	if (GLCD_Display->Breaker.Countdown > 1)
+	{
 		
+		GLCD_Display->Breaker.Countdown--;
+		
+		return;
+		
+	}
+	
+	GLCD_Display->Breaker.Countdown = _GLCD_PROBE_INTERVAL;
+	
+	if (GLCD_Transport == NULL)
+	{
+		return;
+	}
+	
+	status = GLCD_Transport->WriteCommand(GLCD_Transport->Handle, &command, 1); // 0xE3
+	
+	if (GLCD_EndTransfer() != _GLCD_OK)
+	{
+		status = _GLCD_ERROR;
+	}
+	
+	if (status != _GLCD_OK)
+	{
+		return;
+	}
+	
+	/* ~~~~~~~~~~ Display is back: init sequence, drawing state is kept ~~~~~~~~~~ */
+	state = GLCD;
+	
+	GLCD_Init(); // Closes the breaker, the next render sends the whole frame
+	
+	state.Status = GLCD.Status;
+	GLCD         = state;
+	
+	command = GLCD.Mode;
+	
+	GLCD_ShadowSend(&GLCD_Display->Shadow.Inverse, command, &command, 1); // Sent when inverted
+	
+}
+
+static inline void GLCD_MarkClean(void)
+{
+	
+	uint8_t line_counter = 0;
+	
+	for (; line_counter < _GLCD_SCREEN_LINES; line_counter++)
+	{
+		GLCD_Display->Dirty.Start[line_counter] = _GLCD_DIRTY_NONE;
+		GLCD_Display->Dirty.End[line_counter]   = 0;
+	}
+	
+}
+
+static uint32_t GLCD_DataCost(const uint16_t size)
+{
+	
+	uint16_t packets = 1;
+	
+	/* ~~~~~~~~~~~~~~ Every packet pays the transaction overhead ~~~~~~~~~~~~~~ */
+	if (!((GLCD_Transport != NULL) && GLCD_Transport->Stream) && (GLCD_PacketSize != _GLCD_PACKET_SIZE_FRAME))
+	{
+		packets = (size + GLCD_PacketSize - 1) / GLCD_PacketSize;
+	}
+	
+	return (((uint32_t)packets * GLCD_CostModel.Transaction) + ((uint32_t)size * GLCD_CostModel.Byte));
+	
+}
+
+static uint32_t GLCD_RectCost(const GLCD_RectTypeDef *rect, const uint8_t commands)
+{
+	
+	uint8_t  width = rect->EndX - rect->StartX + 1;
+	uint8_t  lines = rect->EndLine - rect->StartLine + 1;
+	uint32_t cost  = GLCD_CostModel.Transaction + ((uint32_t)commands * GLCD_CostModel.Byte);
+	
+	/* ~~~~~~~~~ Full width rows are contiguous in the buffer ~~~~~~~~~~ */
+	if ((width == _GLCD_SCREEN_WIDTH) || ((GLCD_Transport != NULL) && (GLCD_Transport->WriteDataV != NULL)))
+	{
+		cost += GLCD_DataCost((uint16_t)width * lines);
+	}
+	else
+	{
+		cost += lines * GLCD_DataCost(width);
 	}
 	
-	/* ~~~~~~ Goto The Upper-Right Corner Of The Printed Bitmap ~~~~~~ */
-	GLCD_GotoXY(GLCD_GetX(), y_pos);
+	return cost;
 	
 }
 
-void GLCD_DrawLine(uint8_t startX, uint8_t startY, uint8_t endX, uint8_t endY, COLOR_TypeDef color)
+static uint8_t GLCD_NextTransfer(GLCD_CursorTypeDef *cursor, const GLCD_PlanTypeDef *plan, GLCD_TransferTypeDef *transfer, const uint16_t limit)
 {
 	
-	int8_t error   = 0;
-	int8_t y_step  = 0;
+	const GLCD_RectTypeDef *rect;
+	GLCD_RectTypeDef       *window;
 	
-	uint8_t deltax = 0;
-	uint8_t deltay = 0;
-	uint8_t x_pos  = 0;
-	uint8_t y_pos  = 0;
-	uint8_t slope  = 0;
+	uint16_t run_start = 0;
+	uint16_t run_size  = 0;
+	uint16_t packet    = 0;
+	uint16_t budget    = 0;
+	uint8_t  count     = 0;
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~~~~~ Check Value ~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	if ((startX < _GLCD_SCREEN_WIDTH) && (endX < _GLCD_SCREEN_WIDTH) &&
-	   (startY < _GLCD_SCREEN_HEIGHT) && (endY < _GLCD_SCREEN_HEIGHT))
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~ Plan is done ~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	if (cursor->Rect >= plan->Count)
 	{
 		
-		/* :::::::::: Check Line Pos :::::::::: */
-		if (startX == endX)
+		#ifdef _GLCD_PAGE_FLIP
+		
+		/* ..... Hidden half is complete, show it with one command ..... */
+		if ((cursor->Rect == plan->Count) && (plan->Count > 0))
 		{
-			GLCD_DrawVLine(startY, endY, startX, color);
+			
+			cursor->Command[0]             = _GLCD_CMD_DISP_START_LINE_SET | (plan->Page * _GLCD_SCREEN_LINE_HEIGHT); // 0x40
+			GLCD_Display->Shadow.StartLine = plan->Page * _GLCD_SCREEN_LINE_HEIGHT;
+			
+			cursor->Rect++;
+			
+			transfer->Control         = _GLCD_CTRL_COMMAND;
+			transfer->Count           = 1;
+			transfer->Segment[0].Data = cursor->Command;
+			transfer->Segment[0].Size = 1;
+			
+			return 1;
+			
 		}
-		else if (startY == endY)
+		
+		#endif /* _GLCD_PAGE_FLIP */
+		
+		return 0;
+		
+	}
+	
+	rect = &plan->Rect[cursor->Rect];
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~ Setup commands ~~~~~~~~~~~~~~~~~~~~~~~~ */
+	if (cursor->Setup)
+	{
+		
+		if (plan->Mode == _GLCD_PLAN_PAGE)
 		{
-			GLCD_DrawHLine(startX, endX, startY, color);
+			
+			if (GLCD_Display->Shadow.MemMode != _GLCD_MEM_MODE_PAGE)
+			{
+				cursor->Command[count++]     = _GLCD_CMD_MEM_ADD_SET; // 0x20
+				cursor->Command[count++]     = _GLCD_MEM_MODE_PAGE;
+				GLCD_Display->Shadow.MemMode = _GLCD_MEM_MODE_PAGE;
+			}
+			
+			GLCD_Display->Shadow.Window.StartX = _GLCD_SHADOW_UNKNOWN; // Page addressing moves the pointer
+			
+			/* ..... Resume: the page and column of the failed packet ..... */
+			if (cursor->Setup == _GLCD_SETUP_RECT)
+			{
+				cursor->Line   = rect->StartLine;
+				cursor->Offset = 0;
+			}
+			
+			cursor->Command[count++] = _GLCD_CMD_PAGE_ADD_PAGE_START_SET | (plan->Page + cursor->Line); // 0xB0
+			cursor->Command[count++] = _GLCD_CMD_PAGE_ADD_COLUMN_LOWER_SET | ((rect->StartX + cursor->Offset) & 0x0F); // 0x00
+			cursor->Command[count++] = _GLCD_CMD_PAGE_ADD_COLUMN_HIGHER_SET | ((rect->StartX + cursor->Offset) >> 4); // 0x10
+			
 		}
 		else
 		{
 			
-			/* ------------------ Check Slope ------------------ */
-			slope = ((__GLCD_AbsDiff(startY, endY) > __GLCD_AbsDiff(startX,endX)) ? 1 : 0);
+			if (GLCD_Display->Shadow.MemMode != _GLCD_MEM_MODE_HORIZONTAL)
+			{
+				cursor->Command[count++]     = _GLCD_CMD_MEM_ADD_SET; // 0x20
+				cursor->Command[count++]     = _GLCD_MEM_MODE_HORIZONTAL;
+				GLCD_Display->Shadow.MemMode = _GLCD_MEM_MODE_HORIZONTAL;
+			}
 			
-			if (slope)
+			/* ..... Resume: the window restarts at the page of the failed packet ..... */
+			if (cursor->Setup == _GLCD_SETUP_RECT)
 			{
-				
-				/* """""""""" Swap startX, startY """""""""" */
-				__GLCD_Swap(startX, startY);
-				
-				/* """""""""""" Swap endX, endY """""""""""" */
-				__GLCD_Swap(endX, endY);
-				
+				cursor->Line = rect->StartLine;
+			}
+			else if ((rect->StartX == 0) && (rect->EndX == (_GLCD_SCREEN_WIDTH - 1)))
+			{
+				cursor->Line = rect->StartLine + (cursor->Offset / _GLCD_SCREEN_WIDTH);
 			}
 			
-			if (startX > endX)
+			/* ..... Pointer waits at the start of this window since the last frame ..... */
+			window = &GLCD_Display->Shadow.Window;
+			
+			if ((window->StartX != rect->StartX) || (window->EndX != rect->EndX) || (window->StartLine != (plan->Page + cursor->Line)) || (window->EndLine != (plan->Page + rect->EndLine)))
 			{
 				
-				/* """"""""""" Swap startX, endX """"""""""" */
-				__GLCD_Swap(startX, endX);
-				
-				/* """"""""""" Swap startY, endY """"""""""" */
-				__GLCD_Swap(startY, endY);
+				cursor->Command[count++] = _GLCD_CMD_COLUMN_ADD_SET; // 0x21
+				cursor->Command[count++] = rect->StartX;
+				cursor->Command[count++] = rect->EndX;
+				cursor->Command[count++] = _GLCD_CMD_PAGE_ADD_SET; // 0x22
+				cursor->Command[count++] = plan->Page + cursor->Line;
+				cursor->Command[count++] = plan->Page + rect->EndLine;
 				
 			}
 			
-			/* ---------------- Calculate Param ---------------- */
-			deltax  = endX - startX;
-			deltay  = __GLCD_AbsDiff(endY, startY);
-			error   = deltax / 2;
-			y_pos   = startY;
-			y_step  = ((startY < endY) ? 1 : -1);
-			endX   += 1;
+			cursor->Window = cursor->Line;
+			window->StartX = _GLCD_SHADOW_UNKNOWN; // Until the window is written out
 			
-			/* ------------------ Set Pixels ------------------- */
-			for (x_pos = startX ; x_pos < endX ; x_pos++)
+			/* Full width runs count from the first page of the rectangle */
+			if ((rect->StartX == 0) && (rect->EndX == (_GLCD_SCREEN_WIDTH - 1)))
 			{
-				
-				if (slope)
-				{
-					GLCD_SetPixel(y_pos, x_pos, color);
-				}
-				else
-				{
-					GLCD_SetPixel(x_pos, y_pos, color);
-				}
-				
-				error -= deltay;
-				
-				if (error < 0)
-				{
-					y_pos = y_pos + y_step;
-					error = error + deltax;
-				}
-				
+				cursor->Offset = (cursor->Line - rect->StartLine) * _GLCD_SCREEN_WIDTH;
+			}
+			else
+			{
+				cursor->Offset = 0;
 			}
 			
 		}
 		
+		cursor->Setup = 0;
+		
+		if (count > 0)
+		{
+			
+			transfer->Control         = _GLCD_CTRL_COMMAND;
+			transfer->Count           = 1;
+			transfer->Segment[0].Data = cursor->Command;
+			transfer->Segment[0].Size = count;
+			
+			return 1;
+			
+		}
+		
 	}
 	
-}
-
-void GLCD_DrawRectangle(const uint8_t startX, const uint8_t startY, const uint8_t endX, const uint8_t endY, COLOR_TypeDef color)
-{
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~ Data packet ~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	budget = limit;
 	
-	if ((startX < _GLCD_SCREEN_WIDTH) && (endX < _GLCD_SCREEN_WIDTH) &&
-	    (startY < _GLCD_SCREEN_HEIGHT) && (endY < _GLCD_SCREEN_HEIGHT))
+	if (budget == _GLCD_PACKET_SIZE_FRAME)
 	{
-		
-		GLCD_DrawHLine(startX, endX, startY, color);
-		GLCD_DrawHLine(startX, endX, endY, color);
-		GLCD_DrawVLine(startY, endY, startX, color);
-		GLCD_DrawVLine(startY, endY, endX, color);
-		
+		budget = UINT16_MAX;
 	}
 	
-}
-
-void GLCD_DrawRoundRectangle(const uint8_t startX, const uint8_t startY, const uint8_t endX, const uint8_t endY, const uint8_t radius, COLOR_TypeDef color)
-{
+	#ifdef _GLCD_LAYERS
+	if ((GLCD_Display->Layers.Count > 0) && (budget > _GLCD_LAYER_STAGE))
+	{
+		budget = _GLCD_LAYER_STAGE; // Transfer is composed into GLCD_LayerStage
+	}
+	#endif /* _GLCD_LAYERS */
 	
-	if ((startX<_GLCD_SCREEN_WIDTH) && (endX<_GLCD_SCREEN_WIDTH) && (startY<_GLCD_SCREEN_HEIGHT) && (endY<_GLCD_SCREEN_HEIGHT))
+	transfer->Control = _GLCD_CTRL_DATA;
+	transfer->Count   = 0;
+	
+	/* Page slices of a window are gathered while the packet has room */
+	do
 	{
 		
-		uint8_t width;
-		uint8_t height;
-		uint8_t x;
-		uint8_t y;
+		if ((rect->StartX == 0) && (rect->EndX == (_GLCD_SCREEN_WIDTH - 1)))
+		{
+			run_start = rect->StartLine * _GLCD_SCREEN_WIDTH;
+			run_size  = (rect->EndLine - rect->StartLine + 1) * _GLCD_SCREEN_WIDTH;
+		}
+		else
+		{
+			run_start = (cursor->Line * _GLCD_SCREEN_WIDTH) + rect->StartX;
+			run_size  = rect->EndX - rect->StartX + 1;
+		}
 		
-		/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */
-		int16_t tSwitch = 3 - 2 * radius;
+		packet = run_size - cursor->Offset;
 		
-		width  = endX - startX;
-		height = endY - startY;
-		x      = 0;
-		y      = radius;
+		if (packet > budget)
+		{
+			packet = budget;
+		}
 		
-		/* ~~~~~~~~~~~~~~~~~~~~~~~ Draw Perimeter ~~~~~~~~~~~~~~~~~~~~~~~~ */
-		GLCD_DrawHLine(startX + radius, endX - radius, startY, color); // Top
-		GLCD_DrawHLine(startX + radius, endX - radius, endY, color); // Bottom
-		GLCD_DrawVLine(startY + radius, endY - radius, startX, color); // Left
-		GLCD_DrawVLine(startY + radius, endY - radius, endX, color); // Right
+		#ifdef _GLCD_PAGE_MODE
+		run_start -= cursor->Line * _GLCD_SCREEN_WIDTH; // Buffer holds the page being sent
+		#endif /* _GLCD_PAGE_MODE */
 		
-		while (x <= y)
+		transfer->Segment[transfer->Count].Data = &__GLCD_Shown(GLCD_Display)[run_start + cursor->Offset];
+		transfer->Segment[transfer->Count].Size = packet;
+		
+		#ifdef _GLCD_LAYERS
+		
+		/* ..... Layers are combined into the stage, behind the earlier segments ..... */
+		if (GLCD_Display->Layers.Count > 0)
 		{
 			
-			/* :::::::::::: Upper left corner :::::::::::: */
-			GLCD_SetPixel(startX + radius - x, startY + radius - y, color);
-			GLCD_SetPixel(startX + radius - y, startY + radius - x, color);
-
-			/* :::::::::::: Upper right corner ::::::::::: */
-			GLCD_SetPixel(startX + width - radius + x, startY + radius - y, color);
-			GLCD_SetPixel(startX + width - radius + y, startY + radius - x, color);
-
-			/* :::::::::::: Lower left corner :::::::::::: */
-			GLCD_SetPixel(startX + radius - x, startY + height - radius + y, color);
-			GLCD_SetPixel(startX + radius - y, startY + height - radius + x, color);
-
-			/* :::::::::::: Lower right corner ::::::::::: */
-			GLCD_SetPixel(startX + width - radius + x, startY + height - radius + y, color);
-			GLCD_SetPixel(startX + width - radius + y, startY + height - radius + x, color);
-
-			if (tSwitch < 0)
-			{
-				tSwitch += 4 * x + 6;
-			}
-			else
-			{
-				tSwitch += 4 * (x - y) + 10;
-				y--;
-			}
+			transfer->Segment[transfer->Count].Data = &GLCD_LayerStage[_GLCD_LAYER_STAGE - budget];
 			
-			x++;
+			GLCD_LayerCompose(&GLCD_LayerStage[_GLCD_LAYER_STAGE - budget], run_start + cursor->Offset, packet);
 			
 		}
 		
-	}
-	
-}
-
-void GLCD_DrawTriangle(const uint8_t x1, const uint8_t y1, const uint8_t x2, const uint8_t y2, const uint8_t x3, const uint8_t y3, COLOR_TypeDef color)
-{
-	
-	if (((x1 < _GLCD_SCREEN_WIDTH) && (x2 < _GLCD_SCREEN_WIDTH) && (x3 < _GLCD_SCREEN_WIDTH) &&
-		(y1 < _GLCD_SCREEN_HEIGHT) && (y2 < _GLCD_SCREEN_HEIGHT) && (y3 < _GLCD_SCREEN_HEIGHT)))
-	{
-		
-		GLCD_DrawLine(x1, y1, x2, y2, color);
-		GLCD_DrawLine(x2, y2, x3, y3, color);
-		GLCD_DrawLine(x3, y3, x1, y1, color);
-		
-	}
-	
-}
-
-void GLCD_DrawCircle(const uint8_t centerX, const uint8_t centerY, const uint8_t radius, COLOR_TypeDef color)
-{
-	if (((centerX + radius) < _GLCD_SCREEN_WIDTH) && ((centerY + radius) < _GLCD_SCREEN_HEIGHT))
-	{
-		
-		uint8_t  x;
-		uint8_t  y;
-		
-		uint16_t yChange;
+		#endif /* _GLCD_LAYERS */
 		
-		int16_t  xChange;
-		int16_t  radiusError;
+		transfer->Count++;
 		
-		/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */
-		x           = radius;
-		y           = 0;
-		xChange     = 1 - 2 * radius;
-		yChange     = 1;
-		radiusError = 0;
+		cursor->Offset += packet;
+		budget         -= packet;
 		
-		while (x >= y)
+		/* ~~~~~~~~~~~~~~~~~~~~~~ Next page / rectangle ~~~~~~~~~~~~~~~~~~~~~ */
+		if (cursor->Offset >= run_size)
 		{
 			
-			GLCD_SetPixel(centerX + x, centerY + y, color);
-			GLCD_SetPixel(centerX - x, centerY + y, color);
-			GLCD_SetPixel(centerX - x, centerY - y, color);
-			GLCD_SetPixel(centerX + x, centerY - y, color);
-			GLCD_SetPixel(centerX + y, centerY + x, color);
-			GLCD_SetPixel(centerX - y, centerY + x, color);
-			GLCD_SetPixel(centerX - y, centerY - x, color);
-			GLCD_SetPixel(centerX + y, centerY - x, color);
-			
-			/* ::::::::::::::::::::::::::::::::::::::::::: */
-			y++;
-			radiusError += yChange;
-			yChange     += 2;
+			cursor->Offset = 0;
 			
-			if ((2 * radiusError + xChange) > 0)
+			if ((run_size > _GLCD_SCREEN_WIDTH) || (cursor->Line >= rect->EndLine))
 			{
 				
-				x--;
-				radiusError += xChange;
-				xChange     += 2;
+				/* ..... Window is written out, the pointer wrapped to its start ..... */
+				if (plan->Mode != _GLCD_PLAN_PAGE)
+				{
+					GLCD_Display->Shadow.Window           = *rect;
+					GLCD_Display->Shadow.Window.StartLine = plan->Page + cursor->Window;
+					GLCD_Display->Shadow.Window.EndLine   = plan->Page + rect->EndLine;
+				}
+				
+				cursor->Rect++;
+				cursor->Setup = _GLCD_SETUP_RECT;
+				break;
 				
 			}
 			
+			cursor->Line++;
+			
 		}
 		
 	}
+	while ((budget > 0) && (transfer->Count < cursor->Gather));
+	
+	return 1;
 	
 }
 
-void GLCD_FillScreen(COLOR_TypeDef color)
+static GLCD_StatusTypeDef GLCD_SendTransfer(const GLCD_TransferTypeDef *transfer)
 {
 	
-	uint8_t i;
-	uint8_t j;
+	if (GLCD_Transport == NULL)
+	{
+		return _GLCD_ERROR;
+	}
 	
-	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	for (j = 0 ; j < _GLCD_SCREEN_HEIGHT ; j += _GLCD_SCREEN_LINE_HEIGHT)
+	if (transfer->Control == _GLCD_CTRL_COMMAND)
 	{
-		
-		for (i = 0 ; i < _GLCD_SCREEN_WIDTH ; i++)
-		{
-			GLCD_BufferWrite(i, j, color);
-		}
-		
+		return GLCD_Transport->WriteCommand(GLCD_Transport->Handle, transfer->Segment[0].Data, transfer->Segment[0].Size);
 	}
-			
+	
+	/* ~~~~~~~~~~~~~~~~~~~~ Gathered page slices ~~~~~~~~~~~~~~~~~~~~ */
+	if (transfer->Count > 1)
+	{
+		return GLCD_Transport->WriteDataV(GLCD_Transport->Handle, transfer->Segment, transfer->Count);
+	}
+	
+	return GLCD_Transport->WriteData(GLCD_Transport->Handle, transfer->Segment[0].Data, transfer->Segment[0].Size);
+	
 }
 
-void GLCD_DrawFilledRectangle(const uint8_t startX, const uint8_t startY, const uint8_t endX, const uint8_t endY, COLOR_TypeDef color)
+static GLCD_StatusTypeDef GLCD_EndTransfer(void)
 {
-	GLCD_SetPixels(startX, startY, endX, endY, color);
+	
+	/* ~~~~~~~~~~~~~~~~ End of a burst, streaming buses close here ~~~~~~~~~~~~~~~~ */
+	if ((GLCD_Transport != NULL) && (GLCD_Transport->Flush != NULL))
+	{
+		return GLCD_Transport->Flush(GLCD_Transport->Handle);
+	}
+	
+	return _GLCD_OK;
+	
 }
 
-void GLCD_DrawFilledRoundRectangle(const uint8_t startX, const uint8_t startY, const uint8_t endX, const uint8_t endY, const uint8_t radius, COLOR_TypeDef color)
+static GLCD_StatusTypeDef GLCD_SendPlan(GLCD_CursorTypeDef *cursor, const uint32_t budget)
 {
 	
-	if ((startX < _GLCD_SCREEN_WIDTH) && (endX < _GLCD_SCREEN_WIDTH) && (startY < _GLCD_SCREEN_HEIGHT) && (endY < _GLCD_SCREEN_HEIGHT))
+	GLCD_CursorTypeDef   first = *cursor;
+	GLCD_CursorTypeDef   last;
+	GLCD_ShadowTypeDef   shadow;
+	GLCD_TransferTypeDef transfer;
+	GLCD_StatusTypeDef   status = _GLCD_OK;
+	uint32_t             spent  = 0;
+	uint32_t             cost;
+	uint16_t             packet;
+	uint8_t              failed = 0;
+	uint8_t              index;
+	
+	for (;;)
 	{
 		
-		uint8_t width;
-		uint8_t height;
-		uint8_t x;
-		uint8_t y;
-		
-		/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */
-		int16_t tSwitch = 3 - 2 * radius;
-		
-		width  = endX - startX;
-		height = endY - startY;
-		x      = 0;
-		y      = radius;
-		
-		/* ~~~~~~~~~~~~~~~~~~~~~~ Fill Center Block ~~~~~~~~~~~~~~~~~~~~~~ */
-		GLCD_DrawFilledRectangle(startX + radius, startY, endX - radius, endY, color);
+		last   = *cursor;
+		shadow = GLCD_Display->Shadow;
+		packet = GLCD_PacketSize;
 		
-		while (x <= y)
+		/* ~~~~~~~~~~~~~~~~~~~ Packets are cut to the budget ~~~~~~~~~~~~~~~~~~~ */
+		if (budget != _GLCD_BUDGET_NONE)
 		{
 			
-			/* :::::::::::::::: Left side :::::::::::::::: */
-			GLCD_DrawLine(startX + radius - x, startY + radius - y, // Upper left corner upper half
-			              startX + radius - x, startY + height - radius + y, // Lower left corner lower half
-			              color);
-						  
-			GLCD_DrawLine(startX + radius - y, startY + radius - x, // Upper left corner lower half
-			              startX + radius - y, startY + height - radius + x, // Lower left corner upper half
-			              color);
-						
-			/* :::::::::::::::: Right side ::::::::::::::: */
-			GLCD_DrawLine(startX + width - radius	+ x, startY + radius - y, // Upper right corner upper half
-			              startX + width - radius + x, startY + height - radius + y, // Lower right corner lower half
-			              color);
-			
-			GLCD_DrawLine(startX + width - radius + y, startY + radius - x, // Upper right corner lower half
-			              startX + width - radius + y, startY + height - radius + x, // Lower right corner upper half
-			              color);
+			cost = (spent < budget) ? (budget - spent) : 1;
+			cost = (cost > GLCD_CostModel.Transaction) ? (cost - GLCD_CostModel.Transaction) : 1;
 			
-			/* ::::::::::::::::::::::::::::::::::::::::::: */
-			if (tSwitch < 0)
-			{
-				tSwitch += 4 * x +6;
-			}
-			else
+			if ((packet == _GLCD_PACKET_SIZE_FRAME) || (packet > cost))
 			{
-				tSwitch += 4 * (x - y) + 10;
-				y--;
+				packet = (cost > UINT16_MAX) ? UINT16_MAX : (uint16_t)cost;
 			}
 			
-			x++;
-			
 		}
 		
-	}
-	
-}
-
-void GLCD_DrawFilledTriangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t x3, uint8_t y3, COLOR_TypeDef color)
-{
-	if (((x1 < _GLCD_SCREEN_WIDTH) && (x2 < _GLCD_SCREEN_WIDTH) && (x3 < _GLCD_SCREEN_WIDTH) &&
-		(y1 < _GLCD_SCREEN_HEIGHT) && (y2 < _GLCD_SCREEN_HEIGHT) && (y3 < _GLCD_SCREEN_HEIGHT)))
-	{
+		index = GLCD_NextTransfer(cursor, &GLCD_Plan, &transfer, packet);
 		
-		uint8_t sl  = 0;
-		uint8_t sx1 = 0;
-		uint8_t sx2 = 0;
+		if (!index)
+		{
+			break;
+		}
 		
-		double  m1  = 0;
-		double  m2  = 0;
-		double  m3  = 0;
+		/* ~~~~~~~~~~~~~~~~~~~~~~ Budget is used up ~~~~~~~~~~~~~~~~~~~~~~ */
+		cost = GLCD_CostModel.Transaction;
 		
-		/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */	
-		if (y2 > y3)
+		for (index = 0; index < transfer.Count; index++)
 		{
-			__GLCD_Swap(x2, x3);
-			__GLCD_Swap(y2, y3);
+			cost += (uint32_t)transfer.Segment[index].Size * GLCD_CostModel.Byte;
 		}
 		
-		if (y1 > y2)
+		if ((spent > 0) && ((spent + cost) > budget))
 		{
-			__GLCD_Swap(x1, x2);
-			__GLCD_Swap(y1, y2);
+			
+			*cursor              = last;
+			GLCD_Display->Shadow = shadow; // Setup of the kept transfer was not sent
+			status               = _GLCD_BUSY;
+			
+			break;
+			
 		}
 		
-		m1 = (double)(x1 - x2) / (y1 - y2);
-		m2 = (double)(x2 - x3) / (y2 - y3);
-		m3 = (double)(x3 - x1) / (y3 - y1);
+		spent += cost;
 		
-		/* ~~~~~~~~~~~~~~~~~~~~~~~ Draw In Display ~~~~~~~~~~~~~~~~~~~~~~~ */
-		for(sl = y1; sl <= y2; sl++)
+		if (GLCD_SendTransfer(&transfer) == _GLCD_OK)
 		{
 			
-			/* :::::::::::::::: Calculate :::::::::::::::: */
-			sx1 = m1 * (sl - y1) + x1;
-			sx2 = m3 * (sl - y1) + x1;
-			
-			if (sx1 > sx2)
+			if (transfer.Control == _GLCD_CTRL_DATA)
 			{
-				__GLCD_Swap(sx1, sx2);
+				cursor->Trial = 0;
+				failed        = 0;
 			}
 			
-			/* :::::::::::::::: Draw line :::::::::::::::: */
-			GLCD_DrawLine(sx1, sl, sx2, sl, color);
+			continue;
 			
 		}
 		
-		for (sl = y2; sl <= y3; sl++)
+		failed = 1;
+		
+		/* ~~~~~~~~~~~~~~~~~ Keep the rest for the next render ~~~~~~~~~~~~~~~~~ */
+		if (cursor->Trial >= _GLCD_RETRIES)
 		{
 			
-			/* :::::::::::::::: Calculate :::::::::::::::: */
-			sx1 = m2 * (sl - y3) + x3;
-			sx2 = m3 * (sl - y1) + x1;
+			#ifdef _GLCD_PAGE_FLIP
+			GLCD_FlipLost(cursor);
+			#endif
 			
-			if (sx1 > sx2)
-			{
-				__GLCD_Swap(sx1, sx2);
-			}
+			GLCD_MarkPending(&GLCD_Plan, last.Rect);
+			status = _GLCD_ERROR;
 			
-			/* :::::::::::::::: Draw line :::::::::::::::: */
-			GLCD_DrawLine(sx1, sl, sx2, sl, color);
+			break;
 			
 		}
 		
+		/* ~~~~~~~~~~ GDDRAM pointer is lost, address the packet again ~~~~~~~~~~ */
+		GLCD_EndTransfer();
+		
+		GLCD_Display->Shadow.MemMode       = _GLCD_MEM_MODE_UNKNOWN;
+		GLCD_Display->Shadow.Window.StartX = _GLCD_SHADOW_UNKNOWN;
+		*cursor                            = last;
+		cursor->Trial++; // Tries of a packet add up over the steps of a frame
+		
+		if (cursor->Setup == 0)
+		{
+			cursor->Setup = _GLCD_SETUP_RESUME;
+		}
+		
 	}
 	
-}
-
-void GLCD_DrawFilledCircle(const uint8_t centerX, const uint8_t centerY, const uint8_t radius, COLOR_TypeDef color)
-{
-	
-	if (((centerX + radius) < _GLCD_SCREEN_WIDTH) && ((centerY + radius) < _GLCD_SCREEN_HEIGHT))
+	/* ~~~~~~~~~~~~~~ Streamed transfers fail as a whole ~~~~~~~~~~~~~~ */
+	if (GLCD_EndTransfer() != _GLCD_OK)
 	{
 		
-		uint8_t x;
-		uint8_t y;
-		
-		int8_t  f;
-		int8_t  ddF_x;
-		int8_t  ddF_y;
-		
-		/* ~~~~~~~~~~~~~~~~~~~~~ Calculate Parameter ~~~~~~~~~~~~~~~~~~~~~ */	
-		f     = 1 - radius;
-		ddF_x = 1;
-		ddF_y = -2 * radius;
-		x     = 0;
-		y     = radius;
+		GLCD_Display->Shadow.MemMode       = _GLCD_MEM_MODE_UNKNOWN;
+		GLCD_Display->Shadow.Window.StartX = _GLCD_SHADOW_UNKNOWN;
+		GLCD_MarkPending(&GLCD_Plan, first.Rect);
+		status = _GLCD_ERROR;
 		
-		/* ~~~~~~~~~~ Fill in the center between the two halves ~~~~~~~~~~ */
-		GLCD_DrawLine(centerX, centerY - radius, centerX, centerY + radius, color);
-
-		while(x < y)
-		{
-			
-			//ddF_x = 2 * x + 1;
-			//ddF_y = -2 * y;
-			//f     = x * x + y * y - radius * radius + 2 * x - y + 1;
-			
-			/* :::::::::::::::: Calculate :::::::::::::::: */
-			if (f >= 0)
-			{
-				
-				y--;
-				ddF_y += 2;
-				f     += ddF_y;
-				
-			}
-			
-			x++;
-			ddF_x += 2;
-			f     += ddF_x;
-			
-			/* :::::::::::::::: Draw line :::::::::::::::: */
-			/*
-			  Now draw vertical lines between the points on the circle rather than
-			  draw the points of the circle. This draws lines between the
-			  perimeter points on the upper and lower quadrants of the 2 halves of the circle.
-			*/
-			GLCD_DrawVLine(centerY + y, centerY - y, centerX + x, color);
-			GLCD_DrawVLine(centerY + y, centerY - y, centerX - x, color);
-			GLCD_DrawVLine(centerY + x, centerY - x, centerX + y, color);
-			GLCD_DrawVLine(centerY + x, centerY - x, centerX - y, color);
-			
-		}
+		#ifdef _GLCD_PAGE_FLIP
+		GLCD_FlipLost(cursor);
+		#endif
 		
 	}
 	
-}
-
-/* :::::::::::::::::::: Scroll :::::::::::::::::::: */
-void GLCD_ScrollLeft(const uint8_t start, const uint8_t end)
-{
+	/* ~~~~~~~ A step that ends busy after a failed try counts as failed ~~~~~~~ */
+	if ((status == _GLCD_BUSY) && failed)
+	{
+		GLCD_Health(_GLCD_ERROR);
+	}
+	else if (spent > 0)
+	{
+		GLCD_Health((status == _GLCD_BUSY) ? _GLCD_OK : status);
+	}
 	
-	// The display is 16 rows tall. To scroll the whole display, run:
-	GLCD_TransmitCommand(_GLCD_CMD_SCROLL_LEFT);
-	GLCD_TransmitCommand(0x00); //Dummy
-
-	GLCD_TransmitCommand(start); //Start
-	GLCD_TransmitCommand(0x00); //Frames: 5
-	GLCD_TransmitCommand(end); //End
-
-	GLCD_TransmitCommand(0x00); //Dummy
-	GLCD_TransmitCommand(UINT8_MAX); //Dummy
-	GLCD_TransmitCommand(_GLCD_CMD_SCROLL_ACTIVE);
+	return status;
 	
 }
 
-void GLCD_ScrollRight(const uint8_t start, const uint8_t end)
+static void GLCD_StepAbort(void)
 {
 	
-	// The display is 16 rows tall. To scroll the whole display, run:
-	GLCD_TransmitCommand(_GLCD_CMD_SCROLL_RIGHT);
-	GLCD_TransmitCommand(0x00); //Dummy
-
-	GLCD_TransmitCommand(start); //Start
-	GLCD_TransmitCommand(0x00); //Frames: 5
-	GLCD_TransmitCommand(end); //End
-
-	GLCD_TransmitCommand(0x00); //Dummy
-	GLCD_TransmitCommand(UINT8_MAX); //Dummy
-	GLCD_TransmitCommand(_GLCD_CMD_SCROLL_ACTIVE);
+	/* ~~~~~~~~~~~~ Unsent part of a stepped frame stays dirty ~~~~~~~~~~~~ */
+	if (GLCD_Step.Active)
+	{
+		
+		GLCD_MarkPending(&GLCD_Plan, GLCD_Step.Cursor.Rect);
+		GLCD_Step.Active = 0;
+		
+	}
 	
 }
 
-void GLCD_ScrollDiagonalLeft(const uint8_t start, const uint8_t end)
+#ifndef _GLCD_PAGE_MODE
+static void GLCD_PlanCommit(GLCD_PlanTypeDef *plan)
 {
+	/* Render of GLCD_Render / GLCD_RenderStep / GLCD_AsyncStart: pending changes
+	   are taken, planned, and the dirty state is handed over to the plan */
 	
-	// The display is 16 rows tall. To scroll the whole display, run:
-	GLCD_TransmitCommand(_GLCD_CMD_SCROLL_VAREA_SET);
-	GLCD_TransmitCommand(0x00);
-	GLCD_TransmitCommand(_GLCD_SCREEN_HEIGHT);
-
-	GLCD_TransmitCommand(_GLCD_CMD_SCROLL_VLEFT);
-	GLCD_TransmitCommand(0x00); //Dummy
-	GLCD_TransmitCommand(start); //Start
-	GLCD_TransmitCommand(0x00); //Frames: 5
-	GLCD_TransmitCommand(end); //End
-	GLCD_TransmitCommand(0x01); //Vertical offset: 1
-
-	GLCD_TransmitCommand(_GLCD_CMD_SCROLL_ACTIVE);
+	#ifdef _GLCD_TRIPLE_BUFFER
+	GLCD_TripleTake(GLCD_Display); /* Latest published frame, kept until the plan is sent */
+	#endif
+	
+	#ifdef _GLCD_PAGE_HASH
+	GLCD_HashPages(GLCD_Display); /* Catch writes that bypassed GLCD_MarkDirty */
+	#endif
+	
+	GLCD_PlanRender(plan);
+	
+	#ifdef _GLCD_PAGE_FLIP
+	GLCD_FlipFold(); /* The other half still lacks the new changes */
+	#endif
+	
+	GLCD_MarkClean();
 	
 }
+#endif /* _GLCD_PAGE_MODE */
 
-void GLCD_ScrollDiagonalRight(const uint8_t start, const uint8_t end)
+static uint8_t GLCD_PlanLine(const uint8_t line, const uint8_t fold, GLCD_RectTypeDef *span)
 {
 	
-	// The display is 16 rows tall. To scroll the whole display, run:
-	GLCD_TransmitCommand(_GLCD_CMD_SCROLL_VAREA_SET);
-	GLCD_TransmitCommand(0x00);
-	GLCD_TransmitCommand(_GLCD_SCREEN_HEIGHT);
-
-	GLCD_TransmitCommand(_GLCD_CMD_SCROLL_VRIGHT);
-	GLCD_TransmitCommand(0x00); //Dummy
-	GLCD_TransmitCommand(start); //Start
-	GLCD_TransmitCommand(0x00); //Frames: 5
-	GLCD_TransmitCommand(end); //End
-	GLCD_TransmitCommand(0x01); //Vertical offset: 1
-
-	GLCD_TransmitCommand(_GLCD_CMD_SCROLL_ACTIVE);
+	uint8_t startX = GLCD_Display->Dirty.Start[line];
+	uint8_t endX   = GLCD_Display->Dirty.End[line];
+	
+	#ifdef _GLCD_PAGE_FLIP
+	
+	/* ..... Hidden half gets its lag along with the new changes ..... */
+	if (fold)
+	{
+		
+		startX = __GLCD_Min(startX, GLCD_Display->Dirty.LagStart[GLCD_FlipBack()][line]);
+		
+		if (GLCD_Display->Dirty.LagEnd[GLCD_FlipBack()][line] > endX)
+		{
+			endX = GLCD_Display->Dirty.LagEnd[GLCD_FlipBack()][line];
+		}
+		
+	}
+	
+	#else
+	
+	(void)fold;
+	
+	#endif /* _GLCD_PAGE_FLIP */
+	
+	if (startX == _GLCD_DIRTY_NONE)
+	{
+		return 0;
+	}
+	
+	span->StartX    = startX;
+	span->EndX      = endX;
+	span->StartLine = line;
+	span->EndLine   = line;
+	
+	return 1;
 	
 }
 
-void GLCD_ScrollStop(void)
+#ifdef _GLCD_USE_DMA
+static GLCD_StatusTypeDef GLCD_AsyncStart(void)
 {
-	GLCD_TransmitCommand(_GLCD_CMD_SCROLL_DEACTIVE);
+	
+	GLCD_StepAbort();
+	
+	GLCD_PlanCommit(&GLCD_Plan);
+	
+	GLCD_Async.Cursor.Rect   = 0;
+	GLCD_Async.Cursor.Setup  = _GLCD_SETUP_RECT;
+	GLCD_Async.Cursor.Trial  = 0;
+	GLCD_Async.Cursor.Gather = 1; // One DMA buffer per transfer
+	GLCD_Async.Pending      = 0;
+	GLCD_Async.Status       = _GLCD_OK;
+	GLCD_Async.Busy         = 1;
+	
+	return GLCD_AsyncNext();
+	
 }
 
-/* ::::::::::::::::::::: Font ::::::::::::::::::::: */
-void GLCD_SetFont(const uint8_t *name, const uint8_t width, const uint8_t height, GLCD_PrintModeTypeDef mode)
+static GLCD_StatusTypeDef GLCD_AsyncNext(void)
 {
 	
-	if ((width < _GLCD_SCREEN_WIDTH) && (height < _GLCD_SCREEN_HEIGHT) && ((mode == _GLCD_PRINT_MODE_OVERWRITE) || (mode == _GLCD_PRINT_MODE_MERGE)))
+	GLCD_StatusTypeDef         status;
+	GLCD_TransferTypeDef       transfer;
+	GLCD_RenderCallbackTypeDef callback;
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~ Start next transfer ~~~~~~~~~~~~~~~~~~~~~~~ */
+	if (GLCD_NextTransfer(&GLCD_Async.Cursor, &GLCD_Plan, &transfer, GLCD_PacketSize))
 	{
 		
-		/* ~~~~~~~~~~~~~~~~~ Change font pointer to new font ~~~~~~~~~~~~~~~~~ */
-		GLCD.Font.Name = (uint8_t *)(name);
-		
-		/* ~~~~~~~~~~~~~~~~~~~~~~~~ Update font's size ~~~~~~~~~~~~~~~~~~~~~~~ */
-		GLCD.Font.Width  = width;
-		GLCD.Font.Height = height;
+		if (GLCD_Transport->WriteAsync(GLCD_Transport->Handle, transfer.Control, transfer.Segment[0].Data, transfer.Segment[0].Size) == _GLCD_OK)
+		{
+			return _GLCD_OK;
+		}
 		
-		/* ~~~ Update lines required for a character to be fully displayed ~~~ */
-		GLCD.Font.Lines = (height - 1) / _GLCD_SCREEN_LINE_HEIGHT + 1;
+		#ifdef _GLCD_PAGE_FLIP
+		GLCD_FlipLost(&GLCD_Async.Cursor);
+		#endif
 		
-		/* ~~~~~~~~~~~~~~~~~~~~~~~ Update blending mode ~~~~~~~~~~~~~~~~~~~~~~ */
-		GLCD.Font.Mode = mode;
+		GLCD_Async.Status = _GLCD_ERROR;
+		GLCD_Invalidate();
 		
 	}
 	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~ Render is done ~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	status          = GLCD_Async.Status;
+	GLCD_Async.Busy = 0;
+	
+	GLCD_Health(status);
+	
+	if (GLCD_Async.Pending && (status == _GLCD_OK) && (GLCD_CmdQueue.Count == 0))
+	{
+		return GLCD_AsyncStart(); // Kept commands go first with the next GLCD_RenderAsync
+	}
+	
+	GLCD_Async.Pending = 0;
+	callback           = GLCD_Async.Callback;
+	
+	if (callback != NULL)
+	{
+		callback(status);
+	}
+	
+	return status;
+	
 }
 
-/* :::::::::::::::::::::::::::::::::::::::::::::::: */
-static void GLCD_BufferWrite(const uint8_t x, const uint8_t y, const uint8_t data)
-{
-	GLCD_Buffer[__GLCD_Pointer(x, y)] = data;
-}
-
-static uint8_t GLCD_BufferRead(const uint8_t x, const uint8_t y)
+static uint8_t GLCD_AsyncDone(void *port)
 {
-	// y >> 3 = y / 8
-	return (GLCD_Buffer[__GLCD_Pointer(x, y)]);
+	
+	/* ~~~~~~~~~~~~ Completion belongs to this display (and releases CS) ~~~~~~~~~~~~ */
+	if (GLCD_Transport->AsyncDone != NULL)
+	{
+		return GLCD_Transport->AsyncDone(GLCD_Transport->Handle, port);
+	}
+	
+	return 1;
+	
 }
+#endif /* _GLCD_USE_DMA */
 
 static inline void GLCD_DrawHLine(uint8_t startX, uint8_t endX, const uint8_t y, COLOR_TypeDef color)
 {
@@ -24,17 +24,37 @@
 /*----------------------------------------------------------*/
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Include ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
 #include "ssd1306_conf.h"
 
 /* ------------------------------------------------------------------ */
 
-#ifdef __CODEVISIONAVR__  /* Check compiler */
+#ifdef _GLCD_TRANSPORT_CUSTOM  /* Bus library is not needed */
+
+/* ------------------------------------------------------------------ */
+
+#elif defined(_GLCD_USE_LINUX_I2C)  /* Check host */
+
+	#ifndef __LINUX_I2C_H_
+		#include "LINUX_I2C/linux_i2c.h" /* Import i2c lib */
+	#endif
+
+	#include <unistd.h>      /* Import usleep */
+
+/* ------------------------------------------------------------------ */
+
+#elif defined(__CODEVISIONAVR__)  /* Check compiler */
 
 	#pragma warn_unref_func- /* Disable 'unused function' warning */
 
-	#ifndef __I2C_UNIT_H_
+	#ifdef _GLCD_USE_SPI
+		#ifndef __SPI_UNIT_H_
+			#include "SPI_UNIT/spi_unit.h" /* Import spi lib */
+		#endif
+	#elif !defined(__I2C_UNIT_H_)
 		#include "I2C_UNIT/i2c_unit.h" /* Import i2c lib */
-	#endif
+	#endif /* _GLCD_USE_SPI */
 
 	#include <delay.h>       /* Import delay library */
 
@@ -44,11 +64,17 @@
 
 	#pragma GCC diagnostic ignored "-Wunused-function" /* Disable 'unused function' warning */
 
-	#ifndef __I2C_UNIT_H_
+	#ifdef _GLCD_USE_SPI
+		#ifndef __SPI_UNIT_H_
+			#include "SPI_UNIT/spi_unit.h" /* Import spi lib */
+		#endif
+	#elif !defined(__I2C_UNIT_H_)
 		#include "I2C_UNIT/i2c_unit.h" /* Import i2c lib */
-	#endif
+	#endif /* _GLCD_USE_SPI */
 
-	#include <util/delay.h>  /* Import delay library */
+	#if !defined(_I2C_HOST_SIM) && !defined(_SPI_HOST_SIM)
+		#include <util/delay.h>  /* Import delay library */
+	#endif /* _I2C_HOST_SIM */
 
 /* ------------------------------------------------------------------ */
 
@@ -66,9 +92,13 @@
 
 /* ------------------------------------------------------- */
 
-	#ifndef __STM32_I2C_H_
+	#ifdef _GLCD_USE_SPI
+		#ifndef __STM32_SPI_H_
+			#include "STM32_SPI/stm32_spi.h" /* Import spi lib */
+		#endif
+	#elif !defined(__STM32_I2C_H_)
 		#include "STM32_I2C/stm32_i2c.h" /* Import i2c lib */
-	#endif
+	#endif /* _GLCD_USE_SPI */
 
 /* ------------------------------------------------------------------ */
 
@@ -93,9 +123,103 @@
 #define _GLCD_BIT_DC  6
 #define _GLCD_BIT_CO  7
 
+/* Control Byte */
+#define _GLCD_CTRL_COMMAND             (0 << _GLCD_BIT_DC)
+#define _GLCD_CTRL_DATA                (1 << _GLCD_BIT_DC)
+
+/* Command Queue */
+#ifndef _GLCD_CMD_QUEUE_SIZE
+	#define _GLCD_CMD_QUEUE_SIZE       32 /* Max commands per I2C burst */
+#endif
+
 /* Packet */
-#define _GLCD_PACKET_SIZE              16
-#define _GLCD_BUFF_SHIFT_FOR_PACKET    4
+#define _GLCD_PACKET_SIZE_FRAME        0 /* Whole run in one transaction */
+
+#ifndef _GLCD_PACKET_SIZE
+	#ifdef _GLCD_USE_SPI
+		#define _GLCD_PACKET_SIZE      _GLCD_PACKET_SIZE_FRAME /* No bus buffer to fit on SPI */
+	#else
+		#define _GLCD_PACKET_SIZE      16 /* Fits Arduino Wire's 32-byte buffer */
+	#endif /* _GLCD_USE_SPI */
+#endif
+
+#define _GLCD_CALIB_SIZES              5 /* 16, 32, 64, 128, Frame */
+
+#ifndef _GLCD_CALIB_FRAMES
+	#define _GLCD_CALIB_FRAMES         4 /* Frames measured per packet size */
+#endif
+
+/* Triple Buffer */
+#if defined(_GLCD_TRIPLE_BUFFER) && !defined(_GLCD_PAGE_HASH)
+	#define _GLCD_PAGE_HASH /* The renderer finds the pages of a taken frame by hash */
+#endif
+
+/* Dirty Tracking */
+#define _GLCD_DIRTY_NONE               0xFF /* Page has no changed column */
+
+#ifndef _GLCD_HASH_SEGMENTS
+	#define _GLCD_HASH_SEGMENTS        1 /* Hashed spans per page (1, 2, 4 or 8) */
+#endif
+
+#define _GLCD_HASH_SPAN                (_GLCD_SCREEN_WIDTH / _GLCD_HASH_SEGMENTS) /* Columns per hash */
+#define _GLCD_HASH_SEED                0x811C9DC5UL /* FNV-1a offset basis */
+#define _GLCD_HASH_PRIME               0x01000193UL /* FNV-1a prime */
+
+#ifdef _GLCD_PAGE_HASH
+	#define _GLCD_DIRTY_INIT_HASH      , {0}
+#else
+	#define _GLCD_DIRTY_INIT_HASH
+#endif
+
+#ifdef _GLCD_PAGE_FLIP
+	#define _GLCD_DIRTY_INIT_FLIP      , {{0}}, {{0}}
+#else
+	#define _GLCD_DIRTY_INIT_FLIP
+#endif
+
+#define _GLCD_DIRTY_INIT               {{0}, {0} _GLCD_DIRTY_INIT_HASH _GLCD_DIRTY_INIT_FLIP}
+
+/* Fault Handling */
+#ifndef _GLCD_RETRIES
+	#define _GLCD_RETRIES              2 /* Resends of a failed packet */
+#endif
+
+#ifndef _GLCD_BREAKER_FAILS
+	#define _GLCD_BREAKER_FAILS        3 /* Failed bursts in a row that take the display offline */
+#endif
+
+#ifndef _GLCD_PROBE_INTERVAL
+	#define _GLCD_PROBE_INTERVAL       32 /* GLCD_Render calls between probes while offline */
+#endif
+
+/* Displays */
+#define _GLCD_GROUP_END                0x100 /* Above every group of GLCD_RenderDisplays */
+#define _GLCD_MUX_UNKNOWN              0xFF /* Channel of the mux is not known */
+
+/* Render Planner */
+#define _GLCD_PLAN_WINDOW_CMDS         6 /* 0x21 Start End 0x22 Start End */
+#define _GLCD_PLAN_PAGE_CMDS           3 /* 0xB0|Page 0x00|Low 0x10|High */
+#define _GLCD_PLAN_MODE_CMDS           2 /* 0x20 Mode */
+#define _GLCD_PLAN_CMD_MAX             (_GLCD_PLAN_MODE_CMDS + _GLCD_PLAN_WINDOW_CMDS)
+
+#define _GLCD_SETUP_RECT               1 /* Address the rectangle from its start */
+#define _GLCD_SETUP_RESUME             2 /* Address the rectangle from the cursor (retry) */
+
+/* Render Step */
+#define _GLCD_BUDGET_NONE              UINT32_MAX /* GLCD_Render: no budget */
+#define _GLCD_I2C_BITS_PER_BYTE        9          /* 8 data bits + ACK */
+
+#define __GLCD_BUDGET_US(us, clock)    ((uint16_t)(((uint32_t)(us) * ((clock) / 1000UL)) / (_GLCD_I2C_BITS_PER_BYTE * 1000UL))) /* Bytes in a time at an I2C clock (Hz) */
+
+/* Memory Addressing Mode */
+#define _GLCD_MEM_MODE_HORIZONTAL      0x00
+#define _GLCD_MEM_MODE_PAGE            0x02
+#define _GLCD_MEM_MODE_UNKNOWN         0xFF /* A 0x20 command may be lost */
+
+/* Shadow Registers */
+#define _GLCD_SHADOW_UNKNOWN           0xFF       /* Not known, the next setter sends it */
+#define _GLCD_CONTRAST_UNKNOWN         UINT16_MAX
+#define _GLCD_START_LINE_MASK          0x3F
 
 #define _GLCD_CONTRAST_MAX             UINT8_MAX
 #define _GLCD_PRECHARGE_DEF            0xF1
@@ -132,15 +256,176 @@
 
 #define	_GLCD_SCREEN_LINE_HEIGHT  8
 #define _GLCD_SCREEN_LINES        _GLCD_SCREEN_HEIGHT / _GLCD_SCREEN_LINE_HEIGHT
+#if defined(_GLCD_PAGE_MODE)
+	#define _GLCD_BUFFER_SIZE     (_GLCD_SCREEN_WIDTH) /* One page, rasterised from the display list */
+#elif defined(_GLCD_DIRECT_TEXT)
+	#define _GLCD_BUFFER_SIZE     0 /* No buffer, drawing goes straight to GDDRAM */
+#else
+	#define _GLCD_BUFFER_SIZE     (_GLCD_SCREEN_WIDTH * _GLCD_SCREEN_LINES)
+#endif /* _GLCD_PAGE_MODE */
+
+/* ----------------------- Page Flip ----------------------- */
+#ifdef _GLCD_PAGE_FLIP
+
+	#if (_GLCD_SIZE == _GLCD_SIZE_128x64)
+		#error "_GLCD_PAGE_FLIP needs a hidden GDDRAM half (_GLCD_SIZE_128x32 or _GLCD_SIZE_96x16)"
+	#endif
+
+	#define _GLCD_FLIP_HALVES     2
+	#define _GLCD_FLIP_TAIL       1 /* Start line command after the last rectangle */
+	#define _GLCD_GDDRAM_LINES    ((_GLCD_SCREEN_LINES) * _GLCD_FLIP_HALVES)
+
+#else
+
+	#define _GLCD_FLIP_TAIL       0
+	#define _GLCD_GDDRAM_LINES    (_GLCD_SCREEN_LINES)
+
+#endif /* _GLCD_PAGE_FLIP */
+
+/* ------------------------- Layers ------------------------ */
+#ifdef _GLCD_LAYERS
+
+	#ifndef _GLCD_LAYER_STAGE
+		#define _GLCD_LAYER_STAGE _GLCD_SCREEN_WIDTH /* Composed bytes per transfer */
+	#endif
+
+	#if (_GLCD_LAYER_STAGE < _GLCD_SCREEN_WIDTH)
+		#error "_GLCD_LAYER_STAGE holds at least one page"
+	#endif
+
+	#define __GLCD_LAYERS_INIT(buffer) , {NULL, 0, (buffer)}
+	#define __GLCD_Canvas(display)     ((display)->Layers.Canvas)
+
+#else
+
+	#define __GLCD_LAYERS_INIT(buffer)
+	#define __GLCD_Canvas(display)     ((display)->Buffer)
+
+#endif /* _GLCD_LAYERS */
+
+/* ----------------------- Page Mode ----------------------- */
+#ifdef _GLCD_PAGE_MODE
+
+	#if defined(_GLCD_USE_DMA) || defined(_GLCD_LAYERS) || defined(_GLCD_PAGE_HASH) || defined(_GLCD_PAGE_FLIP)
+		#error "_GLCD_PAGE_MODE reuses one page buffer: no _GLCD_USE_DMA, _GLCD_LAYERS, _GLCD_PAGE_HASH or _GLCD_PAGE_FLIP"
+	#endif
+
+	#ifndef _GLCD_LIST_SIZE
+		#define _GLCD_LIST_SIZE   256 /* Display list arena (bytes) */
+	#endif
+
+	#define _GLCD_LIST_HEADER     3 /* Op, pages, payload size */
+	#define _GLCD_LIST_OVERFLOW   UINT16_MAX /* GLCD_GetListUsed: an op did not fit */
+	#define _GLCD_LIST_ALL_PAGES  ((uint8_t)((1U << _GLCD_SCREEN_LINES) - 1))
+
+#endif /* _GLCD_PAGE_MODE */
+
+/* ---------------------- Direct Text ---------------------- */
+#ifdef _GLCD_DIRECT_TEXT
+
+	#if defined(_GLCD_PAGE_MODE) || defined(_GLCD_USE_DMA) || defined(_GLCD_LAYERS) || defined(_GLCD_PAGE_HASH) || defined(_GLCD_PAGE_FLIP)
+		#error "_GLCD_DIRECT_TEXT has no buffer to render: no _GLCD_PAGE_MODE, _GLCD_USE_DMA, _GLCD_LAYERS, _GLCD_PAGE_HASH or _GLCD_PAGE_FLIP"
+	#endif
+
+	#ifndef _GLCD_GLYPH_STAGE
+		#define _GLCD_GLYPH_STAGE 16 /* Glyph columns gathered per data packet */
+	#endif
+
+	#ifndef _GLCD_INIT_CLEAR
+		#define _GLCD_INIT_CLEAR /* GDDRAM is the only copy of the screen */
+	#endif
+
+#endif /* _GLCD_DIRECT_TEXT */
+
+/* --------------------- Triple Buffer --------------------- */
+#ifdef _GLCD_TRIPLE_BUFFER
+
+	#if defined(_GLCD_PAGE_MODE) || defined(_GLCD_DIRECT_TEXT) || defined(_GLCD_LAYERS) || defined(_GLCD_PAGE_FLIP)
+		#error "_GLCD_TRIPLE_BUFFER hands whole frames over: no _GLCD_PAGE_MODE, _GLCD_DIRECT_TEXT, _GLCD_LAYERS or _GLCD_PAGE_FLIP"
+	#endif
+
+	#define _GLCD_TRIPLE_FRESH    0x80 /* Published frame is not taken yet */
+	#define _GLCD_TRIPLE_INDEX    0x03 /* Frame of the hand-off slot */
+
+	/* Hand-off slot: exchange and load of one byte, atomic against the renderer */
+	#ifndef _GLCD_ATOMIC_XCHG
+
+		#if defined(__AVR__) && defined(__GNUC__)
+
+			#include <util/atomic.h>
+
+			#define _GLCD_ATOMIC_XCHG(ptr, value) __extension__({ uint8_t __old; ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { __old = *(ptr); *(ptr) = (value); } __old; })
+			#define _GLCD_ATOMIC_LOAD(ptr)        (*(ptr)) /* One byte read */
+
+		#elif defined(__GNUC__)
+
+			#define _GLCD_ATOMIC_XCHG(ptr, value) __atomic_exchange_n((ptr), (value), __ATOMIC_ACQ_REL)
+			#define _GLCD_ATOMIC_LOAD(ptr)        __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+
+		#else
+			#error "_GLCD_TRIPLE_BUFFER: define _GLCD_ATOMIC_XCHG(ptr, value) and _GLCD_ATOMIC_LOAD(ptr) for this compiler"
+		#endif
+
+	#endif /* _GLCD_ATOMIC_XCHG */
+
+	#ifndef _GLCD_ATOMIC_LOAD
+		#define _GLCD_ATOMIC_LOAD(ptr)        (*(ptr))
+	#endif
+
+	#define __GLCD_TRIPLE_INIT(buffer, second, third) , {{(buffer), (second), (third)}, 1, 0, 2, {{0}}, {{0}}}
+	#define __GLCD_Shown(display)      ((display)->Triple.Frame[(display)->Triple.Show])
+
+#else
+
+	#define __GLCD_TRIPLE_INIT(buffer, second, third)
+	#define __GLCD_Shown(display)      ((display)->Buffer)
+
+#endif /* _GLCD_TRIPLE_BUFFER */
 
 /* ------------------------ GLCD CMD ----------------------- */
 /* Charge Pump Command Table */
 #define _GLCD_CMD_CHARGE_PUMP_SET         0x8D
 #define _GLCD_CMD_CHARGE_PUMP_ENABLE      0x14
 
+#define _GLCD_CMD_CHARGE_PUMP_DISABLE     0x10 /* External VCC */
+
 #define _GLCD_CMD_SEQUENTIAL_COM_PIN_CFG  0x12
 #define _GLCD_CMD_ALTERNATIVE_COM_PIN_CFG 0x02
 
+#if (_GLCD_SIZE == _GLCD_SIZE_128x64)
+	#define _GLCD_COM_PIN_CFG             _GLCD_CMD_SEQUENTIAL_COM_PIN_CFG
+#else
+	#define _GLCD_COM_PIN_CFG             _GLCD_CMD_ALTERNATIVE_COM_PIN_CFG
+#endif
+
+/* Panel Profile */
+#define _GLCD_PRECHARGE_EXT_VCC           0x22 /* Phase 1 and 2 of 2 DCLKs */
+#define _GLCD_CONTRAST_EXT_VCC            0x9F
+
+/* Init sequence up to 0xAF, GLCD_Init sends 0xAF after it (and after the GDDRAM clear) */
+#define __GLCD_PROFILE(pump, precharge, contrast, remap, scan) \
+	_GLCD_CMD_DISP_OFF, \
+	_GLCD_CMD_DISP_CLK_DIV_RATIO_SET, _GLCD_SUGGEST_RATIO, \
+	_GLCD_CMD_MULTIPLEX_RATIO_SET, (_GLCD_SCREEN_HEIGHT - 1), \
+	_GLCD_CMD_DISP_START_OFFSET_SET, 0x00, \
+	_GLCD_CMD_CHARGE_PUMP_SET, (pump), \
+	(_GLCD_CMD_DISP_START_LINE_SET | 0x00), \
+	_GLCD_CMD_MEM_ADD_SET, _GLCD_MEM_MODE_HORIZONTAL, \
+	(remap), \
+	(scan), \
+	_GLCD_CMD_COM_PINS_SET, _GLCD_COM_PIN_CFG, \
+	_GLCD_CMD_CONTRAST_SET, (contrast), \
+	_GLCD_CMD_PRECHARGE_PERIOD_SET, (precharge), \
+	_GLCD_CMD_VCOMH_DESELECT_LEVEL_SET, _GLCD_VCOMH_DESELECT_LEVEL_DEF, \
+	_GLCD_CMD_DISP_ALL_ON_RESUME, \
+	_GLCD_CMD_DISP_NORMAL, \
+	_GLCD_CMD_SCROLL_DEACTIVE
+
+/* GDDRAM Clear */
+#ifndef _GLCD_CLEAR_BLOCK
+	#define _GLCD_CLEAR_BLOCK             16 /* Zero bytes per segment of GLCD_ClearGDDRAM */
+#endif
+
 /* ------------------------- Macro ------------------------- */
 #define __GLCD_GetLine(Y)			 (Y / _GLCD_SCREEN_HEIGHT)
 #define __GLCD_Min(X, Y)			 ((X < Y) ? X : Y)
@@ -148,6 +433,7 @@
 #define __GLCD_Swap(X, Y)			 do { typeof(X) t = X; X = Y; Y = t; } while (0)
 #define __GLCD_Byte2ASCII(Value)	 (Value = Value + '0')
 #define __GLCD_Pointer(X, Y)		 (X + ((Y / _GLCD_SCREEN_LINE_HEIGHT) *_GLCD_SCREEN_WIDTH))
+#define __GLCD_SPI_DC(Control)		 (((Control) == _GLCD_CTRL_DATA) ? _SPI_DC_DATA : _SPI_DC_COMMAND)
 
 #define __BitSet(x, y)               (x |= (1UL<<y))
 #define __BitClear(x, y)             (x &= (~(1UL<<y)))
@@ -176,57 +462,201 @@
 #define _BIT_SHIFT_FOR_DEVIDE_BY_16  4 // 2^4 = 16
 
 /* ---------------------- By compiler ---------------------- */
-#ifdef __CODEVISIONAVR__  /* Check compiler */
+/* Bus functions of the built-in transports (ssd1306_transport.c) */
+#ifdef _GLCD_TRANSPORT_CUSTOM  /* Transport is given by GLCD_SetTransport */
+
+/* ------------------------------------------------------------------ */
+#elif defined(_GLCD_USE_LINUX_I2C)  /* Check host */
+
+#define _ERROR_VAL                          LINUX_I2C_ERROR /* OK status value */
+#define _OK_VAL                             LINUX_I2C_OK /* OK status value */
+
+#define _I2C_MEM_WRITE(bus,ma,mas,md,qu,tim)    LINUX_I2C_Mem_Write((LINUX_I2C_HandleTypeDef *)(bus)->Port,(bus)->DevAddress,(ma),(mas),(md),(qu),(tim)) /* Change function */
+#define _I2C_MEM_WRITEV(bus,ma,mas,sg,cn,tim)   LINUX_I2C_Mem_WriteV((LINUX_I2C_HandleTypeDef *)(bus)->Port,(bus)->DevAddress,(ma),(mas),(const LINUX_I2C_SegmentTypeDef *)(sg),(cn),(tim)) /* Change function */
+
+/* Messages are queued and sent in one I2C_RDWR by GLCD_EndTransfer */
+#define _I2C_SESSION_BEGIN(bus,ma,mas,tim)      LINUX_I2C_Session_Begin((LINUX_I2C_HandleTypeDef *)(bus)->Port,(bus)->DevAddress,(ma),(mas)) /* Change function */
+#define _I2C_SESSION_WRITE(bus,md,qu,tim)       LINUX_I2C_Session_Write((LINUX_I2C_HandleTypeDef *)(bus)->Port,(md),(qu)) /* Change function */
+#define _I2C_SESSION_END(bus,tim)               LINUX_I2C_Session_End((LINUX_I2C_HandleTypeDef *)(bus)->Port) /* Change function */
+#define _I2C_SESSION_FLUSH(bus,tim)             LINUX_I2C_Flush((LINUX_I2C_HandleTypeDef *)(bus)->Port) /* Change function */
+
+#ifndef _DELAY_MS
+#define _DELAY_MS(t)                        usleep((t) * 1000UL) /* Change function */
+#endif /* _DELAY_MS */
+
+#ifndef _GLCD_COST_TRANSACTION
+#define _GLCD_COST_TRANSACTION              2 /* Sr + SLA+W + Control inside one I2C_RDWR */
+#endif /* _GLCD_COST_TRANSACTION */
+
+/* ------------------------------------------------------------------ */
+#elif defined(__CODEVISIONAVR__)  /* Check compiler */
 
 #define _ERROR_VAL                        _STAT_ERROR /* OK status value */
 #define _OK_VAL                           _STAT_OK /* OK status value */
+
+#ifdef _GLCD_USE_SPI
+
+#define I2C_MEMADD_SIZE_8BIT              0 /* Unused, control byte selects the D/C level */
+
+#define _I2C_MEM_WRITE(bus,ma,mas,md,qu,tim)  SPI_DC_Write((const SPI_LinesTypeDef *)(bus)->Lines,__GLCD_SPI_DC(ma),(md),(qu),(tim)) /* Change function */
+#define _I2C_MEM_WRITEV(bus,ma,mas,sg,cn,tim) SPI_DC_WriteV((const SPI_LinesTypeDef *)(bus)->Lines,__GLCD_SPI_DC(ma),(const SPI_SegmentTypeDef *)(sg),(cn),(tim)) /* Change function */
+#define _GLCD_BUS_RESET(bus)              SPI_Reset((const SPI_LinesTypeDef *)(bus)->Lines) /* Change function */
+
+#ifndef _GLCD_COST_TRANSACTION
+#define _GLCD_COST_TRANSACTION            1 /* D/C and CS edges */
+#endif /* _GLCD_COST_TRANSACTION */
+
+#else
+
 #define I2C_MEMADD_SIZE_8BIT              _I2C_MEMADD_SIZE_8BIT /* Memory Address Size */
 #define I2C_MEMADD_SIZE_16BIT             _I2C_MEMADD_SIZE_16BIT /* Memory Address Size */
 
 #define _I2C_MEM_READY(tr,tim)            I2C_IsDeviceReady(_GLCD_DEV_ADDRESS,(tr),(tim)) /* Change function */
-#define _I2C_MEM_WRITE(ma,mas,md,qu,tim)  I2C_Mem_Write(_GLCD_DEV_ADDRESS,(ma),(mas),(md),(qu),(tim)) /* Change function */
+#define _I2C_MEM_WRITE(bus,ma,mas,md,qu,tim)  I2C_Mem_Write((bus)->DevAddress,(ma),(mas),(md),(qu),(tim)) /* Change function */
 #define _I2C_MEM_READ(ma,mas,md,qu,tim)   I2C_Mem_Read(_GLCD_DEV_ADDRESS,(ma),(mas),(md),(qu),(tim)) /* Change function */
 #define _I2C_MEM_ERASE(ma,mas,qu,tim)     I2C_Mem_Erase(_GLCD_DEV_ADDRESS,(ma),(mas),(qu),(tim)) /* Change function */
 
+#ifndef _I2C_INTERRUPT_MODE
+#define _I2C_SESSION_BEGIN(bus,ma,mas,tim)    I2C_Session_Begin((bus)->DevAddress,(ma),(mas),(tim)) /* Change function */
+#define _I2C_SESSION_WRITE(bus,md,qu,tim)     I2C_Session_Write((md),(qu),(tim)) /* Change function */
+#define _I2C_SESSION_END(bus,tim)             I2C_Session_End((tim)) /* Change function */
+#else
+#define _I2C_MEM_WAIT(bus,tim)                I2C_IT_Wait((tim)) /* Queued writes are done, a NACK fails it */
+#endif /* _I2C_INTERRUPT_MODE */
+
+#endif /* _GLCD_USE_SPI */
+
 #ifndef _DELAY_MS
 #define _DELAY_MS(t)                      delay_ms((t)) /* Change function */
 #endif /* _DELAY_MS */
 
+#ifndef _GLCD_COST_TRANSACTION
+#ifdef _GLCD_TRUSTED_DEVICE
+#define _GLCD_COST_TRANSACTION            3 /* START + SLA+W + Control + STOP */
+#else
+#define _GLCD_COST_TRANSACTION            5 /* START + SLA+W + Control + STOP + ready probe */
+#endif /* _GLCD_TRUSTED_DEVICE */
+#endif /* _GLCD_COST_TRANSACTION */
+
 /* ------------------------------------------------------------------ */
 #elif defined(__GNUC__) && !defined(USE_HAL_DRIVER)  /* Check compiler */
 
 #define _ERROR_VAL                        _STAT_ERROR /* OK status value */
 #define _OK_VAL                           _STAT_OK /* OK status value */
+
+#ifdef _GLCD_USE_SPI
+
+#define I2C_MEMADD_SIZE_8BIT              0 /* Unused, control byte selects the D/C level */
+
+#define _I2C_MEM_WRITE(bus,ma,mas,md,qu,tim)  SPI_DC_Write((const SPI_LinesTypeDef *)(bus)->Lines,__GLCD_SPI_DC(ma),(md),(qu),(tim)) /* Change function */
+#define _I2C_MEM_WRITEV(bus,ma,mas,sg,cn,tim) SPI_DC_WriteV((const SPI_LinesTypeDef *)(bus)->Lines,__GLCD_SPI_DC(ma),(const SPI_SegmentTypeDef *)(sg),(cn),(tim)) /* Change function */
+#define _GLCD_BUS_RESET(bus)              SPI_Reset((const SPI_LinesTypeDef *)(bus)->Lines) /* Change function */
+
+#ifndef _GLCD_COST_TRANSACTION
+#define _GLCD_COST_TRANSACTION            1 /* D/C and CS edges */
+#endif /* _GLCD_COST_TRANSACTION */
+
+#else
+
 #define I2C_MEMADD_SIZE_8BIT              _I2C_MEMADD_SIZE_8BIT /* Memory Address Size */
 #define I2C_MEMADD_SIZE_16BIT             _I2C_MEMADD_SIZE_16BIT /* Memory Address Size */
 
 #define _I2C_MEM_READY(tr,tim)            I2C_IsDeviceReady(_GLCD_DEV_ADDRESS,(tr),(tim)) /* Change function */
-#define _I2C_MEM_WRITE(ma,mas,md,qu,tim)  I2C_Mem_Write(_GLCD_DEV_ADDRESS,(ma),(mas),(md),(qu),(tim)) /* Change function */
+#define _I2C_MEM_WRITE(bus,ma,mas,md,qu,tim)  I2C_Mem_Write((bus)->DevAddress,(ma),(mas),(md),(qu),(tim)) /* Change function */
 #define _I2C_MEM_READ(ma,mas,md,qu,tim)   I2C_Mem_Read(_GLCD_DEV_ADDRESS,(ma),(mas),(md),(qu),(tim)) /* Change function */
 #define _I2C_MEM_ERASE(ma,mas,qu,tim)     I2C_Mem_Erase(_GLCD_DEV_ADDRESS,(ma),(mas),(qu),(tim)) /* Change function */
 
+#ifndef _I2C_INTERRUPT_MODE
+#define _I2C_SESSION_BEGIN(bus,ma,mas,tim)    I2C_Session_Begin((bus)->DevAddress,(ma),(mas),(tim)) /* Change function */
+#define _I2C_SESSION_WRITE(bus,md,qu,tim)     I2C_Session_Write((md),(qu),(tim)) /* Change function */
+#define _I2C_SESSION_END(bus,tim)             I2C_Session_End((tim)) /* Change function */
+#else
+#define _I2C_MEM_WAIT(bus,tim)                I2C_IT_Wait((tim)) /* Queued writes are done, a NACK fails it */
+#endif /* _I2C_INTERRUPT_MODE */
+
+#endif /* _GLCD_USE_SPI */
+
 #ifndef _DELAY_MS
 #define _DELAY_MS(t)                      _delay_ms((t)) /* Change function */
 #endif /* _DELAY_MS */
 
+#ifndef _GLCD_COST_TRANSACTION
+#ifdef _GLCD_TRUSTED_DEVICE
+#define _GLCD_COST_TRANSACTION            3 /* START + SLA+W + Control + STOP */
+#else
+#define _GLCD_COST_TRANSACTION            5 /* START + SLA+W + Control + STOP + ready probe */
+#endif /* _GLCD_TRUSTED_DEVICE */
+#endif /* _GLCD_COST_TRANSACTION */
+
 /* ------------------------------------------------------------------ */
 #elif defined(USE_HAL_DRIVER)  /* Check driver */
 
 #define _ERROR_VAL                          HAL_ERROR /* OK status value */
 #define _OK_VAL                             HAL_OK /* OK status value */
 
+#ifdef _GLCD_USE_SPI
+
+#ifndef I2C_MEMADD_SIZE_8BIT
+#define I2C_MEMADD_SIZE_8BIT                0x00000001U /* Unused, control byte selects the D/C level */
+#endif /* I2C_MEMADD_SIZE_8BIT */
+
+#define _I2C_MEM_WRITE(bus,ma,mas,md,qu,tim)    HAL_SPI_DC_Write((SPI_HandleTypeDef *)(bus)->Port,(const SPI_LinesTypeDef *)(bus)->Lines,__GLCD_SPI_DC(ma),(md),(qu),(tim)) /* Change function */
+#define _I2C_MEM_WRITE_DMA(bus,ma,mas,md,qu)    HAL_SPI_DC_Write_DMA((SPI_HandleTypeDef *)(bus)->Port,(const SPI_LinesTypeDef *)(bus)->Lines,__GLCD_SPI_DC(ma),(md),(qu)) /* Change function */
+#define _I2C_MEM_WRITEV(bus,ma,mas,sg,cn,tim)   HAL_SPI_DC_WriteV((SPI_HandleTypeDef *)(bus)->Port,(const SPI_LinesTypeDef *)(bus)->Lines,__GLCD_SPI_DC(ma),(const SPI_SegmentTypeDef *)(sg),(cn),(tim)) /* Change function */
+#define _GLCD_BUS_RESET(bus)                    HAL_SPI_DC_Reset((const SPI_LinesTypeDef *)(bus)->Lines) /* Change function */
+#define _GLCD_BUS_RELEASE(bus)                  HAL_SPI_DC_Release((const SPI_LinesTypeDef *)(bus)->Lines) /* Change function */
+
+#ifndef _GLCD_COST_TRANSACTION
+#define _GLCD_COST_TRANSACTION              1 /* D/C and CS edges */
+#endif /* _GLCD_COST_TRANSACTION */
+
+#else
+
 #define _I2C_MEM_READY(tr,tim)              HAL_I2C_IsDeviceReady(&_SSD1306_I2C,_GLCD_DEV_ADDRESS,(tr),(tim)) /* Change function */
-#define _I2C_MEM_WRITE(ma,mas,md,qu,tim)    HAL_I2C_Mem_Write2(&_SSD1306_I2C,_GLCD_DEV_ADDRESS,(ma),(mas),(md),(qu),(tim)) /* Change function */
+#define _I2C_MEM_WRITE(bus,ma,mas,md,qu,tim)    HAL_I2C_Mem_Write2((I2C_HandleTypeDef *)(bus)->Port,(bus)->DevAddress,(ma),(mas),(md),(qu),(tim)) /* Change function */
+#define _I2C_MEM_WRITE_DMA(bus,ma,mas,md,qu)    HAL_I2C_Mem_Write2_DMA((I2C_HandleTypeDef *)(bus)->Port,(bus)->DevAddress,(ma),(mas),(md),(qu)) /* Change function */
+#define _I2C_MEM_WRITEV(bus,ma,mas,sg,cn,tim)   HAL_I2C_Mem_WriteV((I2C_HandleTypeDef *)(bus)->Port,(bus)->DevAddress,(ma),(mas),(const I2C_SegmentTypeDef *)(sg),(cn),(tim)) /* Change function */
 #define _I2C_MEM_READ(ma,mas,md,qu,tim)     HAL_I2C_Mem_Read2(&_SSD1306_I2C,_GLCD_DEV_ADDRESS,(ma),(mas),(md),(qu),(tim)) /* Change function */
 #define _I2C_MEM_ERASE(ma,mas,qu,tim)       HAL_I2C_Mem_Erase(&_SSD1306_I2C,_GLCD_DEV_ADDRESS,(ma),(mas),(qu),_MEM_STWC,(tim)) /* Change function */
 
+#endif /* _GLCD_USE_SPI */
+
 #ifndef _DELAY_MS
 #define _DELAY_MS(t)                        HAL_Delay((t)) /* Change function */
 #endif /* _DELAY_MS */
 
+#ifndef _GLCD_COST_TRANSACTION
+#define _GLCD_COST_TRANSACTION              3 /* START + SLA+W + Control + STOP */
+#endif /* _GLCD_COST_TRANSACTION */
+
+#ifndef _GLCD_GET_TICK
+#define _GLCD_GET_TICK()                    HAL_GetTick() /* Change function */
+#endif /* _GLCD_GET_TICK */
+
 /* ------------------------------------------------------------------ */
 #else
-#endif /* __CODEVISIONAVR__ */
+#endif /* _GLCD_TRANSPORT_CUSTOM */
+
+#ifndef _GLCD_COST_TRANSACTION
+#define _GLCD_COST_TRANSACTION              3 /* Until GLCD_SetTransport gives the overhead */
+#endif /* _GLCD_COST_TRANSACTION */
+
+#ifdef _I2C_SESSION_BEGIN
+	#define _GLCD_STREAM          1 /* Consecutive transfers share one START */
+#else
+	#define _GLCD_STREAM          0
+#endif /* _I2C_SESSION_BEGIN */
+
+#if (_GLCD_STREAM == 1) || (defined(_I2C_MEM_WRITEV) && (defined(_GLCD_USE_WRITEV) || defined(_GLCD_USE_SPI)))
+	#define _GLCD_GATHER          1 /* Built-in transport writes page slices in one transaction */
+#else
+	#define _GLCD_GATHER          0
+#endif /* _GLCD_STREAM */
+
+#if defined(_GLCD_USE_DMA) && !defined(_GLCD_TRANSPORT_CUSTOM) && !(defined(USE_HAL_DRIVER) && defined(HAL_DMA_MODULE_ENABLED))
+	#error "_GLCD_USE_DMA requires the STM32 HAL driver with DMA enabled"
+#endif /* _GLCD_USE_DMA */
+
 
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Types ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 typedef enum /* GLCD Display CMD */
@@ -294,8 +724,10 @@ typedef enum /* Timing and Driving Scheme Setting Command */
 typedef enum /* GLCD Status */
 {
 	
-	_GLCD_OK     = 0,
-	_GLCD_ERROR  = 1
+	_GLCD_OK      = 0,
+	_GLCD_ERROR   = 1,
+	_GLCD_BUSY    = 2,
+	_GLCD_OFFLINE = 3  /* Circuit breaker is open, the display is only probed */
 	
 }GLCD_StatusTypeDef;
 
@@ -315,6 +747,26 @@ typedef enum /* GLCD Display Mode */
 	
 }GLCD_ModeTypeDef;
 
+typedef enum /* GLCD Render Plan */
+{
+	
+	_GLCD_PLAN_NONE       = 0, /* Nothing changed */
+	_GLCD_PLAN_FULL_FRAME = 1, /* One window over the whole screen */
+	_GLCD_PLAN_WINDOW     = 2, /* 0x21/0x22 window per rectangle */
+	_GLCD_PLAN_PAGE       = 3  /* 0xB0/0x00/0x10 page addressing per span */
+	
+}GLCD_PlanModeTypeDef;
+
+typedef enum /* Layer Raster Operation, applied to the layers below */
+{
+	
+	_GLCD_ROP_COPY    = 0, /* Layer replaces what is below */
+	_GLCD_ROP_OR      = 1, /* Set bits light pixels */
+	_GLCD_ROP_AND_NOT = 2, /* Set bits clear pixels */
+	_GLCD_ROP_XOR     = 3  /* Set bits toggle pixels */
+	
+}GLCD_RopTypeDef;
+
 typedef enum /* GLCD Print Mode */
 {
 	
@@ -323,6 +775,40 @@ typedef enum /* GLCD Print Mode */
 	
 }GLCD_PrintModeTypeDef;
 
+typedef enum /* Display List Op, the ones from _GLCD_OP_CHAR on keep X, Y and the font */
+{
+	
+	_GLCD_OP_FONT                   = 0,
+	_GLCD_OP_CLEAR_LINE             = 1,
+	_GLCD_OP_INVERT_RECT            = 2,
+	_GLCD_OP_PIXEL                  = 3,
+	_GLCD_OP_PIXELS                 = 4,
+	_GLCD_OP_LINE                   = 5,
+	_GLCD_OP_RECTANGLE              = 6,
+	_GLCD_OP_ROUND_RECTANGLE        = 7,
+	_GLCD_OP_TRIANGLE               = 8,
+	_GLCD_OP_CIRCLE                 = 9,
+	_GLCD_OP_FILL_SCREEN            = 10,
+	_GLCD_OP_FILLED_RECTANGLE       = 11,
+	_GLCD_OP_FILLED_ROUND_RECTANGLE = 12,
+	_GLCD_OP_FILLED_TRIANGLE        = 13,
+	_GLCD_OP_FILLED_CIRCLE          = 14,
+	_GLCD_OP_CHAR                   = 15,
+	_GLCD_OP_STRING                 = 16, /* Text is copied into the list */
+	_GLCD_OP_STRING_P               = 17, /* Pointer to flash */
+	_GLCD_OP_BITMAP                 = 18  /* Pointer, the bitmap must outlive the list */
+	
+}GLCD_OpTypeDef;
+
+typedef enum /* Display List Mode */
+{
+	
+	_GLCD_LIST_RECORD = 0, /* Draw calls are added to the list */
+	_GLCD_LIST_DRY    = 1, /* Op runs for its cursor and pages, nothing is written */
+	_GLCD_LIST_RASTER = 2  /* Ops draw into the page buffer */
+	
+}GLCD_ListModeTypeDef;
+
 
 typedef struct
 {
@@ -336,6 +822,164 @@ typedef struct
 	
 }GLCD_FontTypeDef;
 
+typedef struct
+{
+	
+	uint8_t Buffer[_GLCD_CMD_QUEUE_SIZE];
+	uint8_t Count;
+	
+}GLCD_CmdQueueTypeDef;
+
+typedef struct
+{
+	
+	uint8_t Start[_GLCD_SCREEN_LINES]; /* First changed column of each page */
+	uint8_t End[_GLCD_SCREEN_LINES];   /* Last changed column of each page */
+	
+	#ifdef _GLCD_PAGE_HASH
+	uint32_t Hash[_GLCD_SCREEN_LINES * _GLCD_HASH_SEGMENTS]; /* Content seen by the last render */
+	#endif
+	
+	#ifdef _GLCD_PAGE_FLIP
+	uint8_t LagStart[_GLCD_FLIP_HALVES][_GLCD_SCREEN_LINES]; /* Changes a GDDRAM half has not got */
+	uint8_t LagEnd[_GLCD_FLIP_HALVES][_GLCD_SCREEN_LINES];
+	#endif
+	
+}GLCD_DirtyTypeDef;
+
+typedef struct
+{
+	
+	uint8_t StartX;
+	uint8_t EndX;
+	uint8_t StartLine;
+	uint8_t EndLine;
+	
+}GLCD_RectTypeDef;
+
+typedef struct
+{
+	
+	GLCD_PlanModeTypeDef Mode;
+	uint8_t              Count;
+	GLCD_RectTypeDef     Rect[_GLCD_SCREEN_LINES];
+	uint32_t             Cost; /* Estimated bytes on the wire */
+	uint8_t              Page; /* GDDRAM page of buffer line 0 (hidden half with _GLCD_PAGE_FLIP) */
+	
+}GLCD_PlanTypeDef;
+
+typedef struct
+{
+	
+	uint8_t Transaction; /* Bytes spent per transaction besides the payload */
+	uint8_t Byte;        /* Cost of one payload byte */
+	
+}GLCD_CostModelTypeDef;
+
+typedef struct /* Same layout as I2C_SegmentTypeDef / SPI_SegmentTypeDef */
+{
+	
+	const uint8_t *Data;
+	uint16_t       Size;
+	
+}GLCD_SegmentTypeDef;
+
+typedef struct
+{
+	
+	uint8_t             Control; /* _GLCD_CTRL_COMMAND / _GLCD_CTRL_DATA */
+	uint8_t             Count;   /* Segments in one transaction */
+	GLCD_SegmentTypeDef Segment[_GLCD_SCREEN_LINES];
+	
+}GLCD_TransferTypeDef;
+
+typedef struct /* GLCD Transport, the core only talks to the bus through it */
+{
+	
+	void    *Handle;   /* Given to every hook */
+	uint8_t  Overhead; /* Bytes per transaction besides the payload, 0 = keep cost model */
+	uint8_t  Stream;   /* Writes until Flush share one transaction */
+	
+	GLCD_StatusTypeDef (*WriteCommand)(void *handle, const uint8_t *commands, uint16_t size);
+	GLCD_StatusTypeDef (*WriteData)(void *handle, const uint8_t *data, uint16_t size);
+	GLCD_StatusTypeDef (*WriteDataV)(void *handle, const GLCD_SegmentTypeDef *segments, uint8_t count); /* Optional: page slices in one transaction */
+	GLCD_StatusTypeDef (*WriteAsync)(void *handle, uint8_t control, const uint8_t *data, uint16_t size);  /* Optional: ends with GLCD_DMA_TxCpltCallback */
+	uint8_t            (*AsyncDone)(void *handle, void *port); /* Optional: port belongs to this transport, called from the callbacks */
+	GLCD_StatusTypeDef (*Flush)(void *handle); /* Optional: end of a burst */
+	void               (*Init)(void *handle);  /* Optional: bus setup in GLCD_Init */
+	
+}GLCD_TransportTypeDef;
+
+typedef struct /* I2C bus of a display */
+{
+	
+	void    *Port;       /* STM32: I2C_HandleTypeDef, AVR: NULL */
+	uint8_t  DevAddress;
+	
+}GLCD_I2CBusTypeDef;
+
+typedef struct /* SPI bus of a display */
+{
+	
+	void       *Port;  /* STM32: SPI_HandleTypeDef, AVR: NULL */
+	const void *Lines; /* SPI_LinesTypeDef, AVR: NULL = pins in spi_unit_conf.h */
+	
+}GLCD_SPIBusTypeDef;
+
+typedef struct /* TCA9548A I2C multiplexer */
+{
+	
+	GLCD_I2CBusTypeDef Bus;     /* Bus and address of the mux */
+	uint8_t            Channel; /* Selected channel, _GLCD_MUX_UNKNOWN after an error */
+	uint32_t           Selects; /* Channel-select writes */
+	
+}GLCD_MuxTypeDef;
+
+typedef struct /* I2C bus of a display behind a mux */
+{
+	
+	GLCD_I2CBusTypeDef  Bus;     /* First, the I2C hooks take it as GLCD_I2CBusTypeDef */
+	GLCD_MuxTypeDef    *Mux;
+	uint8_t             Channel; /* 0 .. 7 */
+	
+}GLCD_MuxBusTypeDef;
+
+typedef struct
+{
+	
+	uint8_t  Rect;   /* Current plan rectangle */
+	uint8_t  Line;   /* Current page of the rectangle */
+	uint8_t  Setup;  /* Window/page commands are pending */
+	uint16_t Offset; /* Bytes already sent from the current run */
+	uint8_t  Gather; /* Max segments per transfer */
+	uint8_t  Window; /* First page of the window that was set */
+	uint8_t  Trial;  /* Failed tries of the current packet */
+	uint8_t  Command[_GLCD_PLAN_CMD_MAX];
+	
+}GLCD_CursorTypeDef;
+
+typedef void (*GLCD_RenderCallbackTypeDef)(GLCD_StatusTypeDef status);
+
+typedef struct
+{
+	
+	volatile uint8_t            Busy;    /* A render is on the bus */
+	volatile uint8_t            Pending; /* Render again when the current one ends */
+	volatile GLCD_StatusTypeDef Status;  /* Result of the last render */
+	GLCD_CursorTypeDef          Cursor;
+	GLCD_RenderCallbackTypeDef  Callback;
+	
+}GLCD_AsyncTypeDef;
+
+typedef struct
+{
+	
+	uint8_t            Active; /* A frame is being sent in steps */
+	GLCD_StatusTypeDef Status; /* Result of the last step */
+	GLCD_CursorTypeDef Cursor;
+	
+}GLCD_StepTypeDef;
+
 typedef struct
 {
 	
@@ -348,6 +992,124 @@ typedef struct
 	
 }GLCD_TypeDef;
 
+#ifdef _GLCD_PAGE_MODE
+typedef struct /* Draw calls of the frame, entries: op, pages, size, payload */
+{
+	
+	uint8_t              Arena[_GLCD_LIST_SIZE];
+	uint16_t             Used;
+	GLCD_ListModeTypeDef Mode;
+	uint8_t              Page;     /* Page in the buffer while rasterising */
+	uint8_t              Touched;  /* Pages written by the running op */
+	uint8_t              Drawn;    /* Pages any op writes */
+	uint8_t              Overflow; /* An op did not fit and is not drawn */
+	GLCD_FontTypeDef     Font;     /* Font of the last _GLCD_OP_FONT */
+	
+}GLCD_ListTypeDef;
+#endif /* _GLCD_PAGE_MODE */
+
+#ifdef _GLCD_DIRECT_TEXT
+typedef struct /* Glyph bytes of one page gathered for a single GLCD_DirectWrite */
+{
+	
+	uint8_t Open;  /* GLCD_BufferWrite stages instead of sending */
+	uint8_t X;     /* Column of the first staged byte */
+	uint8_t Line;
+	uint8_t Count;
+	uint8_t Data[_GLCD_GLYPH_STAGE];
+	
+}GLCD_RunTypeDef;
+#endif /* _GLCD_DIRECT_TEXT */
+
+typedef struct /* Circuit breaker of a display */
+{
+	
+	uint8_t  Fails;     /* Failed bursts in a row */
+	uint8_t  Open;      /* Renders are skipped, the display is probed */
+	uint16_t Countdown; /* GLCD_Render calls until the next probe */
+	
+}GLCD_BreakerTypeDef;
+
+typedef struct /* Controller registers as last sent, unknown ones are sent by their setter */
+{
+	
+	uint8_t          MemMode;   /* 0x20 */
+	GLCD_RectTypeDef Window;    /* 0x21/0x22, valid while the GDDRAM pointer is at its start */
+	uint16_t         Contrast;  /* 0x81 */
+	uint8_t          Display;   /* 0xAE / 0xAF */
+	uint8_t          Inverse;   /* 0xA6 / 0xA7 */
+	uint8_t          Scroll;    /* 0x2E / 0x2F */
+	uint8_t          StartLine; /* 0x40 | line */
+	uint8_t          Offset;    /* 0xD3 */
+	
+	#ifdef _GLCD_DIRECT_TEXT
+	uint8_t          Column;    /* 0x00 / 0x10, GDDRAM pointer of page addressing */
+	uint8_t          Page;      /* 0xB0 | page */
+	#endif /* _GLCD_DIRECT_TEXT */
+	
+}GLCD_ShadowTypeDef;
+
+typedef struct /* Init sequence of a panel, see __GLCD_PROFILE */
+{
+	
+	const uint8_t *Commands; /* Read with pgm_read_byte */
+	uint8_t        Size;
+	
+}GLCD_ProfileTypeDef;
+
+typedef struct /* Buffer composed onto the display while packets are built */
+{
+	
+	uint8_t         *Buffer; /* _GLCD_BUFFER_SIZE bytes, 4-byte aligned for the word kernel */
+	GLCD_RopTypeDef  Rop;
+	uint8_t          Invert; /* Layer is inverted before the ROP */
+	
+}GLCD_LayerTypeDef;
+
+typedef struct
+{
+	
+	GLCD_LayerTypeDef *Layer;  /* Overlays above Buffer, lowest first */
+	uint8_t            Count;
+	uint8_t           *Canvas; /* Buffer the drawing functions write, GLCD_DrawLayer */
+	
+}GLCD_LayerStackTypeDef;
+
+typedef struct /* Frames between the drawing code and the renderer */
+{
+	
+	uint8_t          *Frame[3];
+	volatile uint8_t  Ready; /* Published frame | _GLCD_TRIPLE_FRESH, changed by _GLCD_ATOMIC_XCHG only */
+	uint8_t           Draw;  /* Frame of the drawing functions (Buffer), owned by the producer */
+	uint8_t           Show;  /* Frame being sent, owned by the renderer */
+	
+	uint8_t           Start[3][_GLCD_SCREEN_LINES]; /* Drawn span of each frame, it goes with the frame when published */
+	uint8_t           End[3][_GLCD_SCREEN_LINES];
+	
+}GLCD_TripleTypeDef;
+
+typedef struct /* Panel of GLCD_RenderDisplays, GLCD_Select makes it current */
+{
+	
+	uint8_t                     *Buffer;    /* _GLCD_BUFFER_SIZE bytes */
+	GLCD_DirtyTypeDef            Dirty;
+	GLCD_TypeDef                 State;     /* GLCD while the display is not selected */
+	GLCD_ShadowTypeDef           Shadow;
+	const GLCD_TransportTypeDef *Transport;
+	uint8_t                      Group;     /* Displays of one group render together (mux channel) */
+	GLCD_BreakerTypeDef          Breaker;
+	const GLCD_ProfileTypeDef   *Profile;   /* Init sequence of GLCD_Init */
+	
+	#ifdef _GLCD_LAYERS
+	GLCD_LayerStackTypeDef       Layers;
+	#endif
+	
+	#ifdef _GLCD_TRIPLE_BUFFER
+	GLCD_TripleTypeDef           Triple;
+	#endif
+	
+}GLCD_DisplayTypeDef;
+
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Variables ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Enum ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Struct ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
@@ -355,16 +1117,71 @@ typedef struct
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Prototype ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 /* :::::::::::::::::: Transmition ::::::::::::::::: */
 void GLCD_TransmitCommand(uint8_t command);
+void GLCD_QueueCommand(const uint8_t command);
+void GLCD_QueueCommands(const uint8_t *commands, uint8_t quantity);
+GLCD_StatusTypeDef GLCD_FlushCommands(void);
 void GLCD_TransmitData(const uint8_t data);
 
 /* :::::::::::::::::: Initialize :::::::::::::::::: */
 void GLCD_Init(void);
+void GLCD_InitWarm(void);
+
+void GLCD_SetProfile(const GLCD_ProfileTypeDef *profile);
+GLCD_StatusTypeDef GLCD_ClearGDDRAM(void);
+
+void GLCD_SetTransport(const GLCD_TransportTypeDef *transport);
+const GLCD_TransportTypeDef *GLCD_GetTransport(void);
+
+void GLCD_InitDisplay(GLCD_DisplayTypeDef *display, uint8_t *buffer, const GLCD_TransportTypeDef *transport, const uint8_t group);
+void GLCD_Select(GLCD_DisplayTypeDef *display);
+GLCD_DisplayTypeDef *GLCD_GetDisplay(void);
+uint8_t *GLCD_DrawBuffer(void);
 
 /* :::::::::::::::::::: Control ::::::::::::::::::: */
 void GLCD_Render(void);
+GLCD_StatusTypeDef GLCD_RenderStep(const uint16_t budget);
+uint8_t GLCD_RenderDisplays(GLCD_DisplayTypeDef *const *displays, const uint8_t count);
+void GLCD_Invalidate(void);
+void GLCD_InvalidateRect(const uint8_t startX, const uint8_t startY, const uint8_t endX, const uint8_t endY);
+
+void GLCD_PlanRender(GLCD_PlanTypeDef *plan);
+const GLCD_PlanTypeDef *GLCD_GetPlan(void);
+void GLCD_SetCostModel(const uint8_t transaction, const uint8_t byte);
+
+void GLCD_SetPacketSize(const uint16_t size);
+uint16_t GLCD_GetPacketSize(void);
+
+#ifdef _GLCD_GET_TICK
+uint16_t GLCD_CalibratePacketSize(uint32_t *rates);
+#endif /* _GLCD_GET_TICK */
+
+#ifdef _GLCD_USE_DMA
+GLCD_StatusTypeDef GLCD_RenderAsync(void);
+uint8_t GLCD_IsBusy(void);
+void GLCD_SetRenderCallback(GLCD_RenderCallbackTypeDef callback);
+void GLCD_DMA_TxCpltCallback(void *port);
+void GLCD_DMA_ErrorCallback(void *port);
+#endif /* _GLCD_USE_DMA */
+
+#ifdef _GLCD_PAGE_MODE
+uint16_t GLCD_GetListUsed(void);
+#endif /* _GLCD_PAGE_MODE */
+
+#ifdef _GLCD_LAYERS
+void GLCD_SetLayers(GLCD_LayerTypeDef *layers, const uint8_t count);
+void GLCD_DrawLayer(const uint8_t layer);
+#endif /* _GLCD_LAYERS */
+
+#ifdef _GLCD_TRIPLE_BUFFER
+void GLCD_SetFrames(uint8_t *second, uint8_t *third);
+void GLCD_Publish(void);
+#endif /* _GLCD_TRIPLE_BUFFER */
 
 void GLCD_SetDisplay(const uint8_t on);
 void GLCD_SetContrast(const uint8_t contrast);
+void GLCD_SetStartLine(const uint8_t line);
+void GLCD_SetDisplayOffset(const uint8_t offset);
+void GLCD_InvalidateShadow(void);
 
 void GLCD_Clear(void);
 void GLCD_ClearLine(const uint8_t line);
@@ -421,6 +1238,71 @@ void GLCD_ScrollStop(void);
 /* ::::::::::::::::::::: Font ::::::::::::::::::::: */
 void GLCD_SetFont(const uint8_t *name, const uint8_t width, const uint8_t height, GLCD_PrintModeTypeDef mode);
 
+/* :::::::::::::::::::: Profile ::::::::::::::::::: */
+extern const GLCD_ProfileTypeDef GLCD_Profile_Default;     /* Charge pump, sizes of _GLCD_SIZE */
+extern const GLCD_ProfileTypeDef GLCD_Profile_ExternalVcc; /* VCC from the board, charge pump off */
+extern const GLCD_ProfileTypeDef GLCD_Profile_Rotated;     /* Default turned by 180 degrees */
+
+/* ::::::::::::::::::: Transport :::::::::::::::::: */
+/* Built-in transports, ssd1306_transport.c */
+#ifdef _GLCD_TRANSPORT_CUSTOM
+
+#define _GLCD_TRANSPORT_DEFAULT NULL /* GLCD_SetTransport before GLCD_Init */
+
+#elif defined(_GLCD_USE_SPI)
+
+extern GLCD_SPIBusTypeDef GLCD_SPI_Bus;
+extern const GLCD_TransportTypeDef GLCD_Transport_SPI;
+
+#define _GLCD_TRANSPORT_DEFAULT (&GLCD_Transport_SPI)
+
+GLCD_StatusTypeDef GLCD_SPI_WriteCommand(void *handle, const uint8_t *commands, uint16_t size);
+GLCD_StatusTypeDef GLCD_SPI_WriteData(void *handle, const uint8_t *data, uint16_t size);
+GLCD_StatusTypeDef GLCD_SPI_WriteDataV(void *handle, const GLCD_SegmentTypeDef *segments, uint8_t count);
+GLCD_StatusTypeDef GLCD_SPI_WriteAsync(void *handle, uint8_t control, const uint8_t *data, uint16_t size);
+uint8_t GLCD_SPI_AsyncDone(void *handle, void *port);
+void GLCD_SPI_Init(void *handle);
+
+/* More panels on the bus, handle is a GLCD_SPIBusTypeDef with the port and lines of the panel */
+#ifdef _GLCD_USE_DMA
+#define _GLCD_SPI_TRANSPORT(bus) {(bus), _GLCD_COST_TRANSACTION, 0, GLCD_SPI_WriteCommand, GLCD_SPI_WriteData, GLCD_SPI_WriteDataV, GLCD_SPI_WriteAsync, GLCD_SPI_AsyncDone, NULL, GLCD_SPI_Init}
+#else
+#define _GLCD_SPI_TRANSPORT(bus) {(bus), _GLCD_COST_TRANSACTION, 0, GLCD_SPI_WriteCommand, GLCD_SPI_WriteData, GLCD_SPI_WriteDataV, NULL, NULL, NULL, GLCD_SPI_Init}
+#endif /* _GLCD_USE_DMA */
+
+#else
+
+extern GLCD_I2CBusTypeDef GLCD_I2C_Bus;
+extern const GLCD_TransportTypeDef GLCD_Transport_I2C;
+
+#define _GLCD_TRANSPORT_DEFAULT (&GLCD_Transport_I2C)
+
+GLCD_StatusTypeDef GLCD_I2C_WriteCommand(void *handle, const uint8_t *commands, uint16_t size);
+GLCD_StatusTypeDef GLCD_I2C_WriteData(void *handle, const uint8_t *data, uint16_t size);
+GLCD_StatusTypeDef GLCD_I2C_WriteDataV(void *handle, const GLCD_SegmentTypeDef *segments, uint8_t count);
+GLCD_StatusTypeDef GLCD_I2C_WriteAsync(void *handle, uint8_t control, const uint8_t *data, uint16_t size);
+uint8_t GLCD_I2C_AsyncDone(void *handle, void *port);
+GLCD_StatusTypeDef GLCD_I2C_Flush(void *handle);
+void GLCD_I2C_Init(void *handle);
+
+/* Display behind a TCA9548A, handle is a GLCD_MuxBusTypeDef */
+#if (_GLCD_GATHER == 1)
+#define _GLCD_MUX_TRANSPORT(bus) {(bus), _GLCD_COST_TRANSACTION, _GLCD_STREAM, GLCD_Mux_WriteCommand, GLCD_Mux_WriteData, GLCD_Mux_WriteDataV, NULL, NULL, GLCD_Mux_Flush, GLCD_I2C_Init}
+#else
+#define _GLCD_MUX_TRANSPORT(bus) {(bus), _GLCD_COST_TRANSACTION, _GLCD_STREAM, GLCD_Mux_WriteCommand, GLCD_Mux_WriteData, NULL, NULL, NULL, GLCD_Mux_Flush, GLCD_I2C_Init}
+#endif /* _GLCD_GATHER */
+
+#define _GLCD_MUX(port,address)  {{(port), (address)}, _GLCD_MUX_UNKNOWN, 0} /* Channel is selected by the first write */
+
+#define __GLCD_MUX_GROUP(bus)    (((((bus)->Mux->Bus.DevAddress >> 1) & 0x07) << 3) | (bus)->Channel) /* Group of GLCD_InitDisplay */
+
+GLCD_StatusTypeDef GLCD_Mux_WriteCommand(void *handle, const uint8_t *commands, uint16_t size);
+GLCD_StatusTypeDef GLCD_Mux_WriteData(void *handle, const uint8_t *data, uint16_t size);
+GLCD_StatusTypeDef GLCD_Mux_WriteDataV(void *handle, const GLCD_SegmentTypeDef *segments, uint8_t count);
+GLCD_StatusTypeDef GLCD_Mux_Flush(void *handle);
+
+#endif /* _GLCD_TRANSPORT_CUSTOM */
+
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ End of the program ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #endif /* __SSD1306_H_ */
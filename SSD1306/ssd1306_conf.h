@@ -28,12 +28,136 @@
 /* Driver-library for STM32 */
 #include "stm32_i2c.h"
 
+/* Driver-library for Linux (i2c-dev) */
+//#include "linux_i2c.h"
+
 /* ~~~~~~~~~~~~~~~~ SSD1306 I2C ~~~~~~~~~~~~~~~~ */
 #define _SSD1306_I2C hi2c1
 
+/* Linux: _SSD1306_I2C is a LINUX_I2C_HandleTypeDef, call LINUX_I2C_Open
+   before GLCD_Init. A render is sent as one I2C_RDWR */
+//#define _GLCD_USE_LINUX_I2C
+
+/* Displays behind a TCA9548A need no define: a GLCD_MuxTypeDef from _GLCD_MUX
+   per mux, a GLCD_MuxBusTypeDef and a transport from _GLCD_MUX_TRANSPORT per display,
+   GLCD_InitDisplay with __GLCD_MUX_GROUP, then GLCD_RenderDisplays */
+
+/* ~~~~~~~~~~~~~~~~ SSD1306 SPI ~~~~~~~~~~~~~~~~ */
+/* 4-wire SPI instead of I2C, include "spi_unit.h" (AVR, pins in
+   spi_unit_conf.h, call SPI_Init before GLCD_Init) or "stm32_spi.h" above.
+   More panels: a GLCD_SPIBusTypeDef with their own lines (SPI_LinesTypeDef)
+   and a transport from _GLCD_SPI_TRANSPORT per display */
+//#define _GLCD_USE_SPI
+
+/* STM32 handle and lines, CS and RST are optional */
+//#define _SSD1306_SPI      hspi1
+//#define _SSD1306_DC_PORT  GPIOA
+//#define _SSD1306_DC_PIN   GPIO_PIN_1
+//#define _SSD1306_CS_PORT  GPIOA
+//#define _SSD1306_CS_PIN   GPIO_PIN_2
+//#define _SSD1306_RST_PORT GPIOA
+//#define _SSD1306_RST_PIN  GPIO_PIN_3
+
+/* ~~~~~~~~~~~~~~~~~ Transport ~~~~~~~~~~~~~~~~~ */
+/* Own bus code, no driver-library is included and ssd1306_transport.c
+   is empty. Fill a GLCD_TransportTypeDef and call GLCD_SetTransport
+   before GLCD_Init */
+//#define _GLCD_TRANSPORT_CUSTOM
+
 /* ~~~~~~~~~~~~~~~~~ GLCD Size ~~~~~~~~~~~~~~~~~ */
 #define _GLCD_SIZE _GLCD_SIZE_128x64
 
+/* ~~~~~~~~~~~~~~~~ Packet Size ~~~~~~~~~~~~~~~~ */
+/* Bytes per data transaction, 0 = whole run in one transaction */
+//#define _GLCD_PACKET_SIZE 16
+
+/* Millisecond tick for GLCD_CalibratePacketSize (AVR) */
+//#define _GLCD_GET_TICK() millis()
+
+/* ~~~~~~~~~~~~~~~ Vectored Write ~~~~~~~~~~~~~~ */
+/* STM32: send multi-page windows in one transaction with
+   HAL_I2C_Mem_WriteV (I2C event/error interrupts must be enabled) */
+//#define _GLCD_USE_WRITEV
+
+/* ~~~~~~~~~~~~~~~ Trusted Device ~~~~~~~~~~~~~~ */
+/* AVR: probe the display once and again only after an error */
+//#define _GLCD_TRUSTED_DEVICE
+
+/* ~~~~~~~~~~~~~~~~~ DMA Render ~~~~~~~~~~~~~~~~ */
+/* GLCD_RenderAsync (STM32), call GLCD_DMA_TxCpltCallback from
+   HAL_I2C_MemTxCpltCallback and GLCD_DMA_ErrorCallback from HAL_I2C_ErrorCallback
+   (SPI: HAL_SPI_TxCpltCallback / HAL_SPI_ErrorCallback). While it runs, the
+   other render, init and selection calls return _GLCD_BUSY instead of waiting,
+   and the render callback must not call them */
+//#define _GLCD_USE_DMA
+
+/* ~~~~~~~~~~~~~~~ Fault Handling ~~~~~~~~~~~~~~ */
+/* Resends of a failed packet, failed bursts in a row before the display
+   is taken offline, and GLCD_Render calls between probes while offline
+   (GLCD_Status is _GLCD_OFFLINE, GLCD_Init and a full frame follow a
+   successful probe) */
+//#define _GLCD_RETRIES        2
+//#define _GLCD_BREAKER_FAILS  3
+//#define _GLCD_PROBE_INTERVAL 32
+
+/* ~~~~~~~~~~~~~~~~~~ Panel Init ~~~~~~~~~~~~~~~~ */
+/* GLCD_SetProfile selects the init table (GLCD_Profile_Default,
+   GLCD_Profile_ExternalVcc, GLCD_Profile_Rotated or one made with
+   __GLCD_PROFILE), GLCD_InitWarm skips it when the panel kept power.
+   _GLCD_INIT_CLEAR zeros GDDRAM before 0xAF, without GLCD_Buffer */
+//#define _GLCD_INIT_CLEAR
+//#define _GLCD_CLEAR_BLOCK 16
+
+/* ~~~~~~~~~~~~~~~~~~ Page Hash ~~~~~~~~~~~~~~~~~ */
+/* Hash each page at render time so writes straight into GLCD_Buffer
+   (or a display's Buffer) are sent too, a changed page is sent whole.
+   _GLCD_HASH_SEGMENTS 2/4/8 hashes narrower spans, 4 bytes RAM each */
+//#define _GLCD_PAGE_HASH
+//#define _GLCD_HASH_SEGMENTS 1
+
+/* ~~~~~~~~~~~~~~~~~~ Page Flip ~~~~~~~~~~~~~~~~~ */
+/* 128x32 and 96x16 only: frames are rendered to the GDDRAM half that is
+   not shown and a single start line command (0x40|n) flips to it, so a
+   half sent frame is never visible. The start line belongs to the flip,
+   do not use GLCD_SetStartLine with it */
+//#define _GLCD_PAGE_FLIP
+
+/* ~~~~~~~~~~~~~~~~~~~~ Layers ~~~~~~~~~~~~~~~~~~~ */
+/* GLCD_SetLayers combines overlay buffers (OR, AND-NOT, XOR, optional
+   invert) with the display buffer while each packet is built, in a
+   _GLCD_LAYER_STAGE byte stage (at least one page) instead of a frame.
+   GLCD_DrawLayer picks the buffer the drawing functions write */
+//#define _GLCD_LAYERS
+//#define _GLCD_LAYER_STAGE 128
+
+/* ~~~~~~~~~~~~~~~~~~ Page Mode ~~~~~~~~~~~~~~~~~~ */
+/* No frame buffer: drawing calls of the selected display are recorded
+   in a _GLCD_LIST_SIZE byte list and rasterised into a one page buffer
+   per dirty page at render. GLCD_Clear starts the list over; bitmaps
+   and flash strings are kept by pointer and must outlive it */
+//#define _GLCD_PAGE_MODE
+//#define _GLCD_LIST_SIZE 256
+
+/* ~~~~~~~~~~~~~~~~~ Direct Text ~~~~~~~~~~~~~~~~~ */
+/* No buffer at all: every write goes straight to GDDRAM at the cursor.
+   Page aligned text (GLCD.Y multiple of 8) sends only the glyph columns,
+   clear and fill stream _GLCD_CLEAR_BLOCK blocks. GDDRAM is not read
+   back, so merge mode and graphics overwrite what is under them.
+   GLCD_Render sends nothing; redraw after a display recovery */
+//#define _GLCD_DIRECT_TEXT
+//#define _GLCD_GLYPH_STAGE 16
+
+/* ~~~~~~~~~~~~~~~~ Triple Buffer ~~~~~~~~~~~~~~~~ */
+/* Drawing goes to its own frame while the renderer (DMA, ISR or another
+   thread) sends another one; GLCD_Publish hands the drawn frame over
+   with one atomic exchange and the renderer takes the latest at the
+   start of a frame, older ones are dropped. Two more frames of RAM,
+   turns on _GLCD_PAGE_HASH. GCC builtins are used by default, define
+   both macros on other compilers or on Cortex-M0 (interrupts off) */
+//#define _GLCD_TRIPLE_BUFFER
+//#define _GLCD_ATOMIC_XCHG(ptr, value) My_Xchg8((ptr), (value))
+//#define _GLCD_ATOMIC_LOAD(ptr) (*(ptr))
+
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #endif /* __SSD1306_CONF_H_ */
@@ -0,0 +1,489 @@
+/*
+------------------------------------------------------------------------------
+~ File   : ssd1306_transport.c
+~ Author : agent
+~ Version: V1.0.0
+~ Created: 10/17/2026 09:00:00 AM
+~ Brief  :
+~ Support:
+		   E-Mail : Majid.do16@gmail.com (subject : Embedded Library Support)
+
+		   Github : https://github.com/Majid-Derhambakhsh
+------------------------------------------------------------------------------
+~ Description:    Built-in transports of the GLCD core: I2C (i2c_unit /
+				  stm32_i2c) or 4-wire SPI (spi_unit / stm32_spi).
+
+~ Attention  :    Not needed with _GLCD_TRANSPORT_CUSTOM, give the core a
+				  GLCD_TransportTypeDef with GLCD_SetTransport instead.
+
+~ Changes    :
+				  Add : GLCD_Transport_I2C      transport of i2c_unit / stm32_i2c / linux_i2c.
+				  Add : GLCD_Transport_SPI      transport of spi_unit / stm32_spi (_GLCD_USE_SPI).
+				  Add : GLCD_Mux_xxx            hooks for displays behind a TCA9548A.
+------------------------------------------------------------------------------
+*/
+
+#include "ssd1306.h"
+
+#ifndef _GLCD_TRANSPORT_CUSTOM
+
+#ifdef _GLCD_USE_SPI
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Variables ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#ifdef USE_HAL_DRIVER
+static const SPI_LinesTypeDef GLCD_SPI_Lines =
+{
+	_SSD1306_DC_PORT, _SSD1306_DC_PIN,
+	#ifdef _SSD1306_CS_PORT
+	_SSD1306_CS_PORT, _SSD1306_CS_PIN,
+	#else
+	NULL, 0,
+	#endif /* _SSD1306_CS_PORT */
+	#ifdef _SSD1306_RST_PORT
+	_SSD1306_RST_PORT, _SSD1306_RST_PIN
+	#else
+	NULL, 0
+	#endif /* _SSD1306_RST_PORT */
+};
+
+GLCD_SPIBusTypeDef GLCD_SPI_Bus = {&_SSD1306_SPI, &GLCD_SPI_Lines};
+#else
+GLCD_SPIBusTypeDef GLCD_SPI_Bus = {NULL, NULL};
+#endif /* USE_HAL_DRIVER */
+
+const GLCD_TransportTypeDef GLCD_Transport_SPI =
+{
+	&GLCD_SPI_Bus, _GLCD_COST_TRANSACTION, 0,
+	GLCD_SPI_WriteCommand,
+	GLCD_SPI_WriteData,
+	GLCD_SPI_WriteDataV,
+	#ifdef _GLCD_USE_DMA
+	GLCD_SPI_WriteAsync,
+	GLCD_SPI_AsyncDone,
+	#else
+	NULL,
+	NULL,
+	#endif /* _GLCD_USE_DMA */
+	NULL,
+	GLCD_SPI_Init
+};
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Functions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+GLCD_StatusTypeDef GLCD_SPI_WriteCommand(void *handle, const uint8_t *commands, uint16_t size)
+{
+	
+	if (_I2C_MEM_WRITE((GLCD_SPIBusTypeDef *)handle, _GLCD_CTRL_COMMAND, I2C_MEMADD_SIZE_8BIT, (uint8_t *)commands, size, _GLCD_COM_TIMEOUT_MS) != _OK_VAL)
+	{
+		return _GLCD_ERROR;
+	}
+	
+	return _GLCD_OK;
+	
+}
+
+GLCD_StatusTypeDef GLCD_SPI_WriteData(void *handle, const uint8_t *data, uint16_t size)
+{
+	
+	if (_I2C_MEM_WRITE((GLCD_SPIBusTypeDef *)handle, _GLCD_CTRL_DATA, I2C_MEMADD_SIZE_8BIT, (uint8_t *)data, size, _GLCD_COM_TIMEOUT_MS) != _OK_VAL)
+	{
+		return _GLCD_ERROR;
+	}
+	
+	return _GLCD_OK;
+	
+}
+
+GLCD_StatusTypeDef GLCD_SPI_WriteDataV(void *handle, const GLCD_SegmentTypeDef *segments, uint8_t count)
+{
+	
+	/* ~~~~~~~~~~~~~~~~~~ Page slices under one CS ~~~~~~~~~~~~~~~~~~ */
+	if (_I2C_MEM_WRITEV((GLCD_SPIBusTypeDef *)handle, _GLCD_CTRL_DATA, I2C_MEMADD_SIZE_8BIT, segments, count, _GLCD_COM_TIMEOUT_MS) != _OK_VAL)
+	{
+		return _GLCD_ERROR;
+	}
+	
+	return _GLCD_OK;
+	
+}
+
+#ifdef _GLCD_USE_DMA
+GLCD_StatusTypeDef GLCD_SPI_WriteAsync(void *handle, uint8_t control, const uint8_t *data, uint16_t size)
+{
+	
+	if (_I2C_MEM_WRITE_DMA((GLCD_SPIBusTypeDef *)handle, control, I2C_MEMADD_SIZE_8BIT, (uint8_t *)data, size) != _OK_VAL)
+	{
+		return _GLCD_ERROR;
+	}
+	
+	return _GLCD_OK;
+	
+}
+
+uint8_t GLCD_SPI_AsyncDone(void *handle, void *port)
+{
+	
+	GLCD_SPIBusTypeDef *bus = (GLCD_SPIBusTypeDef *)handle;
+	
+	if (bus->Port != port)
+	{
+		return 0;
+	}
+	
+	_GLCD_BUS_RELEASE(bus); // CS high
+	
+	return 1;
+	
+}
+#endif /* _GLCD_USE_DMA */
+
+void GLCD_SPI_Init(void *handle)
+{
+	_GLCD_BUS_RESET((GLCD_SPIBusTypeDef *)handle); // RESET pulse, no effect without a RESET line
+}
+
+#else
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Variables ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#ifdef _GLCD_USE_LINUX_I2C
+extern LINUX_I2C_HandleTypeDef _SSD1306_I2C; /* Opened by the application */
+#endif /* _GLCD_USE_LINUX_I2C */
+
+#if defined(USE_HAL_DRIVER) || defined(_GLCD_USE_LINUX_I2C)
+GLCD_I2CBusTypeDef GLCD_I2C_Bus = {&_SSD1306_I2C, _GLCD_DEV_ADDRESS};
+#else
+GLCD_I2CBusTypeDef GLCD_I2C_Bus = {NULL, _GLCD_DEV_ADDRESS};
+#endif /* USE_HAL_DRIVER */
+
+#if (_GLCD_STREAM == 1)
+static GLCD_I2CBusTypeDef *GLCD_I2C_Open = NULL; /* Bus of the open session */
+static uint8_t             GLCD_I2C_Control;      /* Control byte of the open session */
+#endif /* _GLCD_STREAM */
+
+const GLCD_TransportTypeDef GLCD_Transport_I2C =
+{
+	&GLCD_I2C_Bus, _GLCD_COST_TRANSACTION, _GLCD_STREAM,
+	GLCD_I2C_WriteCommand,
+	GLCD_I2C_WriteData,
+	#if (_GLCD_GATHER == 1)
+	GLCD_I2C_WriteDataV,
+	#else
+	NULL,
+	#endif /* _GLCD_GATHER */
+	#ifdef _GLCD_USE_DMA
+	GLCD_I2C_WriteAsync,
+	GLCD_I2C_AsyncDone,
+	#else
+	NULL,
+	NULL,
+	#endif /* _GLCD_USE_DMA */
+	GLCD_I2C_Flush,
+	GLCD_I2C_Init
+};
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Prototypes ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+static GLCD_StatusTypeDef GLCD_I2C_Write(GLCD_I2CBusTypeDef *bus, const uint8_t control, const uint8_t *data, uint16_t size);
+static GLCD_StatusTypeDef GLCD_Mux_Select(GLCD_MuxBusTypeDef *bus);
+#if (_GLCD_STREAM == 1)
+static GLCD_StatusTypeDef GLCD_I2C_Close(void);
+#endif /* _GLCD_STREAM */
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Functions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+GLCD_StatusTypeDef GLCD_I2C_WriteCommand(void *handle, const uint8_t *commands, uint16_t size)
+{
+	return GLCD_I2C_Write((GLCD_I2CBusTypeDef *)handle, _GLCD_CTRL_COMMAND, commands, size);
+}
+
+GLCD_StatusTypeDef GLCD_I2C_WriteData(void *handle, const uint8_t *data, uint16_t size)
+{
+	return GLCD_I2C_Write((GLCD_I2CBusTypeDef *)handle, _GLCD_CTRL_DATA, data, size);
+}
+
+GLCD_StatusTypeDef GLCD_I2C_WriteDataV(void *handle, const GLCD_SegmentTypeDef *segments, uint8_t count)
+{
+	
+	GLCD_StatusTypeDef status = _GLCD_OK;
+	
+	#if (_GLCD_STREAM == 0) && defined(_I2C_MEM_WRITEV)
+	
+	/* ~~~~~~~~~~~~~~~~~~ Page slices in one transaction ~~~~~~~~~~~~~~~~~~ */
+	if (_I2C_MEM_WRITEV((GLCD_I2CBusTypeDef *)handle, _GLCD_CTRL_DATA, I2C_MEMADD_SIZE_8BIT, segments, count, _GLCD_COM_TIMEOUT_MS) != _OK_VAL)
+	{
+		status = _GLCD_ERROR;
+	}
+	
+	#else
+	
+	/* ~~~~~~~~~~~~~~~~~ Session keeps the slices together ~~~~~~~~~~~~~~~~~ */
+	for (; count > 0; count--)
+	{
+		
+		if (GLCD_I2C_Write((GLCD_I2CBusTypeDef *)handle, _GLCD_CTRL_DATA, segments->Data, segments->Size) != _GLCD_OK)
+		{
+			status = _GLCD_ERROR;
+		}
+		
+		segments++;
+		
+	}
+	
+	#endif /* _GLCD_STREAM */
+	
+	return status;
+	
+}
+
+#ifdef _GLCD_USE_DMA
+GLCD_StatusTypeDef GLCD_I2C_WriteAsync(void *handle, uint8_t control, const uint8_t *data, uint16_t size)
+{
+	
+	if (_I2C_MEM_WRITE_DMA((GLCD_I2CBusTypeDef *)handle, control, I2C_MEMADD_SIZE_8BIT, (uint8_t *)data, size) != _OK_VAL)
+	{
+		return _GLCD_ERROR;
+	}
+	
+	return _GLCD_OK;
+	
+}
+
+uint8_t GLCD_I2C_AsyncDone(void *handle, void *port)
+{
+	return (((GLCD_I2CBusTypeDef *)handle)->Port == port);
+}
+#endif /* _GLCD_USE_DMA */
+
+GLCD_StatusTypeDef GLCD_I2C_Flush(void *handle)
+{
+	
+	GLCD_StatusTypeDef status = _GLCD_OK;
+	
+	#if (_GLCD_STREAM == 1)
+	
+	status = GLCD_I2C_Close();
+	
+	#ifdef _I2C_SESSION_FLUSH
+	
+	/* ~~~~~~~~~~~~~~~~ Queued messages in one combined transfer ~~~~~~~~~~~~~~~~ */
+	if (_I2C_SESSION_FLUSH((GLCD_I2CBusTypeDef *)handle, _GLCD_COM_TIMEOUT_MS) != _OK_VAL)
+	{
+		status = _GLCD_ERROR;
+	}
+	
+	#endif /* _I2C_SESSION_FLUSH */
+	
+	#endif /* _GLCD_STREAM */
+	
+	#ifdef _I2C_MEM_WAIT
+	
+	/* ~~~~~~~~~~~~~~~ Interrupt mode: writes of the burst are only queued ~~~~~~~~~~~~~~~ */
+	if (_I2C_MEM_WAIT((GLCD_I2CBusTypeDef *)handle, _GLCD_COM_TIMEOUT_MS) != _OK_VAL)
+	{
+		status = _GLCD_ERROR;
+	}
+	
+	#endif /* _I2C_MEM_WAIT */
+	
+	(void)handle;
+	
+	return status;
+	
+}
+
+void GLCD_I2C_Init(void *handle)
+{
+	
+	#if defined(_GLCD_TRUSTED_DEVICE) && !defined(USE_HAL_DRIVER)
+	I2C_SetTrustedDevice(((GLCD_I2CBusTypeDef *)handle)->DevAddress, _TRUE); // Probe once, again after an error
+	#endif /* _GLCD_TRUSTED_DEVICE */
+	
+	(void)handle;
+	
+}
+
+GLCD_StatusTypeDef GLCD_Mux_WriteCommand(void *handle, const uint8_t *commands, uint16_t size)
+{
+	
+	GLCD_MuxBusTypeDef *bus = (GLCD_MuxBusTypeDef *)handle;
+	
+	if (GLCD_Mux_Select(bus) != _GLCD_OK)
+	{
+		return _GLCD_ERROR;
+	}
+	
+	if (GLCD_I2C_WriteCommand(handle, commands, size) != _GLCD_OK)
+	{
+		
+		bus->Mux->Channel = _GLCD_MUX_UNKNOWN; // A NACK may be the mux losing the channel
+		
+		return _GLCD_ERROR;
+		
+	}
+	
+	return _GLCD_OK;
+	
+}
+
+GLCD_StatusTypeDef GLCD_Mux_WriteData(void *handle, const uint8_t *data, uint16_t size)
+{
+	
+	GLCD_MuxBusTypeDef *bus = (GLCD_MuxBusTypeDef *)handle;
+	
+	if (GLCD_Mux_Select(bus) != _GLCD_OK)
+	{
+		return _GLCD_ERROR;
+	}
+	
+	if (GLCD_I2C_WriteData(handle, data, size) != _GLCD_OK)
+	{
+		
+		bus->Mux->Channel = _GLCD_MUX_UNKNOWN; // A NACK may be the mux losing the channel
+		
+		return _GLCD_ERROR;
+		
+	}
+	
+	return _GLCD_OK;
+	
+}
+
+GLCD_StatusTypeDef GLCD_Mux_WriteDataV(void *handle, const GLCD_SegmentTypeDef *segments, uint8_t count)
+{
+	
+	GLCD_MuxBusTypeDef *bus = (GLCD_MuxBusTypeDef *)handle;
+	
+	if (GLCD_Mux_Select(bus) != _GLCD_OK)
+	{
+		return _GLCD_ERROR;
+	}
+	
+	if (GLCD_I2C_WriteDataV(handle, segments, count) != _GLCD_OK)
+	{
+		
+		bus->Mux->Channel = _GLCD_MUX_UNKNOWN; // A NACK may be the mux losing the channel
+		
+		return _GLCD_ERROR;
+		
+	}
+	
+	return _GLCD_OK;
+	
+}
+
+GLCD_StatusTypeDef GLCD_Mux_Flush(void *handle)
+{
+	
+	GLCD_MuxBusTypeDef *bus = (GLCD_MuxBusTypeDef *)handle;
+	
+	if (GLCD_I2C_Flush(handle) != _GLCD_OK)
+	{
+		
+		bus->Mux->Channel = _GLCD_MUX_UNKNOWN; // The select may not have reached the mux
+		
+		return _GLCD_ERROR;
+		
+	}
+	
+	return _GLCD_OK;
+	
+}
+
+static GLCD_StatusTypeDef GLCD_I2C_Write(GLCD_I2CBusTypeDef *bus, const uint8_t control, const uint8_t *data, uint16_t size)
+{
+	
+	GLCD_StatusTypeDef status = _GLCD_OK;
+	
+	#if (_GLCD_STREAM == 1)
+	
+	/* ~~~~~~~ Same device and control byte continue the open session ~~~~~~~ */
+	if ((GLCD_I2C_Open != bus) || (GLCD_I2C_Control != control))
+	{
+		
+		status           = GLCD_I2C_Close();
+		GLCD_I2C_Open    = bus;
+		GLCD_I2C_Control = control;
+		
+		if (_I2C_SESSION_BEGIN(bus, control, I2C_MEMADD_SIZE_8BIT, _GLCD_COM_TIMEOUT_MS) != _OK_VAL)
+		{
+			status = _GLCD_ERROR;
+		}
+		
+	}
+	
+	if (_I2C_SESSION_WRITE(bus, data, size, _GLCD_COM_TIMEOUT_MS) != _OK_VAL)
+	{
+		status = _GLCD_ERROR;
+	}
+	
+	#else
+	
+	if (_I2C_MEM_WRITE(bus, control, I2C_MEMADD_SIZE_8BIT, (uint8_t *)data, size, _GLCD_COM_TIMEOUT_MS) != _OK_VAL)
+	{
+		status = _GLCD_ERROR;
+	}
+	
+	#endif /* _GLCD_STREAM */
+	
+	return status;
+	
+}
+
+static GLCD_StatusTypeDef GLCD_Mux_Select(GLCD_MuxBusTypeDef *bus)
+{
+	
+	GLCD_MuxTypeDef *mux  = bus->Mux;
+	uint8_t          mask = (uint8_t)(1 << bus->Channel);
+	
+	/* ~~~~~~~~~~~~~~~~~~~ Channel is still selected ~~~~~~~~~~~~~~~~~~~ */
+	if (mux->Channel == bus->Channel)
+	{
+		return _GLCD_OK;
+	}
+	
+	mux->Channel = _GLCD_MUX_UNKNOWN;
+	mux->Selects++;
+	
+	/* The TCA9548A takes every byte as its control register, a mem write
+	   sends the mask twice. The channel switches at STOP, so the select is
+	   flushed before the display is addressed. */
+	if (GLCD_I2C_Write(&mux->Bus, mask, &mask, 1) != _GLCD_OK)
+	{
+		return _GLCD_ERROR;
+	}
+	
+	if (GLCD_I2C_Flush(&mux->Bus) != _GLCD_OK)
+	{
+		return _GLCD_ERROR;
+	}
+	
+	mux->Channel = bus->Channel;
+	
+	return _GLCD_OK;
+	
+}
+
+#if (_GLCD_STREAM == 1)
+static GLCD_StatusTypeDef GLCD_I2C_Close(void)
+{
+	
+	GLCD_I2CBusTypeDef *bus = GLCD_I2C_Open;
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~ STOP ~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	if (bus == NULL)
+	{
+		return _GLCD_OK;
+	}
+	
+	GLCD_I2C_Open = NULL;
+	
+	if (_I2C_SESSION_END(bus, _GLCD_COM_TIMEOUT_MS) != _OK_VAL)
+	{
+		return _GLCD_ERROR;
+	}
+	
+	return _GLCD_OK;
+	
+}
+#endif /* _GLCD_STREAM */
+
+#endif /* _GLCD_USE_SPI */
+
+#endif /* _GLCD_TRANSPORT_CUSTOM */
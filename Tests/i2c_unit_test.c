@@ -0,0 +1,274 @@
+/*
+------------------------------------------------------------------------------
+  File   : i2c_unit_test.c
+  Author : agent
+  Version: V0.1.0
+  Created: 10/17/2026 09:00:00 AM
+  Brief  :
+  Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+  Description:    Host test of the TWI interrupt state machine of i2c_unit
+				  against the simulated registers of i2c_unit_sim.h.
+				
+  Attention  :    Build and run from the repository root:
+				
+				  gcc -std=gnu99 -Wall -Wextra -D_I2C_HOST_SIM -D_I2C_SIM_BUS
+					  -D_I2C_INTERRUPT_MODE -ISSD1306/I2C_UNIT
+					  SSD1306/I2C_UNIT/i2c_unit.c Tests/i2c_unit_test.c
+					  -o i2c_unit_test && ./i2c_unit_test
+					
+				  I2C_SimBus plays the slave: it acknowledges every byte
+				  except the one selected in Slave.NackTransfer/NackByte.
+				
+  Changes    :
+------------------------------------------------------------------------------
+*/
+
+#include <stdio.h>
+#include "i2c_unit.h"
+
+/* ------------------ Defines -------------------- */
+
+#define _TEST_LOG_SIZE  64
+#define _TEST_NO_NACK   0xFF
+#define _TEST_START     0x100 /* START in the log */
+#define _TEST_STOP      0x200 /* STOP in the log */
+
+#define __TEST_CHECK(cond)  Test_Check((cond) , #cond , __LINE__)
+
+/* ------------------- Struct -------------------- */
+
+typedef struct /* Simulated slave and bus log */
+{
+	
+	uint8_t  NackTransfer; /* Transfer of the NACK, counted from 0 */
+	uint8_t  NackByte;     /* Byte of the NACK, 0 = SLA+W */
+	uint8_t  Transfer;     /* Current transfer */
+	uint8_t  Byte;         /* Current byte */
+	
+	uint16_t Log[_TEST_LOG_SIZE];
+	uint8_t  Count;
+	
+}Test_SlaveTypeDef;
+
+/* ------------------ Variables ------------------ */
+
+static Test_SlaveTypeDef Slave;
+static uint16_t Test_Fails = 0;
+
+/* ------------------ Functions ------------------ */
+
+static void Test_Log(uint16_t event) /* Record a bus event */
+{
+	
+	if ( Slave.Count < _TEST_LOG_SIZE )
+	{
+		Slave.Log[Slave.Count++] = event;
+	}
+	else{}
+	
+}
+
+static void Test_Slave(uint8_t nack_transfer , uint8_t nack_byte) /* Reset the slave and the log */
+{
+	
+	Slave.NackTransfer = nack_transfer;
+	Slave.NackByte     = nack_byte;
+	Slave.Transfer     = 0;
+	Slave.Byte         = 0;
+	Slave.Count        = 0;
+	
+}
+
+static void Test_Check(uint8_t cond , const char *text , int line) /* Count a failed check */
+{
+	
+	if ( !cond )
+	{
+		printf("FAIL line %d: %s\n" , line , text);
+		Test_Fails++;
+	}
+	else{}
+	
+}
+
+static uint8_t Test_LogIs(const uint16_t *expect , uint8_t count) /* Compare the bus log */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint8_t counter = 0;
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	I2C_SimBus(); /* STOP of the last transfer */
+	
+	if ( Slave.Count != count )
+	{
+		return 0;
+	}
+	else{}
+	
+	for ( ; counter < count ; counter++ )
+	{
+		
+		if ( Slave.Log[counter] != expect[counter] )
+		{
+			return 0;
+		}
+		else{}
+		
+	}
+	
+	return 1;
+	
+}
+
+void I2C_SimBus(void) /* One bus event: a command written with TWINT is carried out */
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint8_t command = I2C_Sim.CR;
+	uint8_t ack;
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	if ( !(command & (1 << TWINT)) ) /* Bus is idle or waits for the driver */
+	{
+		return;
+	}
+	else{}
+	
+	I2C_Sim.CR = (uint8_t)(command & ~(1 << TWINT)); /* Command is taken */
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ STOP ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	
+	if ( command & (1 << TWSTO) )
+	{
+		
+		Test_Log(_TEST_STOP);
+		Slave.Transfer++;
+		
+		if ( !(command & (1 << TWSTA)) ) /* No interrupt after STOP */
+		{
+			return;
+		}
+		else{}
+		
+	}
+	else{}
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ START ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	
+	if ( command & (1 << TWSTA) )
+	{
+		
+		Test_Log(_TEST_START);
+		Slave.Byte = 0;
+		I2C_Sim.SR = _MT_START_TRANSMITTED;
+		
+	}
+	else /* Byte of DR */
+	{
+		
+		Test_Log(I2C_Sim.DR);
+		ack = !( (Slave.Transfer == Slave.NackTransfer) && (Slave.Byte == Slave.NackByte) );
+		
+		if ( Slave.Byte == 0 ) /* SLA+W */
+		{
+			I2C_Sim.SR = ack ? _MT_SLA_W_TRANSMITTED_ACK : _MT_SLA_W_TRANSMITTED_NACK;
+		}
+		else
+		{
+			I2C_Sim.SR = ack ? _MT_DATA_TRANSMITTED_ACK : _MT_DATA_TRANSMITTED_NACK;
+		}
+		
+		Slave.Byte++;
+		
+	}
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Interrupt ~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	
+	if ( command & (1 << TWIE) )
+	{
+		I2C_IT_Handler();
+	}
+	else{}
+	
+}
+
+int main(void)
+{
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	uint8_t data[3] = {0xAE , 0xA8 , 0x3F};
+	uint8_t frame[32];
+	uint8_t counter = 0;
+	
+	const uint16_t write_log[] = {_TEST_START , 0x78 , 0x00 , 0xAE , 0xA8 , 0x3F , _TEST_STOP};
+	const uint16_t nack_log[]  = {_TEST_START , 0x78 , 0x00 , 0xAE , 0xA8 , _TEST_STOP};
+	const uint16_t queue_log[] = {_TEST_START , 0x78 , _TEST_STOP , _TEST_START , 0x78 , 0x40 , 0xAE , 0xA8 , 0x3F , _TEST_STOP};
+	
+	/* ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+	
+	for ( ; counter < sizeof(frame) ; counter++ )
+	{
+		frame[counter] = counter;
+	}
+	
+	I2C_Init();
+	
+	/* ~~~~~~~~~~~~~~~~ Queued write is sent after the wait ~~~~~~~~~~~~~~ */
+	
+	Test_Slave(_TEST_NO_NACK , 0);
+	
+	__TEST_CHECK( I2C_Mem_Write(0x78 , 0x00 , _I2C_MEMADD_SIZE_8BIT , data , 3 , 100) == _STAT_OK );
+	__TEST_CHECK( I2C_IT_IsBusy() );
+	__TEST_CHECK( I2C_IT_Wait(100) == _STAT_OK );
+	__TEST_CHECK( !I2C_IT_IsBusy() );
+	__TEST_CHECK( Test_LogIs(write_log , 7) );
+	
+	/* ~~~~~~~~ NACK of a copied write is reported by I2C_IT_Wait ~~~~~~~~ */
+	
+	Test_Slave(0 , 3);
+	
+	__TEST_CHECK( I2C_Mem_Write(0x78 , 0x00 , _I2C_MEMADD_SIZE_8BIT , data , 3 , 100) == _STAT_OK );
+	__TEST_CHECK( I2C_IT_Wait(100) == _STAT_ERROR );
+	__TEST_CHECK( Test_LogIs(nack_log , 6) );
+	__TEST_CHECK( I2C_IT_Wait(100) == _STAT_OK ); /* Error is reported once */
+	
+	/* ~~~~~~~~~~~~~ Address NACK drops only its own transfer ~~~~~~~~~~~~ */
+	
+	Test_Slave(0 , 0);
+	
+	__TEST_CHECK( I2C_Mem_Write(0x78 , 0x00 , _I2C_MEMADD_SIZE_8BIT , data , 1 , 100) == _STAT_OK );
+	__TEST_CHECK( I2C_Mem_Write(0x78 , 0x40 , _I2C_MEMADD_SIZE_8BIT , data , 3 , 100) == _STAT_OK );
+	__TEST_CHECK( I2C_IT_Wait(100) == _STAT_ERROR );
+	__TEST_CHECK( Test_LogIs(queue_log , 10) );
+	
+	/* ~~~~~~~~~ Write by reference waits and returns the NACK ~~~~~~~~~~ */
+	
+	Test_Slave(0 , 10);
+	
+	__TEST_CHECK( I2C_Mem_Write(0x78 , 0x40 , _I2C_MEMADD_SIZE_8BIT , frame , sizeof(frame) , 100) == _STAT_ERROR );
+	__TEST_CHECK( !I2C_IT_IsBusy() );
+	
+	I2C_SimBus();
+	
+	__TEST_CHECK( Slave.Count == 13 ); /* START, SLA+W, address, 9 bytes, STOP */
+	
+	Test_Slave(_TEST_NO_NACK , 0);
+	
+	__TEST_CHECK( I2C_Mem_Write(0x78 , 0x40 , _I2C_MEMADD_SIZE_8BIT , frame , sizeof(frame) , 100) == _STAT_OK );
+	
+	I2C_SimBus();
+	
+	__TEST_CHECK( Slave.Count == (sizeof(frame) + 4) );
+	__TEST_CHECK( Slave.Log[sizeof(frame) + 2] == (sizeof(frame) - 1) );
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	
+	printf("%s: %u failed\n" , (Test_Fails == 0) ? "PASS" : "FAIL" , Test_Fails);
+	
+	return (Test_Fails == 0) ? 0 : 1;
+	
+}
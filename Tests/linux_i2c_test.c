@@ -0,0 +1,253 @@
+/*
+------------------------------------------------------------------------------
+  File   : linux_i2c_test.c
+  Author : agent
+  Version: V0.1.0
+  Created: 10/17/2026 09:00:00 AM
+  Brief  :
+  Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+  Description:    Host test of linux_i2c through the replaceable ioctl of
+				  the handle: packing of i2c_msg and retry of I2C_RDWR.
+				
+  Attention  :    Build and run from the repository root:
+				
+				  gcc -std=gnu99 -Wall -Wextra -ISSD1306/LINUX_I2C
+					  SSD1306/LINUX_I2C/linux_i2c.c Tests/linux_i2c_test.c
+					  -o linux_i2c_test && ./linux_i2c_test
+					
+				  Test_Ioctl copies every I2C_RDWR call (failed ones too)
+				  into Bus.Call, the first Bus.Fails calls fail.
+				
+  Changes    :
+------------------------------------------------------------------------------
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "linux_i2c.h"
+
+/* ------------------ Defines -------------------- */
+
+#define _TEST_CALLS     8
+#define _TEST_MSGS      8
+#define _TEST_MSG_LEN   64
+
+#define __TEST_CHECK(cond)  Test_Check((cond) , #cond , __LINE__)
+
+/* ------------------- Struct -------------------- */
+
+typedef struct /* Copy of an i2c_msg */
+{
+	
+	uint16_t Address;
+	uint16_t Flags;
+	uint16_t Len;
+	uint8_t  Data[_TEST_MSG_LEN];
+	
+}Test_MsgTypeDef;
+
+typedef struct /* Copy of an I2C_RDWR call */
+{
+	
+	uint32_t        Count;
+	Test_MsgTypeDef Msg[_TEST_MSGS];
+	
+}Test_CallTypeDef;
+
+typedef struct /* Stand-in adapter */
+{
+	
+	uint8_t          Fails; /* Calls to fail */
+	uint8_t          Count; /* Recorded calls */
+	Test_CallTypeDef Call[_TEST_CALLS];
+	
+}Test_BusTypeDef;
+
+/* ------------------ Variables ------------------ */
+
+static Test_BusTypeDef Bus;
+static LINUX_I2C_HandleTypeDef hi2c;
+static uint16_t Test_Fails = 0;
+
+/* ------------------ Functions ------------------ */
+
+static int Test_Ioctl(int fd, unsigned long request, void *arg) /* Stand-in for ioctl */
+{
+	/* -------------------------------------------- */
+	
+	struct i2c_rdwr_ioctl_data *rdwr = (struct i2c_rdwr_ioctl_data *)arg;
+	Test_CallTypeDef *call;
+	uint32_t index;
+	
+	/* -------------------------------------------- */
+	
+	(void)fd;
+	
+	if ( (request != I2C_RDWR) || (Bus.Count >= _TEST_CALLS) || (rdwr->nmsgs > _TEST_MSGS) )
+	{
+		return -1;
+	}
+	else{}
+	
+	call = &Bus.Call[Bus.Count++];
+	call->Count = rdwr->nmsgs;
+	
+	for ( index = 0 ; index < rdwr->nmsgs ; index++ )
+	{
+		
+		call->Msg[index].Address = rdwr->msgs[index].addr;
+		call->Msg[index].Flags   = rdwr->msgs[index].flags;
+		call->Msg[index].Len     = rdwr->msgs[index].len;
+		
+		memcpy(call->Msg[index].Data , rdwr->msgs[index].buf , (rdwr->msgs[index].len < _TEST_MSG_LEN) ? rdwr->msgs[index].len : _TEST_MSG_LEN);
+		
+	}
+	
+	if ( Bus.Fails > 0 ) /* Injected error, like a NACK */
+	{
+		
+		Bus.Fails--;
+		
+		return -1;
+		
+	}
+	else{}
+	
+	return (int)rdwr->nmsgs;
+	
+}
+
+static void Test_Reset(uint8_t fails) /* Fresh handle and adapter */
+{
+	
+	memset(&Bus , 0 , sizeof(Bus));
+	Bus.Fails = fails;
+	
+	LINUX_I2C_Attach(&hi2c , -1 , Test_Ioctl);
+	
+}
+
+static void Test_Check(uint8_t cond , const char *text , int line) /* Count a failed check */
+{
+	
+	if ( !cond )
+	{
+		printf("FAIL line %d: %s\n" , line , text);
+		Test_Fails++;
+	}
+	else{}
+	
+}
+
+static uint8_t Test_MsgIs(const Test_MsgTypeDef *msg , uint8_t control , const uint8_t *data , uint16_t size) /* Message is 0x3C, control byte, data */
+{
+	
+	return ( (msg->Address == 0x3C) && (msg->Flags == 0) && (msg->Len == (size + 1)) &&
+			 (msg->Data[0] == control) && (memcmp(&msg->Data[1] , data , size) == 0) );
+			
+}
+
+int main(void)
+{
+	/* -------------------------------------------- */
+	
+	uint8_t command[6] = {0x21 , 0 , 127 , 0x22 , 0 , 7};
+	uint8_t frame[40];
+	uint8_t counter;
+	
+	LINUX_I2C_SegmentTypeDef segments[2] = {{&frame[0] , 10} , {&frame[20] , 5}};
+	
+	/* -------------------------------------------- */
+	
+	for ( counter = 0 ; counter < sizeof(frame) ; counter++ )
+	{
+		frame[counter] = (uint8_t)(0xA0 + counter);
+	}
+	
+	/* ~~~~~~~~~~~~~~~ One message: 7-bit address and prefix ~~~~~~~~~~~~~~~ */
+	
+	Test_Reset(0);
+	
+	__TEST_CHECK( LINUX_I2C_Mem_Write(&hi2c , 0x78 , 0x40 , I2C_MEMADD_SIZE_8BIT , frame , 3 , 100) == LINUX_I2C_OK );
+	__TEST_CHECK( (Bus.Count == 1) && (Bus.Call[0].Count == 1) );
+	__TEST_CHECK( Test_MsgIs(&Bus.Call[0].Msg[0] , 0x40 , frame , 3) );
+	
+	/* ~~~~~~~~~~~~~ Sessions are queued into one I2C_RDWR ~~~~~~~~~~~~~~ */
+	
+	Test_Reset(0);
+	
+	LINUX_I2C_Session_Begin(&hi2c , 0x78 , 0x00 , I2C_MEMADD_SIZE_8BIT);
+	LINUX_I2C_Session_Write(&hi2c , command , 6);
+	LINUX_I2C_Session_Begin(&hi2c , 0x78 , 0x40 , I2C_MEMADD_SIZE_8BIT);
+	LINUX_I2C_Session_Write(&hi2c , frame , 16);
+	LINUX_I2C_Session_Write(&hi2c , &frame[16] , 16);
+	LINUX_I2C_Session_Begin(&hi2c , 0x78 , 0x00 , I2C_MEMADD_SIZE_8BIT); /* Empty, dropped */
+	
+	__TEST_CHECK( Bus.Count == 0 );
+	__TEST_CHECK( LINUX_I2C_Flush(&hi2c) == LINUX_I2C_OK );
+	__TEST_CHECK( (Bus.Count == 1) && (Bus.Call[0].Count == 2) );
+	__TEST_CHECK( Test_MsgIs(&Bus.Call[0].Msg[0] , 0x00 , command , 6) );
+	__TEST_CHECK( Test_MsgIs(&Bus.Call[0].Msg[1] , 0x40 , frame , 32) );
+	
+	/* ~~~~~~~~~~~~ Segments of Mem_WriteV share one message ~~~~~~~~~~~~~ */
+	
+	Test_Reset(0);
+	
+	__TEST_CHECK( LINUX_I2C_Mem_WriteV(&hi2c , 0x78 , 0x40 , I2C_MEMADD_SIZE_8BIT , segments , 2 , 100) == LINUX_I2C_OK );
+	__TEST_CHECK( (Bus.Count == 1) && (Bus.Call[0].Count == 1) && (Bus.Call[0].Msg[0].Len == 16) );
+	__TEST_CHECK( (Bus.Call[0].Msg[0].Data[0] == 0x40) && (memcmp(&Bus.Call[0].Msg[0].Data[1] , &frame[0] , 10) == 0) );
+	__TEST_CHECK( memcmp(&Bus.Call[0].Msg[0].Data[11] , &frame[20] , 5) == 0 );
+	
+	/* ~~~~~~ MaxMsgLen splits, every part starts with the prefix ~~~~~~~ */
+	
+	Test_Reset(0);
+	hi2c.MaxMsgLen = 8;
+	
+	__TEST_CHECK( LINUX_I2C_Mem_Write(&hi2c , 0x78 , 0x40 , I2C_MEMADD_SIZE_8BIT , frame , 20 , 100) == LINUX_I2C_OK );
+	__TEST_CHECK( (Bus.Count == 1) && (Bus.Call[0].Count == 3) );
+	__TEST_CHECK( Test_MsgIs(&Bus.Call[0].Msg[0] , 0x40 , &frame[0] , 7) );
+	__TEST_CHECK( Test_MsgIs(&Bus.Call[0].Msg[1] , 0x40 , &frame[7] , 7) );
+	__TEST_CHECK( Test_MsgIs(&Bus.Call[0].Msg[2] , 0x40 , &frame[14] , 6) );
+	
+	/* ~~~~~~~~~~~~~~~~ MaxMsgs sends a full batch early ~~~~~~~~~~~~~~~~ */
+	
+	Test_Reset(0);
+	hi2c.MaxMsgs = 2;
+	
+	for ( counter = 0 ; counter < 3 ; counter++ )
+	{
+		LINUX_I2C_Session_Begin(&hi2c , 0x78 , 0x00 , I2C_MEMADD_SIZE_8BIT);
+		LINUX_I2C_Session_Write(&hi2c , &command[counter] , 1);
+	}
+	
+	__TEST_CHECK( (Bus.Count == 1) && (Bus.Call[0].Count == 2) );
+	__TEST_CHECK( LINUX_I2C_Flush(&hi2c) == LINUX_I2C_OK );
+	__TEST_CHECK( (Bus.Count == 2) && Test_MsgIs(&Bus.Call[1].Msg[0] , 0x00 , &command[2] , 1) );
+	
+	/* ~~~~~~~~~~~~~ Failed I2C_RDWR is retried with the batch ~~~~~~~~~~~~ */
+	
+	Test_Reset(2);
+	
+	__TEST_CHECK( LINUX_I2C_Mem_Write(&hi2c , 0x78 , 0x40 , I2C_MEMADD_SIZE_8BIT , frame , 20 , 100) == LINUX_I2C_OK );
+	__TEST_CHECK( (Bus.Count == 3) && (hi2c.Transfers == 3) && (hi2c.RetryCount == 2) && (hi2c.Errors == 0) );
+	__TEST_CHECK( Test_MsgIs(&Bus.Call[0].Msg[0] , 0x40 , frame , 20) );
+	__TEST_CHECK( memcmp(&Bus.Call[0] , &Bus.Call[2] , sizeof(Test_CallTypeDef)) == 0 );
+	__TEST_CHECK( hi2c.Messages == 1 );
+	
+	/* ~~~~~~~~~~~~~ Batch is dropped after the last retry ~~~~~~~~~~~~~~ */
+	
+	Test_Reset(_LINUX_I2C_RETRIES + 1);
+	
+	__TEST_CHECK( LINUX_I2C_Mem_Write(&hi2c , 0x78 , 0x40 , I2C_MEMADD_SIZE_8BIT , frame , 20 , 100) == LINUX_I2C_ERROR );
+	__TEST_CHECK( (Bus.Count == (_LINUX_I2C_RETRIES + 1)) && (hi2c.Errors == 1) && (hi2c.Count == 0) );
+	__TEST_CHECK( LINUX_I2C_Mem_Write(&hi2c , 0x78 , 0x40 , I2C_MEMADD_SIZE_8BIT , frame , 3 , 100) == LINUX_I2C_OK );
+	__TEST_CHECK( Test_MsgIs(&Bus.Call[Bus.Count - 1].Msg[0] , 0x40 , frame , 3) );
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	
+	printf("%s: %u failed\n" , (Test_Fails == 0) ? "PASS" : "FAIL" , Test_Fails);
+	
+	return (Test_Fails == 0) ? 0 : 1;
+	
+}
@@ -0,0 +1,160 @@
+/*
+------------------------------------------------------------------------------
+  File   : mux_test.c
+  Author : agent
+  Version: V0.1.0
+  Created: 10/17/2026 09:00:00 AM
+  Brief  :
+  Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+  Description:    Host test of two displays behind a TCA9548A, on the
+				  stand-in adapter and mux of linux_i2c_sim.h.
+				
+  Attention  :    Build and run from the repository root:
+				
+				  gcc -std=gnu99 -Wall -Wextra -include Tests/ssd1306_test_conf.h
+					  -ISSD1306 -ISSD1306/LINUX_I2C SSD1306/ssd1306.c
+					  SSD1306/ssd1306_transport.c SSD1306/LINUX_I2C/linux_i2c.c
+					  Tests/mux_test.c -o mux_test && ./mux_test
+					
+  Changes    :
+------------------------------------------------------------------------------
+*/
+
+#include <stdio.h>
+#include "ssd1306.h"
+
+/* ------------------ Defines -------------------- */
+
+#define _TEST_DISPLAY   (_GLCD_DEV_ADDRESS >> 1) /* 7-bit address in the log */
+
+#define __TEST_CHECK(cond)  Test_Check((cond) , #cond , __LINE__)
+
+/* ------------------ Variables ------------------ */
+
+LINUX_I2C_HandleTypeDef hi2c1; /* Adapter of _SSD1306_I2C */
+
+static GLCD_MuxTypeDef    Mux   = _GLCD_MUX(&hi2c1 , _LINUX_I2C_SIM_MUX_ADDRESS << 1);
+static GLCD_MuxBusTypeDef Bus_A = {{&hi2c1 , _GLCD_DEV_ADDRESS} , &Mux , 0};
+static GLCD_MuxBusTypeDef Bus_B = {{&hi2c1 , _GLCD_DEV_ADDRESS} , &Mux , 5};
+
+static const GLCD_TransportTypeDef Transport_A = _GLCD_MUX_TRANSPORT(&Bus_A);
+static const GLCD_TransportTypeDef Transport_B = _GLCD_MUX_TRANSPORT(&Bus_B);
+
+static uint8_t Buffer_A[_GLCD_BUFFER_SIZE];
+static uint8_t Buffer_B[_GLCD_BUFFER_SIZE];
+
+static GLCD_DisplayTypeDef Display_A;
+static GLCD_DisplayTypeDef Display_B;
+
+static uint16_t Test_Fails = 0;
+
+/* ------------------ Functions ------------------ */
+
+static void Test_Check(uint8_t cond , const char *text , int line) /* Count a failed check */
+{
+	
+	if ( !cond )
+	{
+		printf("FAIL line %d: %s\n" , line , text);
+		Test_Fails++;
+	}
+	else{}
+	
+}
+
+static uint16_t Test_Bytes(uint8_t mask , uint8_t control) /* Display bytes sent with the channel mask */
+{
+	/* -------------------------------------------- */
+	
+	uint16_t bytes = 0;
+	uint16_t index = 0;
+	
+	/* -------------------------------------------- */
+	
+	for ( ; index < LINUX_I2C_Sim.Count ; index++ )
+	{
+		
+		if ( (LINUX_I2C_Sim.Log[index].Address == _TEST_DISPLAY) && (LINUX_I2C_Sim.Log[index].Mask == mask) &&
+			 (LINUX_I2C_Sim.Log[index].Control == control) )
+		{
+			bytes += LINUX_I2C_Sim.Log[index].Len - 1;
+		}
+		else{}
+		
+	}
+	
+	return bytes;
+	
+}
+
+int main(void)
+{
+	/* -------------------------------------------- */
+	
+	GLCD_DisplayTypeDef *displays[2] = {&Display_A , &Display_B};
+	const uint8_t command = 0xAF;
+	
+	/* -------------------------------------------- */
+	
+	LINUX_I2C_Attach(&hi2c1 , -1 , LINUX_I2C_Sim_Ioctl);
+	LINUX_I2C_Sim_Clear();
+	
+	GLCD_InitDisplay(&Display_A , Buffer_A , &Transport_A , __GLCD_MUX_GROUP(&Bus_A));
+	GLCD_InitDisplay(&Display_B , Buffer_B , &Transport_B , __GLCD_MUX_GROUP(&Bus_B));
+	
+	GLCD_Select(&Display_A);
+	GLCD_Init();
+	GLCD_DrawLine(0 , 0 , 127 , 63 , _GLCD_WHITE);
+	
+	GLCD_Select(&Display_B);
+	GLCD_Init();
+	GLCD_DrawLine(0 , 63 , 127 , 0 , _GLCD_WHITE);
+	
+	/* ~~~~~~~~~~~~~~~~ Each display gets its own channel ~~~~~~~~~~~~~~~~ */
+	
+	LINUX_I2C_Sim.Count = 0;
+	
+	__TEST_CHECK( GLCD_RenderDisplays(displays , 2) == 2 );
+	__TEST_CHECK( GLCD_Status() == _GLCD_OK );
+	__TEST_CHECK( Test_Bytes(1 << 0 , _GLCD_CTRL_DATA) == _GLCD_BUFFER_SIZE );
+	__TEST_CHECK( Test_Bytes(1 << 5 , _GLCD_CTRL_DATA) == _GLCD_BUFFER_SIZE );
+	__TEST_CHECK( LINUX_I2C_Sim.Dropped == 0 );
+	__TEST_CHECK( Mux.Channel == 5 );
+	
+	/* ~~~~~~~~~~ Channel stays selected, no select is written ~~~~~~~~~~~ */
+	
+	LINUX_I2C_Sim.Selects = 0;
+	
+	__TEST_CHECK( GLCD_Mux_WriteCommand(&Bus_B , &command , 1) == _GLCD_OK );
+	__TEST_CHECK( GLCD_Mux_Flush(&Bus_B) == _GLCD_OK );
+	__TEST_CHECK( LINUX_I2C_Sim.Selects == 0 );
+	
+	/* ~~~~~~~~ Display NACK after a select forgets the channel ~~~~~~~~~ */
+	
+	hi2c1.MaxMsgs = 1;  /* Every message is sent when the next one starts */
+	hi2c1.Retries = 0;
+	LINUX_I2C_Sim.MuxMask = 0; /* Mux was reset behind the driver */
+	
+	__TEST_CHECK( GLCD_Mux_WriteCommand(&Bus_B , &command , 1) == _GLCD_OK ); /* Queued */
+	__TEST_CHECK( GLCD_Mux_WriteData(&Bus_B , Buffer_B , 16) == _GLCD_ERROR ); /* Command is NACKed */
+	__TEST_CHECK( Mux.Channel == _GLCD_MUX_UNKNOWN );
+	__TEST_CHECK( GLCD_Mux_Flush(&Bus_B) == _GLCD_ERROR ); /* Data is NACKed too */
+	
+	/* ~~~~~~~~~~~~~~~~ Next write selects the channel again ~~~~~~~~~~~~~~~ */
+	
+	LINUX_I2C_Sim.Count = 0;
+	
+	__TEST_CHECK( GLCD_Mux_WriteCommand(&Bus_B , &command , 1) == _GLCD_OK );
+	__TEST_CHECK( GLCD_Mux_Flush(&Bus_B) == _GLCD_OK );
+	__TEST_CHECK( LINUX_I2C_Sim.Selects == 1 );
+	__TEST_CHECK( (LINUX_I2C_Sim.Count == 1) && (LINUX_I2C_Sim.Log[0].Mask == (1 << 5)) );
+	__TEST_CHECK( Mux.Channel == 5 );
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	
+	printf("%s: %u failed\n" , (Test_Fails == 0) ? "PASS" : "FAIL" , Test_Fails);
+	
+	return (Test_Fails == 0) ? 0 : 1;
+	
+}
@@ -0,0 +1,214 @@
+/*
+------------------------------------------------------------------------------
+  File   : page_hash_test.c
+  Author : agent
+  Version: V0.1.0
+  Created: 10/17/2026 09:00:00 AM
+  Brief  :
+  Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+  Description:    Host test of _GLCD_PAGE_HASH: GLCD_Buffer is written
+				  directly, so only the page hashes can find the change.
+				
+  Attention  :    Build and run from the repository root:
+				
+				  gcc -std=gnu99 -Wall -Wextra -D_GLCD_PAGE_HASH
+					  -include Tests/ssd1306_test_conf.h -ISSD1306
+					  -ISSD1306/LINUX_I2C SSD1306/ssd1306.c
+					  SSD1306/ssd1306_transport.c SSD1306/LINUX_I2C/linux_i2c.c
+					  Tests/page_hash_test.c -o page_hash_test
+					  && ./page_hash_test
+					
+  Changes    :
+------------------------------------------------------------------------------
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "ssd1306.h"
+
+/* ------------------ Defines -------------------- */
+
+#define _TEST_LOG_SIZE  64 /* Recorded command bytes */
+
+#define __TEST_CHECK(cond)  Test_Check((cond) , #cond , __LINE__)
+
+/* ------------------ Variables ------------------ */
+
+LINUX_I2C_HandleTypeDef hi2c1; /* Adapter of _SSD1306_I2C, not used */
+
+extern uint8_t GLCD_Buffer[_GLCD_BUFFER_SIZE];
+
+static GLCD_StatusTypeDef Test_WriteCommand(void *handle , const uint8_t *commands , uint16_t size);
+static GLCD_StatusTypeDef Test_WriteData(void *handle , const uint8_t *data , uint16_t size);
+
+static const GLCD_TransportTypeDef Test_Transport = {NULL , 0 , 0 , Test_WriteCommand , Test_WriteData , NULL , NULL , NULL , NULL , NULL};
+
+static uint8_t  Test_Command[_TEST_LOG_SIZE]; /* Command bytes of the render */
+static uint16_t Test_Commands = 0;
+static uint8_t  Test_Data[_GLCD_BUFFER_SIZE]; /* Data bytes of the render, in bus order */
+static uint16_t Test_Bytes    = 0;
+static uint16_t Test_Calls    = 0;            /* Hook calls of the render */
+
+static uint16_t Test_Fails = 0;
+
+/* ------------------ Functions ------------------ */
+
+static void Test_Check(uint8_t cond , const char *text , int line) /* Count a failed check */
+{
+	
+	if ( !cond )
+	{
+		printf("FAIL line %d: %s\n" , line , text);
+		Test_Fails++;
+	}
+	else{}
+	
+}
+
+static GLCD_StatusTypeDef Test_WriteCommand(void *handle , const uint8_t *commands , uint16_t size)
+{
+	
+	(void)handle;
+	
+	for ( ; (size > 0) && (Test_Commands < _TEST_LOG_SIZE) ; size-- )
+	{
+		Test_Command[Test_Commands++] = *commands++;
+	}
+	
+	Test_Calls++;
+	
+	return _GLCD_OK;
+	
+}
+
+static GLCD_StatusTypeDef Test_WriteData(void *handle , const uint8_t *data , uint16_t size)
+{
+	
+	(void)handle;
+	
+	for ( ; (size > 0) && (Test_Bytes < _GLCD_BUFFER_SIZE) ; size-- )
+	{
+		Test_Data[Test_Bytes++] = *data++;
+	}
+	
+	Test_Calls++;
+	
+	return _GLCD_OK;
+	
+}
+
+static void Test_Render(void) /* Render with a clean log */
+{
+	
+	Test_Commands = 0;
+	Test_Bytes    = 0;
+	Test_Calls    = 0;
+	
+	GLCD_Render();
+	
+}
+
+static uint8_t Test_PageIs(uint8_t page) /* Render addressed only this page (0x22 page page or 0xB0 | page) */
+{
+	/* -------------------------------------------- */
+	
+	uint16_t index = 0;
+	uint8_t  found = 0;
+	
+	/* -------------------------------------------- */
+	
+	for ( ; index < Test_Commands ; index++ )
+	{
+		
+		if ( (Test_Command[index] == _GLCD_CMD_PAGE_ADD_SET) && ((index + 2) < Test_Commands) )
+		{
+			
+			if ( (Test_Command[index + 1] != page) || (Test_Command[index + 2] != page) )
+			{
+				return 0;
+			}
+			else{}
+			
+			found  = 1;
+			index += 2;
+			
+		}
+		else if ( (Test_Command[index] & 0xF8) == _GLCD_CMD_PAGE_ADD_PAGE_START_SET )
+		{
+			
+			if ( Test_Command[index] != (_GLCD_CMD_PAGE_ADD_PAGE_START_SET | page) )
+			{
+				return 0;
+			}
+			else{}
+			
+			found = 1;
+			
+		}
+		else{}
+		
+	}
+	
+	return found;
+	
+}
+
+int main(void)
+{
+	/* -------------------------------------------- */
+	
+	uint8_t page[_GLCD_SCREEN_WIDTH] = {0};
+	
+	/* -------------------------------------------- */
+	
+	GLCD_SetTransport(&Test_Transport);
+	GLCD_Init();
+	
+	Test_Render();
+	
+	/* ~~~~~~~~~~~~~~~~~~ Nothing changed, nothing is sent ~~~~~~~~~~~~~~~~~~ */
+	
+	Test_Render();
+	
+	__TEST_CHECK( Test_Calls == 0 );
+	
+	/* ~~~~~~~~~ Bottom row of columns 3 and 7: bit 31 of two words ~~~~~~~~~ */
+	
+	GLCD_Buffer[(3 * _GLCD_SCREEN_WIDTH) + 3] = 0x80;
+	GLCD_Buffer[(3 * _GLCD_SCREEN_WIDTH) + 7] = 0x80;
+	
+	page[3] = 0x80;
+	page[7] = 0x80;
+	
+	Test_Render();
+	
+	__TEST_CHECK( Test_Bytes == _GLCD_SCREEN_WIDTH );
+	__TEST_CHECK( memcmp(Test_Data , page , _GLCD_SCREEN_WIDTH) == 0 );
+	__TEST_CHECK( Test_PageIs(3) );
+	
+	Test_Render();
+	
+	__TEST_CHECK( Test_Calls == 0 );
+	
+	/* ~~~~~~~~~~~~~~~~ Back to blank, the page is sent again ~~~~~~~~~~~~~~~~ */
+	
+	GLCD_Buffer[(3 * _GLCD_SCREEN_WIDTH) + 3] = 0;
+	GLCD_Buffer[(3 * _GLCD_SCREEN_WIDTH) + 7] = 0;
+	
+	page[3] = 0;
+	page[7] = 0;
+	
+	Test_Render();
+	
+	__TEST_CHECK( Test_Bytes == _GLCD_SCREEN_WIDTH );
+	__TEST_CHECK( memcmp(Test_Data , page , _GLCD_SCREEN_WIDTH) == 0 );
+	__TEST_CHECK( Test_PageIs(3) );
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	
+	printf("%s: %u failed\n" , (Test_Fails == 0) ? "PASS" : "FAIL" , Test_Fails);
+	
+	return (Test_Fails == 0) ? 0 : 1;
+	
+}
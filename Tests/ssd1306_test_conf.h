@@ -0,0 +1,35 @@
+/*
+------------------------------------------------------------------------------
+  File   : ssd1306_test_conf.h
+  Author : agent
+  Version: V0.1.0
+  Created: 10/17/2026 09:00:00 AM
+  Brief  :
+  Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+  Description:    Configuration of the host tests of the GLCD core.
+
+  Attention  :    Given with -include Tests/ssd1306_test_conf.h, it takes
+				  the place of SSD1306/ssd1306_conf.h (same include guard).
+				  Options of a test are added with -D.
+				
+  Changes    :
+------------------------------------------------------------------------------
+*/
+
+#ifndef __SSD1306_CONF_H_
+#define __SSD1306_CONF_H_
+
+/* ~~~~~~~~~~~~~~~~ SSD1306 I2C ~~~~~~~~~~~~~~~~ */
+#define _SSD1306_I2C hi2c1
+
+/* Linux stand-in adapter with a TCA9548A (linux_i2c_sim.h) */
+#define _GLCD_USE_LINUX_I2C
+#define _LINUX_I2C_HOST_SIM
+
+/* ~~~~~~~~~~~~~~~~~ GLCD Size ~~~~~~~~~~~~~~~~~ */
+#ifndef _GLCD_SIZE
+#define _GLCD_SIZE _GLCD_SIZE_128x64
+#endif
+
+#endif /* __SSD1306_CONF_H_ */
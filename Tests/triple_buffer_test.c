@@ -0,0 +1,253 @@
+/*
+------------------------------------------------------------------------------
+  File   : triple_buffer_test.c
+  Author : agent
+  Version: V0.1.0
+  Created: 10/17/2026 09:00:00 AM
+  Brief  :
+  Support: Majid.do16@gmail.com
+------------------------------------------------------------------------------
+  Description:    Host test of the _GLCD_TRIPLE_BUFFER hand-off: a thread
+				  draws and publishes frames while the main thread renders
+				  them to a transport that checks every render. A frame
+				  whose page hash collides must still reach the bus.
+				
+  Attention  :    Build and run from the repository root:
+				
+				  gcc -std=gnu99 -Wall -Wextra -pthread -D_GLCD_TRIPLE_BUFFER
+					  -include Tests/ssd1306_test_conf.h -ISSD1306
+					  -ISSD1306/LINUX_I2C SSD1306/ssd1306.c
+					  SSD1306/ssd1306_transport.c SSD1306/LINUX_I2C/linux_i2c.c
+					  Tests/triple_buffer_test.c -o triple_buffer_test
+					  && ./triple_buffer_test
+					
+  Changes    :
+------------------------------------------------------------------------------
+*/
+
+#include <stdio.h>
+#include <pthread.h>
+#include "ssd1306.h"
+
+/* ------------------ Defines -------------------- */
+
+#define _TEST_FRAMES  100000 /* Frames of the producer */
+
+#define __TEST_CHECK(cond)  Test_Check((cond) , #cond , __LINE__)
+
+/* ------------------ Variables ------------------ */
+
+LINUX_I2C_HandleTypeDef hi2c1; /* Adapter of _SSD1306_I2C, not used */
+
+extern uint8_t GLCD_Buffer[_GLCD_BUFFER_SIZE];
+
+static GLCD_StatusTypeDef Test_WriteCommand(void *handle , const uint8_t *commands , uint16_t size);
+static GLCD_StatusTypeDef Test_WriteData(void *handle , const uint8_t *data , uint16_t size);
+
+static const GLCD_TransportTypeDef Test_Transport = {NULL , 0 , 0 , Test_WriteCommand , Test_WriteData , NULL , NULL , NULL , NULL , NULL};
+
+static uint8_t  Test_Value;     /* Byte of the frame being rendered */
+static uint8_t  Test_Started;   /* Render sent data already */
+static uint8_t  Test_Whole = 1; /* Renders send one byte value */
+static uint32_t Test_Torn  = 0; /* Renders that mixed two frames */
+static uint32_t Test_Sent  = 0; /* Renders that sent data */
+
+static uint8_t  Test_Data[_GLCD_BUFFER_SIZE]; /* Data bytes of the render, in bus order */
+static uint16_t Test_Bytes = 0;
+
+static volatile uint8_t Test_Done = 0;
+
+static uint16_t Test_Fails = 0;
+
+/* ------------------ Functions ------------------ */
+
+static void Test_Check(uint8_t cond , const char *text , int line) /* Count a failed check */
+{
+	
+	if ( !cond )
+	{
+		printf("FAIL line %d: %s\n" , line , text);
+		Test_Fails++;
+	}
+	else{}
+	
+}
+
+static GLCD_StatusTypeDef Test_WriteCommand(void *handle , const uint8_t *commands , uint16_t size)
+{
+	
+	(void)handle;
+	(void)commands;
+	(void)size;
+	
+	return _GLCD_OK;
+	
+}
+
+static GLCD_StatusTypeDef Test_WriteData(void *handle , const uint8_t *data , uint16_t size) /* Every byte of a render is the same */
+{
+	/* -------------------------------------------- */
+	
+	uint16_t index = 0;
+	
+	/* -------------------------------------------- */
+	
+	(void)handle;
+	
+	if ( !Test_Started )
+	{
+		Test_Value   = data[0];
+		Test_Started = 1;
+	}
+	else{}
+	
+	for ( ; (index < size) && (Test_Bytes < _GLCD_BUFFER_SIZE) ; index++ )
+	{
+		Test_Data[Test_Bytes++] = data[index];
+	}
+	
+	for ( index = 0 ; Test_Whole && (index < size) ; index++ )
+	{
+		
+		if ( data[index] != Test_Value )
+		{
+			
+			Test_Torn++;
+			
+			break;
+			
+		}
+		else{}
+		
+	}
+	
+	return _GLCD_OK;
+	
+}
+
+static void Test_Render(void) /* One render of the consumer */
+{
+	
+	Test_Started = 0;
+	Test_Bytes   = 0;
+	
+	GLCD_Render();
+	
+	if ( Test_Started )
+	{
+		Test_Sent++;
+	}
+	else{}
+	
+}
+
+static void *Test_Producer(void *arg) /* Whole frames of 1 .. 255, published one by one */
+{
+	/* -------------------------------------------- */
+	
+	uint32_t frame = 1;
+	
+	/* -------------------------------------------- */
+	
+	for ( ; frame <= _TEST_FRAMES ; frame++ )
+	{
+		
+		GLCD_FillScreen((COLOR_TypeDef)((frame % 255) + 1));
+		GLCD_Publish();
+		
+	}
+	
+	__atomic_store_n(&Test_Done , 1 , __ATOMIC_RELEASE);
+	
+	return arg;
+	
+}
+
+int main(void)
+{
+	/* -------------------------------------------- */
+	
+	pthread_t producer;
+	uint8_t  *first;
+	uint16_t  index;
+	uint16_t  marked = 0;
+	uint16_t  other  = 0;
+	
+	/* -------------------------------------------- */
+	
+	GLCD_SetTransport(&Test_Transport);
+	GLCD_Init();
+	
+	/* ~~~~~~~~~~~~~~~ Draw buffer follows the published frames ~~~~~~~~~~~~~~~ */
+	
+	__TEST_CHECK( GLCD_DrawBuffer() == GLCD_Buffer );
+	
+	GLCD_FillScreen((COLOR_TypeDef)0x5A);
+	
+	first = GLCD_DrawBuffer();
+	
+	GLCD_Publish();
+	
+	__TEST_CHECK( GLCD_DrawBuffer() != first );
+	__TEST_CHECK( (GLCD_DrawBuffer()[0] == 0x5A) && (GLCD_DrawBuffer()[_GLCD_BUFFER_SIZE - 1] == 0x5A) );
+	__TEST_CHECK( GLCD_GetDisplay() == NULL );
+	
+	Test_Render();
+	
+	__TEST_CHECK( (Test_Sent == 1) && (Test_Value == 0x5A) && (Test_Torn == 0) );
+	
+	/* ~~~~~~~~~ Bottom row of columns 3 and 7: same page hash, still sent ~~~~~~~~~ */
+	
+	GLCD_SetPixel(3 , 7 , _GLCD_BLACK);
+	GLCD_SetPixel(7 , 7 , _GLCD_BLACK);
+	GLCD_Publish();
+	
+	Test_Whole = 0;
+	
+	Test_Render();
+	
+	Test_Whole = 1;
+	
+	for ( index = 0 ; index < Test_Bytes ; index++ )
+	{
+		
+		if ( Test_Data[index] == 0xDA )
+		{
+			marked++;
+		}
+		else if ( Test_Data[index] != 0x5A )
+		{
+			other++;
+		}
+		else{}
+		
+	}
+	
+	__TEST_CHECK( (Test_Sent == 2) && (marked == 2) && (other == 0) );
+	
+	/* ~~~~~~~~~~~~~~~ Renders race a producer, frames stay whole ~~~~~~~~~~~~~~~ */
+	
+	Test_Sent = 0;
+	
+	__TEST_CHECK( pthread_create(&producer , NULL , Test_Producer , NULL) == 0 );
+	
+	while ( !__atomic_load_n(&Test_Done , __ATOMIC_ACQUIRE) )
+	{
+		Test_Render();
+	}
+	
+	pthread_join(producer , NULL);
+	
+	Test_Render();
+	
+	__TEST_CHECK( Test_Torn == 0 );
+	__TEST_CHECK( Test_Sent > 1 );
+	__TEST_CHECK( Test_Value == ((_TEST_FRAMES % 255) + 1) ); /* Last frame is shown */
+	
+	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	
+	printf("%s: %u failed (%lu renders)\n" , (Test_Fails == 0) ? "PASS" : "FAIL" , Test_Fails , (unsigned long)Test_Sent);
+	
+	return (Test_Fails == 0) ? 0 : 1;
+	
+}